@@ -0,0 +1,113 @@
+/**
+ * \file Tool_Bench.c
+ * \brief Host benchmark harness for the Tool module.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * Usage: tool_bench [-n iterations] [suite ...]
+ *
+ * Without suite names every registered suite runs. Each result line reads:
+ * suite, library variant, case, cost per unit.
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Tool_Bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_BENCH_ITER_DEF_U32 (200000UL)
+
+/*==================[local types]============================================*/
+
+typedef struct {
+  const char *name_pc;
+  Tool_benchSuite_pf run_pf;
+} Tool_benchEntry_t;
+
+/*==================[external data]==========================================*/
+
+volatile uint32_t Tool_BenchSink_u32;
+
+/*==================[local data]=============================================*/
+
+static const Tool_benchEntry_t Suites_s[] = {
+    {"call", Tool_BenchCall},
+    {"inline", Tool_BenchCallInl},
+    {"workload", Tool_BenchWorkload},
+    {"ring", Tool_BenchRing},
+#if defined(TOOL_BENCH_HAVE_XCORE)
+    {"xcore", Tool_BenchXcore},
+#endif
+#if defined(TOOL_BENCH_HAVE_SHARD)
+    {"shard", Tool_BenchShard},
+    {"merge", Tool_BenchMerge},
+#endif
+    {"batch", Tool_BenchBatch},
+    {"sum", Tool_BenchSum},
+    {"crc", Tool_BenchCrc},
+#if defined(TOOL_BENCH_HAVE_MEM)
+    {"mem", Tool_BenchMem},
+#endif
+#if defined(TOOL_BENCH_HAVE_POOL)
+    {"pool", Tool_BenchPool},
+#endif
+#if defined(TOOL_BENCH_HAVE_CXX)
+    {"cpp", Tool_BenchCpp},
+#endif
+#if defined(TOOL_BENCH_HAVE_CO)
+    {"co", Tool_BenchCo},
+#endif
+};
+
+/*==================[global functions]=======================================*/
+
+uint64_t Tool_BenchNow_u64(void) {
+  struct timespec l_ts_s;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &l_ts_s);
+
+  return ((uint64_t)l_ts_s.tv_sec * 1000000000ULL) + (uint64_t)l_ts_s.tv_nsec;
+}
+
+void Tool_BenchReport(const char *suite_pc, const char *case_pc, uint64_t ns_u64, uint64_t ops_u64, const char *unit_pc) {
+  double l_per_d = (ops_u64 != 0U) ? ((double)ns_u64 / (double)ops_u64) : 0.0;
+
+  (void)printf("%-10s %-8s %-28s %10.3f ns/%s\n", suite_pc, TOOL_BENCH_VARIANT, case_pc, l_per_d, unit_pc);
+}
+
+int main(int argc, char **argv) {
+  uint32_t l_iter_u32 = TOOL_BENCH_ITER_DEF_U32;
+  int l_first_s32 = 1;
+  int l_ret_s32 = 0;
+
+  if((argc > 2) && (strcmp(argv[1], "-n") == 0)) {
+    l_iter_u32 = (uint32_t)strtoul(argv[2], NULL, 0);
+    l_first_s32 = 3;
+  }
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < (uint32_t)(sizeof(Suites_s) / sizeof(Suites_s[0])); l_i_u32++) {
+    int l_sel_s32 = (l_first_s32 >= argc) ? 1 : 0;
+
+    for(int l_a_s32 = l_first_s32; l_a_s32 < argc; l_a_s32++) {
+      if(strcmp(argv[l_a_s32], Suites_s[l_i_u32].name_pc) == 0) {
+        l_sel_s32 = 1;
+      }
+    }
+    if(l_sel_s32 != 0) {
+      Suites_s[l_i_u32].run_pf(l_iter_u32);
+    }
+  }
+
+  (void)fflush(stdout);
+  return l_ret_s32;
+}
+
+/** @} */
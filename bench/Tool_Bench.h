@@ -0,0 +1,106 @@
+/**
+ * \file Tool_Bench.h
+ * \brief Host benchmark harness for the Tool module.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#ifndef TOOL_BENCH_H
+#define TOOL_BENCH_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================[macros]=================================================*/
+
+#ifndef TOOL_BENCH_VARIANT
+#define TOOL_BENCH_VARIANT "lib"
+#endif
+
+/* Ring capacity clamped to what TOOL_CFG_INDEX_WIDTH can index (needs
+ * Tool_Ring.h), so every accepted configuration still builds the suites. */
+#define TOOL_BENCH_CAP_U32(cap) (((uint32_t)(cap) > TOOL_RING_CAP_MAX_U32) ? TOOL_RING_CAP_MAX_U32 : (uint32_t)(cap))
+
+/*==================[types]==================================================*/
+
+/**
+ * \brief One benchmark suite: runs its cases with the given iteration count.
+ */
+typedef void (*Tool_benchSuite_pf)(uint32_t iter_u32);
+
+/*==================[external data]==========================================*/
+
+/* Sink that keeps benchmarked results alive. */
+extern volatile uint32_t Tool_BenchSink_u32;
+
+/*==================[function prototypes]====================================*/
+
+/**
+ * @brief Monotonic time in nanoseconds.
+ *
+ * @return uint64_t
+ * Current CLOCK_MONOTONIC time.
+ */
+uint64_t Tool_BenchNow_u64(void);
+
+/**
+ * @brief Print one result line.
+ *
+ * @param suite_pc
+ * Suite name.
+ *
+ * @param case_pc
+ * Case name inside the suite.
+ *
+ * @param ns_u64
+ * Elapsed time in nanoseconds.
+ *
+ * @param ops_u64
+ * Number of operations performed in that time.
+ *
+ * @param unit_pc
+ * Operation unit (e.g. "op", "byte").
+ */
+void Tool_BenchReport(const char *suite_pc, const char *case_pc, uint64_t ns_u64, uint64_t ops_u64, const char *unit_pc);
+
+/* Suites (see Tool_Bench.c for the registry). */
+void Tool_BenchCall(uint32_t iter_u32);
+void Tool_BenchCallInl(uint32_t iter_u32);
+void Tool_BenchWorkload(uint32_t iter_u32);
+void Tool_BenchRing(uint32_t iter_u32);
+#if defined(TOOL_BENCH_HAVE_XCORE)
+void Tool_BenchXcore(uint32_t iter_u32);
+#endif
+#if defined(TOOL_BENCH_HAVE_SHARD)
+void Tool_BenchShard(uint32_t iter_u32);
+void Tool_BenchMerge(uint32_t iter_u32);
+#endif
+void Tool_BenchBatch(uint32_t iter_u32);
+void Tool_BenchSum(uint32_t iter_u32);
+void Tool_BenchCrc(uint32_t iter_u32);
+#if defined(TOOL_BENCH_HAVE_MEM)
+void Tool_BenchMem(uint32_t iter_u32);
+#endif
+#if defined(TOOL_BENCH_HAVE_POOL)
+void Tool_BenchPool(uint32_t iter_u32);
+#endif
+#if defined(TOOL_BENCH_HAVE_CXX)
+void Tool_BenchCpp(uint32_t iter_u32);
+#endif
+#if defined(TOOL_BENCH_HAVE_CO)
+void Tool_BenchCo(uint32_t iter_u32);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOL_BENCH_H */
+
+/** @} */
@@ -0,0 +1,67 @@
+/**
+ * \file Tool_BenchBatch.c
+ * \brief One process step over many channels: per-channel calls versus the batch engine.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * `TOOL_CFG_BATCH_CHANNELS_U32` channels in RUN mode with fill levels spread
+ * over 0..`TOOL_BUFFER_SIZE_U32`. Cases (cost per channel and step):
+ * - "Tool_Process per channel": one `Tool_Process()` call per channel on the
+ *   module singleton (half full), i.e. what a loop over channel objects costs,
+ * - "Tool_ProcessAll": one `Tool_ProcessAll()` call on a `Tool_batch_t`.
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#include "Tool.h"
+#include "Tool_Batch.h"
+#include "Tool_Bench.h"
+
+/*==================[local data]=============================================*/
+
+static Tool_batch_t Batch_s;
+
+/*==================[global functions]=======================================*/
+
+void Tool_BenchBatch(uint32_t iter_u32) {
+  uint32_t l_steps_u32 = (iter_u32 / TOOL_CFG_BATCH_CHANNELS_U32) + 1U;
+  uint64_t l_ops_u64 = (uint64_t)l_steps_u32 * TOOL_CFG_BATCH_CHANNELS_U32;
+  uint32_t l_acc_u32 = 0U;
+  uint64_t l_t0_u64;
+
+  Tool_Init();
+  (void)Tool_SetMode_u8(Tool_modeRun_e);
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < (TOOL_BUFFER_SIZE_U32 / 2U); l_i_u32++) {
+    l_acc_u32 += Tool_Push_u8((uint8_t)l_i_u32);
+  }
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_s_u32 = 0U; l_s_u32 < l_steps_u32; l_s_u32++) {
+    for(uint32_t l_ch_u32 = 0U; l_ch_u32 < TOOL_CFG_BATCH_CHANNELS_U32; l_ch_u32++) {
+      Tool_Process();
+    }
+  }
+  Tool_BenchReport("batch", "Tool_Process per channel", Tool_BenchNow_u64() - l_t0_u64, l_ops_u64, "channel");
+  l_acc_u32 += Tool_GetStatus_u32();
+  Tool_DeInit();
+
+  (void)Tool_BatchInit_u8(&Batch_s, TOOL_CFG_BATCH_CHANNELS_U32);
+  for(uint32_t l_ch_u32 = 0U; l_ch_u32 < TOOL_CFG_BATCH_CHANNELS_U32; l_ch_u32++) {
+    uint32_t l_fill_u32 = (l_ch_u32 * 7U) % (TOOL_BUFFER_SIZE_U32 + 1U);
+
+    (void)Tool_BatchSetMode_u8(&Batch_s, l_ch_u32, Tool_modeRun_e, (uint8_t)l_ch_u32);
+    for(uint32_t l_i_u32 = 0U; l_i_u32 < l_fill_u32; l_i_u32++) {
+      l_acc_u32 += Tool_BatchPush_u8(&Batch_s, l_ch_u32, (uint8_t)l_i_u32);
+    }
+  }
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_s_u32 = 0U; l_s_u32 < l_steps_u32; l_s_u32++) {
+    Tool_ProcessAll(&Batch_s);
+  }
+  Tool_BenchReport("batch", "Tool_ProcessAll", Tool_BenchNow_u64() - l_t0_u64, l_ops_u64, "channel");
+  l_acc_u32 += Batch_s.data_au8[0][0];
+
+  Tool_BenchSink_u32 = l_acc_u32;
+}
+
+/** @} */
@@ -0,0 +1,80 @@
+/**
+ * \file Tool_BenchCall.c
+ * \brief Call-overhead benchmark of the Tool hot path.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * Compiled twice: as is (calls into the library, with or without LTO
+ * depending on the executable) and through Tool_BenchCallInl.c with
+ * `TOOL_CFG_INLINE_HOT`, which maps the same calls to Tool_Inline.h.
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#include "Tool.h"
+#include "Tool_Bench.h"
+#include "Tool_Inline.h"
+
+/*==================[local macros]===========================================*/
+
+#ifndef TOOL_BENCH_CALL_FN
+#define TOOL_BENCH_CALL_FN Tool_BenchCall
+#define TOOL_BENCH_CALL_NAME "call"
+#endif
+
+#define TOOL_BENCH_BURST_U32 (32U)
+
+/* 8-byte CRC frames start at one of 64 offsets: 72 bytes, whatever the cap. */
+#define TOOL_BENCH_CALL_DATA_U32 (64U + 8U)
+
+/*==================[global functions]=======================================*/
+
+void TOOL_BENCH_CALL_FN(uint32_t iter_u32) {
+  uint8_t l_data_u8[TOOL_BENCH_CALL_DATA_U32];
+  uint32_t l_acc_u32 = 0U;
+  uint64_t l_t0_u64;
+  uint64_t l_t1_u64;
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BENCH_CALL_DATA_U32; l_i_u32++) {
+    l_data_u8[l_i_u32] = (uint8_t)(l_i_u32 * 7U);
+  }
+
+  Tool_Init();
+
+  /* Bursts of pushes followed by the matching pops. */
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_n_u32 = 0U; l_n_u32 < iter_u32; l_n_u32++) {
+    for(uint32_t l_b_u32 = 0U; l_b_u32 < TOOL_BENCH_BURST_U32; l_b_u32++) {
+      l_acc_u32 += Tool_Push_u8((uint8_t)(l_b_u32 + l_n_u32));
+    }
+    for(uint32_t l_b_u32 = 0U; l_b_u32 < TOOL_BENCH_BURST_U32; l_b_u32++) {
+      uint8_t l_val_u8;
+
+      l_acc_u32 += Tool_Pop_u8(&l_val_u8);
+      l_acc_u32 += l_val_u8;
+    }
+  }
+  l_t1_u64 = Tool_BenchNow_u64();
+  Tool_BenchReport(TOOL_BENCH_CALL_NAME, "push+pop", l_t1_u64 - l_t0_u64, (uint64_t)iter_u32 * TOOL_BENCH_BURST_U32 * 2U, "op");
+
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_n_u32 = 0U; l_n_u32 < iter_u32; l_n_u32++) {
+    l_acc_u32 += Tool_GetStatus_u32();
+  }
+  l_t1_u64 = Tool_BenchNow_u64();
+  Tool_BenchReport(TOOL_BENCH_CALL_NAME, "status", l_t1_u64 - l_t0_u64, iter_u32, "op");
+
+  /* Short frames: call overhead is a visible share of the CRC cost. */
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_n_u32 = 0U; l_n_u32 < iter_u32; l_n_u32++) {
+    l_acc_u32 += Tool_ComputeCrc_u32(&l_data_u8[l_n_u32 & 0x3FU], 8U);
+  }
+  l_t1_u64 = Tool_BenchNow_u64();
+  Tool_BenchReport(TOOL_BENCH_CALL_NAME, "crc 8-byte frame", l_t1_u64 - l_t0_u64, iter_u32, "op");
+
+  Tool_DeInit();
+  Tool_BenchSink_u32 = l_acc_u32;
+}
+
+/** @} */
@@ -0,0 +1,12 @@
+/**
+ * \file Tool_BenchCallInl.c
+ * \brief Call-overhead benchmark built against the inline hot path.
+ * \author ChatGPT
+ * \date 2026-10-19
+ */
+
+#define TOOL_CFG_INLINE_HOT
+#define TOOL_BENCH_CALL_FN Tool_BenchCallInl
+#define TOOL_BENCH_CALL_NAME "inline"
+
+#include "Tool_BenchCall.c"
@@ -0,0 +1,127 @@
+/**
+ * \file Tool_BenchCo.cpp
+ * \brief Coroutine reader against a busy-polling consumer.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * A producer thread sends 8-byte messages carrying their send time, paced by
+ * a short sleep. The consumer either spins on `Tool::Ring::PopN()` ("poll") or
+ * is a coroutine awaiting `Channel::Read()` on a `Tool::Co::Executor`
+ * ("co"). Reported per message: end-to-end latency and CPU time burnt by the
+ * consumer thread.
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#include "Tool_Bench.h"
+#include "Tool_Co.hpp"
+#include <array>
+#include <cstring>
+#include <thread>
+#include <time.h>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_BENCH_CO_CAP_U32 TOOL_BENCH_CAP_U32(256U)
+#define TOOL_BENCH_CO_MSG_U32 (8U)
+#define TOOL_BENCH_CO_GAP_NS (20000L)
+
+/*==================[local types]============================================*/
+
+using Tool_benchCoExec_t = Tool::Co::Executor;
+using Tool_benchCoChan_t = Tool::Co::Channel<std::uint8_t, TOOL_BENCH_CO_CAP_U32>;
+
+/*==================[local functions]========================================*/
+
+static std::uint64_t Tool_BenchCoCpu_u64(void) {
+  struct timespec l_ts_s;
+
+  (void)clock_gettime(CLOCK_THREAD_CPUTIME_ID, &l_ts_s);
+
+  return (static_cast<std::uint64_t>(l_ts_s.tv_sec) * 1000000000ULL) + static_cast<std::uint64_t>(l_ts_s.tv_nsec);
+}
+
+static void Tool_BenchCoPace(void) {
+  struct timespec l_ts_s = {0, TOOL_BENCH_CO_GAP_NS};
+
+  (void)nanosleep(&l_ts_s, nullptr);
+}
+
+/* Producer: one timestamped message per gap; commit wakes the reader. */
+template <typename F>
+static void Tool_BenchCoProduce(std::uint32_t msgs_u32, F write_f) {
+  for(std::uint32_t l_m_u32 = 0U; l_m_u32 < msgs_u32; l_m_u32++) {
+    std::array<std::uint8_t, TOOL_BENCH_CO_MSG_U32> l_msg_a;
+    std::uint64_t l_now_u64 = Tool_BenchNow_u64();
+
+    std::memcpy(l_msg_a.data(), &l_now_u64, sizeof(l_now_u64));
+    while(write_f(l_msg_a) != TOOL_BENCH_CO_MSG_U32) {
+      std::this_thread::yield();
+    }
+    Tool_BenchCoPace();
+  }
+}
+
+static std::uint64_t Tool_BenchCoAge_u64(const std::array<std::uint8_t, TOOL_BENCH_CO_MSG_U32> &msg_a) {
+  std::uint64_t l_sent_u64;
+
+  std::memcpy(&l_sent_u64, msg_a.data(), sizeof(l_sent_u64));
+
+  return Tool_BenchNow_u64() - l_sent_u64;
+}
+
+static Tool::Co::Task Tool_BenchCoConsumer(Tool_benchCoExec_t &exec, Tool_benchCoChan_t &chan, std::uint32_t msgs_u32, std::uint64_t &lat_u64) {
+  std::array<std::uint8_t, TOOL_BENCH_CO_MSG_U32> l_msg_a;
+
+  co_await exec.Schedule();
+  for(std::uint32_t l_m_u32 = 0U; l_m_u32 < msgs_u32; l_m_u32++) {
+    (void)co_await chan.Read(l_msg_a);
+    lat_u64 += Tool_BenchCoAge_u64(l_msg_a);
+  }
+  exec.Stop();
+}
+
+/*==================[global functions]=======================================*/
+
+extern "C" void Tool_BenchCo(uint32_t iter_u32) {
+  std::uint32_t l_msgs_u32 = (iter_u32 / 100U) + 1U;
+  std::uint64_t l_lat_u64 = 0U;
+  std::uint64_t l_cpu_u64;
+
+  {
+    static Tool::Ring<std::uint8_t, TOOL_BENCH_CO_CAP_U32> l_ring_s;
+    std::array<std::uint8_t, TOOL_BENCH_CO_MSG_U32> l_msg_a;
+
+    l_cpu_u64 = Tool_BenchCoCpu_u64();
+    std::thread l_prod([&]() { Tool_BenchCoProduce(l_msgs_u32, [&](const auto &msg_a) { return l_ring_s.PushN(msg_a); }); });
+    for(std::uint32_t l_m_u32 = 0U; l_m_u32 < l_msgs_u32; l_m_u32++) {
+      while(l_ring_s.Count() < TOOL_BENCH_CO_MSG_U32) {
+        /* Busy poll. */
+      }
+      (void)l_ring_s.PopN(l_msg_a);
+      l_lat_u64 += Tool_BenchCoAge_u64(l_msg_a);
+    }
+    l_cpu_u64 = Tool_BenchCoCpu_u64() - l_cpu_u64;
+    l_prod.join();
+    Tool_BenchReport("co", "poll latency", l_lat_u64, l_msgs_u32, "msg");
+    Tool_BenchReport("co", "poll consumer cpu", l_cpu_u64, l_msgs_u32, "msg");
+  }
+
+  {
+    static Tool_benchCoExec_t l_exec_s;
+    static Tool_benchCoChan_t l_chan_s(l_exec_s);
+
+    l_lat_u64 = 0U;
+    Tool_BenchCoConsumer(l_exec_s, l_chan_s, l_msgs_u32, l_lat_u64);
+    l_cpu_u64 = Tool_BenchCoCpu_u64();
+    std::thread l_prod([&]() { Tool_BenchCoProduce(l_msgs_u32, [&](const auto &msg_a) { return l_chan_s.Write(msg_a); }); });
+    l_exec_s.Run();
+    l_cpu_u64 = Tool_BenchCoCpu_u64() - l_cpu_u64;
+    l_prod.join();
+    Tool_BenchReport("co", "co latency", l_lat_u64, l_msgs_u32, "msg");
+    Tool_BenchReport("co", "co consumer cpu", l_cpu_u64, l_msgs_u32, "msg");
+  }
+}
+
+/** @} */
@@ -0,0 +1,151 @@
+/**
+ * \file Tool_BenchCpp.cpp
+ * \brief C++ layer against the handwritten C fast path.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * Same traffic through `TOOL_DEFINE_RING()` and `Tool::Ring<>` with equal
+ * element type and capacity; the figures should match. The CRC cases compare
+ * a table-driven C loop with the constexpr-table `Tool::ComputeCrc()`: the
+ * library function itself in a `TOOL_CFG_CRC_TABLE` build, otherwise the
+ * same loop over `Tool::CrcTbl`, so both sides always run the same engine.
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#include "Tool.hpp"
+#include "Tool_Bench.h"
+#include <cstdio>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_BENCH_CPP_CAP_U32 TOOL_BENCH_CAP_U32(1024U)
+#define TOOL_BENCH_CPP_BURST_U32 (16U)
+#define TOOL_BENCH_CPP_BULK_U32 ((TOOL_BENCH_CPP_CAP_U32 < 256U) ? TOOL_BENCH_CPP_CAP_U32 : 256U)
+
+/*==================[local types]============================================*/
+
+TOOL_DEFINE_RING(BenchC, uint32_t, TOOL_BENCH_CPP_CAP_U32)
+
+/*==================[local data]=============================================*/
+
+static Tool_ringBenchC_t RingC_s;
+static Tool::Ring<std::uint32_t, TOOL_BENCH_CPP_CAP_U32> RingCpp_s;
+static std::uint32_t Src_u32[TOOL_BENCH_CPP_BULK_U32];
+static std::uint32_t Dst_u32[TOOL_BENCH_CPP_BULK_U32];
+static std::uint8_t Data_u8[TOOL_MAX_CRC_LEN_U32];
+
+/*==================[local functions]========================================*/
+
+/* Table-driven CRC-32 written as plain C, same contract as Tool_ComputeCrc_u32(). */
+static std::uint32_t Tool_BenchCppCrcC_u32(const std::uint8_t *data_pcu8, std::uint32_t length_u32) {
+#if(TOOL_CFG_CRC_ENGINE == TOOL_CFG_CRC_TABLE)
+  return Tool_ComputeCrc_u32(data_pcu8, length_u32);
+#else
+  const std::uint32_t *l_tbl_pcu32 = Tool::CrcTbl.data();
+  std::uint32_t l_len_u32 = (length_u32 > TOOL_MAX_CRC_LEN_U32) ? TOOL_MAX_CRC_LEN_U32 : length_u32;
+  std::uint32_t l_crc_u32 = 0xFFFFFFFFUL;
+
+  if(l_len_u32 == 0U) {
+    return 0U;
+  }
+  for(std::uint32_t l_i_u32 = 0U; l_i_u32 < l_len_u32; l_i_u32++) {
+    l_crc_u32 = (l_crc_u32 >> 8U) ^ l_tbl_pcu32[(l_crc_u32 ^ data_pcu8[l_i_u32]) & 0xFFU];
+  }
+
+  return l_crc_u32 ^ 0xFFFFFFFFUL;
+#endif
+}
+
+/*==================[global functions]=======================================*/
+
+extern "C" void Tool_BenchCpp(uint32_t iter_u32) {
+  std::uint32_t l_acc_u32 = 0U;
+  std::uint64_t l_t0_u64;
+  std::uint64_t l_t1_u64;
+  char l_case_ac[32];
+
+  for(std::uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BENCH_CPP_BULK_U32; l_i_u32++) {
+    Src_u32[l_i_u32] = l_i_u32 * 0x9E3779B9UL;
+  }
+  for(std::uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_MAX_CRC_LEN_U32; l_i_u32++) {
+    Data_u8[l_i_u32] = static_cast<std::uint8_t>(l_i_u32 * 7U);
+  }
+
+  Tool_RingBenchCInit(&RingC_s);
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(std::uint32_t l_n_u32 = 0U; l_n_u32 < iter_u32; l_n_u32++) {
+    for(std::uint32_t l_b_u32 = 0U; l_b_u32 < TOOL_BENCH_CPP_BURST_U32; l_b_u32++) {
+      l_acc_u32 += Tool_RingBenchCPush_u8(&RingC_s, l_b_u32 + l_n_u32);
+    }
+    for(std::uint32_t l_b_u32 = 0U; l_b_u32 < TOOL_BENCH_CPP_BURST_U32; l_b_u32++) {
+      std::uint32_t l_val_u32 = 0U;
+
+      l_acc_u32 += Tool_RingBenchCPop_u8(&RingC_s, &l_val_u32);
+      l_acc_u32 += l_val_u32;
+    }
+  }
+  l_t1_u64 = Tool_BenchNow_u64();
+  Tool_BenchReport("cpp", "C ring push/pop", l_t1_u64 - l_t0_u64, static_cast<std::uint64_t>(iter_u32) * TOOL_BENCH_CPP_BURST_U32, "sample");
+
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(std::uint32_t l_n_u32 = 0U; l_n_u32 < iter_u32; l_n_u32++) {
+    for(std::uint32_t l_b_u32 = 0U; l_b_u32 < TOOL_BENCH_CPP_BURST_U32; l_b_u32++) {
+      l_acc_u32 += RingCpp_s.Push(l_b_u32 + l_n_u32);
+    }
+    for(std::uint32_t l_b_u32 = 0U; l_b_u32 < TOOL_BENCH_CPP_BURST_U32; l_b_u32++) {
+      std::uint32_t l_val_u32 = 0U;
+
+      l_acc_u32 += RingCpp_s.Pop(l_val_u32);
+      l_acc_u32 += l_val_u32;
+    }
+  }
+  l_t1_u64 = Tool_BenchNow_u64();
+  Tool_BenchReport("cpp", "Tool::Ring push/pop", l_t1_u64 - l_t0_u64, static_cast<std::uint64_t>(iter_u32) * TOOL_BENCH_CPP_BURST_U32, "sample");
+
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(std::uint32_t l_n_u32 = 0U; l_n_u32 < iter_u32; l_n_u32++) {
+    l_acc_u32 += Tool_RingBenchCPushN_u32(&RingC_s, Src_u32, TOOL_BENCH_CPP_BULK_U32);
+    l_acc_u32 += Tool_RingBenchCPopN_u32(&RingC_s, Dst_u32, TOOL_BENCH_CPP_BULK_U32);
+    l_acc_u32 += Dst_u32[l_n_u32 & (TOOL_BENCH_CPP_BULK_U32 - 1U)];
+  }
+  l_t1_u64 = Tool_BenchNow_u64();
+  (void)std::snprintf(l_case_ac, sizeof(l_case_ac), "C ring bulk %u", static_cast<unsigned>(TOOL_BENCH_CPP_BULK_U32));
+  Tool_BenchReport("cpp", l_case_ac, l_t1_u64 - l_t0_u64, static_cast<std::uint64_t>(iter_u32) * TOOL_BENCH_CPP_BULK_U32, "sample");
+
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(std::uint32_t l_n_u32 = 0U; l_n_u32 < iter_u32; l_n_u32++) {
+    l_acc_u32 += RingCpp_s.PushN(Src_u32);
+    l_acc_u32 += RingCpp_s.PopN(Dst_u32);
+    l_acc_u32 += Dst_u32[l_n_u32 & (TOOL_BENCH_CPP_BULK_U32 - 1U)];
+  }
+  l_t1_u64 = Tool_BenchNow_u64();
+  (void)std::snprintf(l_case_ac, sizeof(l_case_ac), "Tool::Ring bulk %u", static_cast<unsigned>(TOOL_BENCH_CPP_BULK_U32));
+  Tool_BenchReport("cpp", l_case_ac, l_t1_u64 - l_t0_u64, static_cast<std::uint64_t>(iter_u32) * TOOL_BENCH_CPP_BULK_U32, "sample");
+
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(std::uint32_t l_n_u32 = 0U; l_n_u32 < iter_u32; l_n_u32++) {
+    Data_u8[0] = static_cast<std::uint8_t>(l_n_u32);
+    l_acc_u32 += Tool_BenchCppCrcC_u32(Data_u8, TOOL_MAX_CRC_LEN_U32);
+  }
+  l_t1_u64 = Tool_BenchNow_u64();
+  Tool_BenchReport("cpp", "C table CRC", l_t1_u64 - l_t0_u64, static_cast<std::uint64_t>(iter_u32) * TOOL_MAX_CRC_LEN_U32, "byte");
+
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(std::uint32_t l_n_u32 = 0U; l_n_u32 < iter_u32; l_n_u32++) {
+    Data_u8[0] = static_cast<std::uint8_t>(l_n_u32);
+    l_acc_u32 += Tool::ComputeCrc(Data_u8);
+  }
+  l_t1_u64 = Tool_BenchNow_u64();
+  Tool_BenchReport("cpp", "Tool::ComputeCrc", l_t1_u64 - l_t0_u64, static_cast<std::uint64_t>(iter_u32) * TOOL_MAX_CRC_LEN_U32, "byte");
+
+  /* All CRC implementations, the configured library engine included, must agree. */
+  if((Tool::ComputeCrc(Data_u8) != Tool_BenchCppCrcC_u32(Data_u8, TOOL_MAX_CRC_LEN_U32)) || (Tool::ComputeCrc(Data_u8) != Tool_ComputeCrc_u32(Data_u8, TOOL_MAX_CRC_LEN_U32))) {
+    Tool_BenchReport("cpp", "CRC MISMATCH", 0U, 0U, "byte");
+  }
+
+  Tool_BenchSink_u32 = l_acc_u32;
+}
+
+/** @} */
@@ -0,0 +1,163 @@
+/**
+ * \file Tool_BenchCrc.c
+ * \brief Copy plus CRC: two passes against the fused kernel.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * Frames of 256 B (default CRC cap), 64 KiB (L2) and 8 MiB (beyond the last
+ * level cache on most hosts) are copied and CRC'd either by `memcpy()`
+ * followed by `Tool_CrcUpdInl_u32()` over the copy, or by
+ * `Tool_CopyCrcUpdInl_u32()` in one pass. Reported per byte.
+ *
+ * A last pair moves one frame through the module ring per iteration: byte
+ * pushes and pops with `Tool_ComputeCrc_u32()` on both sides, against
+ * `Tool_PushBlock_u8()` / `Tool_PopBlock_u8()`. Then one queued frame that
+ * wraps around the end of the ring is checksummed in place with
+ * `Tool_CrcOfQueued_u8()`, against `Tool_ComputeCrc_u32()` on a contiguous
+ * copy.
+ *
+ * Finally 4096 frames of 16 to 128 B get their CRC one call at a time and
+ * with one `Tool_ComputeCrcN_u8()` batch, reported per frame.
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#include "Tool.h"
+#include "Tool_Bench.h"
+#include "Tool_CrcN.h"
+#include "Tool_Inline.h"
+#include <stdio.h>
+#include <string.h>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_BENCH_CRC_MAX_U32 (8U * 1024U * 1024U)
+
+/* Ring frame: half the ring, at most one CRC cap. */
+#define TOOL_BENCH_CRC_FRAME_U32 \
+  (((TOOL_BUFFER_SIZE_U32 / 2U) > TOOL_MAX_CRC_LEN_U32) ? TOOL_MAX_CRC_LEN_U32 : ((TOOL_BUFFER_SIZE_U32 / 2U) + 1U))
+
+#define TOOL_BENCH_CRC_FRAMES_U32 (4096U)
+
+/*==================[local data]=============================================*/
+
+static uint8_t Src_au8[TOOL_BENCH_CRC_MAX_U32];
+static uint8_t Dst_au8[TOOL_BENCH_CRC_MAX_U32];
+
+static const uint32_t Sizes_au32[] = {256U, 64U * 1024U, TOOL_BENCH_CRC_MAX_U32};
+
+static const uint8_t *Frame_apcu8[TOOL_BENCH_CRC_FRAMES_U32];
+static uint32_t FrameLen_au32[TOOL_BENCH_CRC_FRAMES_U32];
+static uint32_t FrameCrc_au32[TOOL_BENCH_CRC_FRAMES_U32];
+
+/*==================[global functions]=======================================*/
+
+void Tool_BenchCrc(uint32_t iter_u32) {
+  uint32_t l_acc_u32 = 0U;
+  uint64_t l_t0_u64;
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BENCH_CRC_MAX_U32; l_i_u32++) {
+    Src_au8[l_i_u32] = (uint8_t)((l_i_u32 * 131U) + 7U);
+  }
+  (void)memset(Dst_au8, 0, sizeof(Dst_au8));
+
+  for(uint32_t l_s_u32 = 0U; l_s_u32 < (uint32_t)(sizeof(Sizes_au32) / sizeof(Sizes_au32[0])); l_s_u32++) {
+    uint32_t l_len_u32 = Sizes_au32[l_s_u32];
+    uint32_t l_rep_u32 = (uint32_t)(((uint64_t)iter_u32 * 16U) / l_len_u32) + 1U;
+    char l_case_ac[32];
+
+    l_t0_u64 = Tool_BenchNow_u64();
+    for(uint32_t l_r_u32 = 0U; l_r_u32 < l_rep_u32; l_r_u32++) {
+      (void)memcpy(Dst_au8, Src_au8, l_len_u32);
+      l_acc_u32 += Tool_CrcUpdInl_u32(TOOL_CRC_INIT_U32, Dst_au8, l_len_u32);
+    }
+    (void)snprintf(l_case_ac, sizeof(l_case_ac), "memcpy+crc %u B", (unsigned)l_len_u32);
+    Tool_BenchReport("crc", l_case_ac, Tool_BenchNow_u64() - l_t0_u64, (uint64_t)l_rep_u32 * l_len_u32, "byte");
+
+    l_t0_u64 = Tool_BenchNow_u64();
+    for(uint32_t l_r_u32 = 0U; l_r_u32 < l_rep_u32; l_r_u32++) {
+      l_acc_u32 += Tool_CopyCrcUpdInl_u32(TOOL_CRC_INIT_U32, Dst_au8, Src_au8, l_len_u32);
+    }
+    (void)snprintf(l_case_ac, sizeof(l_case_ac), "fused %u B", (unsigned)l_len_u32);
+    Tool_BenchReport("crc", l_case_ac, Tool_BenchNow_u64() - l_t0_u64, (uint64_t)l_rep_u32 * l_len_u32, "byte");
+  }
+
+  Tool_Init();
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < iter_u32; l_i_u32++) {
+    const uint8_t *l_src_pcu8 = &Src_au8[l_i_u32 & 0xFFFFU];
+
+    l_acc_u32 += Tool_ComputeCrc_u32(l_src_pcu8, TOOL_BENCH_CRC_FRAME_U32);
+    for(uint32_t l_b_u32 = 0U; l_b_u32 < TOOL_BENCH_CRC_FRAME_U32; l_b_u32++) {
+      (void)Tool_Push_u8(l_src_pcu8[l_b_u32]);
+    }
+    for(uint32_t l_b_u32 = 0U; l_b_u32 < TOOL_BENCH_CRC_FRAME_U32; l_b_u32++) {
+      (void)Tool_Pop_u8(&Dst_au8[l_b_u32]);
+    }
+    l_acc_u32 += Tool_ComputeCrc_u32(Dst_au8, TOOL_BENCH_CRC_FRAME_U32);
+  }
+  Tool_BenchReport("crc", "byte push/pop + crc", Tool_BenchNow_u64() - l_t0_u64, (uint64_t)iter_u32 * TOOL_BENCH_CRC_FRAME_U32, "byte");
+
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < iter_u32; l_i_u32++) {
+    uint32_t l_crc_u32;
+
+    (void)Tool_PushBlock_u8(&Src_au8[l_i_u32 & 0xFFFFU], TOOL_BENCH_CRC_FRAME_U32, &l_crc_u32);
+    l_acc_u32 += l_crc_u32;
+    (void)Tool_PopBlock_u8(Dst_au8, TOOL_BENCH_CRC_FRAME_U32, &l_crc_u32);
+    l_acc_u32 += l_crc_u32;
+  }
+  Tool_BenchReport("crc", "Tool_Push/PopBlock_u8", Tool_BenchNow_u64() - l_t0_u64, (uint64_t)iter_u32 * TOOL_BENCH_CRC_FRAME_U32, "byte");
+
+  /* Park one frame across the end of Tool_Buffer_u8: its CRC needs two runs. */
+  Tool_Clear();
+  (void)Tool_PushBlock_u8(Src_au8, TOOL_BUFFER_SIZE_U32 - (TOOL_BENCH_CRC_FRAME_U32 / 2U), NULL);
+  (void)Tool_PopBlock_u8(Dst_au8, TOOL_BUFFER_SIZE_U32 - (TOOL_BENCH_CRC_FRAME_U32 / 2U), NULL);
+  (void)Tool_PushBlock_u8(Src_au8, TOOL_BENCH_CRC_FRAME_U32, NULL);
+
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < iter_u32; l_i_u32++) {
+    l_acc_u32 += Tool_ComputeCrc_u32(Src_au8, TOOL_BENCH_CRC_FRAME_U32);
+  }
+  Tool_BenchReport("crc", "contiguous frame", Tool_BenchNow_u64() - l_t0_u64, (uint64_t)iter_u32 * TOOL_BENCH_CRC_FRAME_U32, "byte");
+
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < iter_u32; l_i_u32++) {
+    uint32_t l_crc_u32;
+
+    (void)Tool_CrcOfQueued_u8(0U, TOOL_BENCH_CRC_FRAME_U32, &l_crc_u32);
+    l_acc_u32 += l_crc_u32;
+  }
+  Tool_BenchReport("crc", "Tool_CrcOfQueued_u8 wrapped", Tool_BenchNow_u64() - l_t0_u64, (uint64_t)iter_u32 * TOOL_BENCH_CRC_FRAME_U32, "byte");
+  Tool_DeInit();
+
+  for(uint32_t l_f_u32 = 0U; l_f_u32 < TOOL_BENCH_CRC_FRAMES_U32; l_f_u32++) {
+    Frame_apcu8[l_f_u32] = &Src_au8[l_f_u32 * 128U];
+    FrameLen_au32[l_f_u32] = 16U + ((l_f_u32 * 2654435761U) >> 25U); /* 16..143, capped below */
+    FrameLen_au32[l_f_u32] = (FrameLen_au32[l_f_u32] > 128U) ? 128U : FrameLen_au32[l_f_u32];
+  }
+  {
+    uint32_t l_rep_u32 = (iter_u32 / TOOL_BENCH_CRC_FRAMES_U32) + 1U;
+
+    l_t0_u64 = Tool_BenchNow_u64();
+    for(uint32_t l_r_u32 = 0U; l_r_u32 < l_rep_u32; l_r_u32++) {
+      for(uint32_t l_f_u32 = 0U; l_f_u32 < TOOL_BENCH_CRC_FRAMES_U32; l_f_u32++) {
+        FrameCrc_au32[l_f_u32] = Tool_ComputeCrc_u32(Frame_apcu8[l_f_u32], FrameLen_au32[l_f_u32]);
+      }
+      l_acc_u32 += FrameCrc_au32[l_r_u32 % TOOL_BENCH_CRC_FRAMES_U32];
+    }
+    Tool_BenchReport("crc", "frames one by one", Tool_BenchNow_u64() - l_t0_u64, (uint64_t)l_rep_u32 * TOOL_BENCH_CRC_FRAMES_U32, "frame");
+
+    l_t0_u64 = Tool_BenchNow_u64();
+    for(uint32_t l_r_u32 = 0U; l_r_u32 < l_rep_u32; l_r_u32++) {
+      (void)Tool_ComputeCrcN_u8(Frame_apcu8, FrameLen_au32, FrameCrc_au32, TOOL_BENCH_CRC_FRAMES_U32);
+      l_acc_u32 += FrameCrc_au32[l_r_u32 % TOOL_BENCH_CRC_FRAMES_U32];
+    }
+    Tool_BenchReport("crc", "Tool_ComputeCrcN_u8", Tool_BenchNow_u64() - l_t0_u64, (uint64_t)l_rep_u32 * TOOL_BENCH_CRC_FRAMES_U32, "frame");
+  }
+
+  Tool_BenchSink_u32 = l_acc_u32;
+}
+
+/** @} */
@@ -0,0 +1,98 @@
+/**
+ * \file Tool_BenchMem.c
+ * \brief Bulk throughput of a 16 MiB ring per backing-page kind.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * A `TOOL_DEFINE_RING()` of 4 Mi u32 samples is kept half full while 256
+ * samples are pushed and popped per step, so producer and consumer walk
+ * through the whole storage and touch a new 4 KiB page every 4 steps. Cases
+ * (cost per sample):
+ * - "plain pages": `Tool_MemAlloc_u8()` without hints, transparent huge
+ *   pages switched off for the range,
+ * - "thp": `TOOL_MEM_THP_U32`,
+ * - "hugetlb": `TOOL_MEM_HUGE_U32` (reports "plain" in its name when the
+ *   hugetlb pool is empty and the allocation fell back),
+ * each prefaulted and bound from the CPU the benchmark runs on.
+ *
+ * A smaller ring would fit the caches and measure nothing, so the suite is
+ * built only with `TOOL_CFG_INDEX_WIDTH` 32.
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#define _GNU_SOURCE
+
+#include "Tool_Bench.h"
+#include "Tool_Mem.h"
+#include "Tool_Ring.h"
+#include <sched.h>
+#include <stdio.h>
+#include <sys/mman.h>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_BENCH_MEM_CAP_U32 (1UL << 22U)
+#define TOOL_BENCH_MEM_BULK_U32 (256U)
+
+/*==================[local types]============================================*/
+
+TOOL_DEFINE_RING(BenchMem, uint32_t, TOOL_BENCH_MEM_CAP_U32)
+
+/*==================[local data]=============================================*/
+
+static uint32_t Src_u32[TOOL_BENCH_MEM_BULK_U32];
+static uint32_t Dst_u32[TOOL_BENCH_MEM_BULK_U32];
+
+/*==================[local functions]========================================*/
+
+static void Tool_BenchMemCase(uint32_t iter_u32, const char *name_pc, uint32_t flags_u32) {
+  static const char *const Kind_pc[3] = {"plain", "thp", "hugetlb"};
+  Tool_mem_t l_mem_s;
+  int32_t l_cpu_s32 = (int32_t)sched_getcpu();
+
+  if(Tool_MemAlloc_u8(&l_mem_s, sizeof(Tool_ringBenchMem_t), flags_u32 | TOOL_MEM_BIND_U32, l_cpu_s32) != 0U) {
+    Tool_BenchReport("mem", "ALLOCATION FAILED", 0U, 0U, "sample");
+  } else {
+    Tool_ringBenchMem_t *l_ring_ps = (Tool_ringBenchMem_t *)l_mem_s.base_p;
+    uint32_t l_acc_u32 = 0U;
+    uint64_t l_t0_u64;
+    char l_case_c[48];
+
+    if(flags_u32 == 0U) {
+      (void)madvise(l_mem_s.map_p, l_mem_s.mapLen_u, MADV_NOHUGEPAGE);
+    }
+
+    Tool_RingBenchMemInit(l_ring_ps);
+    for(uint32_t l_i_u32 = 0U; l_i_u32 < (TOOL_BENCH_MEM_CAP_U32 / 2U); l_i_u32 += TOOL_BENCH_MEM_BULK_U32) {
+      (void)Tool_RingBenchMemPushN_u32(l_ring_ps, Src_u32, TOOL_BENCH_MEM_BULK_U32);
+    }
+
+    l_t0_u64 = Tool_BenchNow_u64();
+    for(uint32_t l_n_u32 = 0U; l_n_u32 < iter_u32; l_n_u32++) {
+      l_acc_u32 += Tool_RingBenchMemPushN_u32(l_ring_ps, Src_u32, TOOL_BENCH_MEM_BULK_U32);
+      l_acc_u32 += Tool_RingBenchMemPopN_u32(l_ring_ps, Dst_u32, TOOL_BENCH_MEM_BULK_U32);
+      l_acc_u32 += Dst_u32[l_n_u32 & (TOOL_BENCH_MEM_BULK_U32 - 1U)];
+    }
+    (void)snprintf(l_case_c, sizeof(l_case_c), "%s (%s, node %ld)", name_pc, Kind_pc[l_mem_s.kind_e], (long)l_mem_s.node_s32);
+    Tool_BenchReport("mem", l_case_c, Tool_BenchNow_u64() - l_t0_u64, (uint64_t)iter_u32 * TOOL_BENCH_MEM_BULK_U32, "sample");
+
+    Tool_MemFree(&l_mem_s);
+    Tool_BenchSink_u32 = l_acc_u32;
+  }
+}
+
+/*==================[global functions]=======================================*/
+
+void Tool_BenchMem(uint32_t iter_u32) {
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BENCH_MEM_BULK_U32; l_i_u32++) {
+    Src_u32[l_i_u32] = l_i_u32 * 0x9E3779B9UL;
+  }
+
+  Tool_BenchMemCase(iter_u32, "plain pages", 0U);
+  Tool_BenchMemCase(iter_u32, "thp", TOOL_MEM_THP_U32);
+  Tool_BenchMemCase(iter_u32, "hugetlb", TOOL_MEM_HUGE_U32 | TOOL_MEM_THP_U32);
+}
+
+/** @} */
@@ -0,0 +1,111 @@
+/**
+ * \file Tool_BenchMerge.c
+ * \brief Timestamp-ordered merge of 4 lanes against a single-ring drain.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * Each round pushes 1024 timestamped records (fewer when the index width
+ * caps the ring) and pops them again in 64-record calls. Cases (cost per record, push and pop included):
+ * - "single ring": all records in one ring, already in order,
+ * - "merge 4 lanes": the records interleaved one by one over the 4 lanes of
+ *   a `TOOL_DEFINE_MERGE()` queue and popped in timestamp order (every record
+ *   changes the winning lane: the worst case),
+ * - "merge 4 lanes runs 16": the same with each producer pushing bursts of
+ *   16 consecutive records, served as runs.
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#include "Tool_Bench.h"
+#include "Tool_Merge.h"
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_BENCH_MERGE_LANES_U32 (4U)
+#define TOOL_BENCH_MERGE_ROUND_U32 TOOL_BENCH_CAP_U32(1024U)
+#define TOOL_BENCH_MERGE_POP_U32 (64U)
+#define TOOL_BENCH_MERGE_RUN_U32 (16U)
+
+/*==================[local types]============================================*/
+
+TOOL_DEFINE_TS_RECORD(Bench, uint32_t)
+TOOL_DEFINE_RING(BenchMergeOne, Tool_tsBench_t, TOOL_BENCH_MERGE_ROUND_U32)
+TOOL_DEFINE_MERGE(Bench, Tool_tsBench_t, ts_u64, TOOL_BENCH_MERGE_ROUND_U32 / TOOL_BENCH_MERGE_LANES_U32, TOOL_BENCH_MERGE_LANES_U32)
+
+/*==================[local data]=============================================*/
+
+static Tool_ringBenchMergeOne_t One_s;
+static Tool_mergeBench_t Merge_s;
+static Tool_tsBench_t Dst_s[TOOL_BENCH_MERGE_POP_U32];
+
+/*==================[local functions]========================================*/
+
+/* Push each round in bursts of run_u32 records per lane, pop in ts order. */
+static uint32_t Tool_BenchMergeCase(uint32_t rounds_u32, uint32_t run_u32, const char *case_pc) {
+  uint64_t l_ts_u64 = 0U;
+  uint64_t l_last_u64 = 0U;
+  uint32_t l_acc_u32 = 0U;
+  bool l_ordered_b = true;
+  uint64_t l_t0_u64;
+
+  Tool_MergeBenchInit(&Merge_s);
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_r_u32 = 0U; l_r_u32 < rounds_u32; l_r_u32++) {
+    uint32_t l_got_u32 = 0U;
+
+    for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BENCH_MERGE_ROUND_U32; l_i_u32++) {
+      Tool_tsBench_t l_rec_s = {l_ts_u64++, l_i_u32};
+
+      l_acc_u32 += Tool_ShardBenchPush_u8(&Merge_s.shard_s, (l_i_u32 / run_u32) % TOOL_BENCH_MERGE_LANES_U32, l_rec_s);
+    }
+    /* Round end: all lanes are done up to l_ts_u64. */
+    while(l_got_u32 < TOOL_BENCH_MERGE_ROUND_U32) {
+      uint32_t l_n_u32 = Tool_MergeBenchPopN_u32(&Merge_s, Dst_s, TOOL_BENCH_MERGE_POP_U32, l_ts_u64);
+
+      for(uint32_t l_i_u32 = 0U; l_i_u32 < l_n_u32; l_i_u32++) {
+        l_ordered_b = l_ordered_b && (Dst_s[l_i_u32].ts_u64 >= l_last_u64);
+        l_last_u64 = Dst_s[l_i_u32].ts_u64;
+      }
+      l_acc_u32 += (l_n_u32 != 0U) ? Dst_s[0].value : 0U;
+      l_got_u32 += l_n_u32;
+    }
+  }
+  Tool_BenchReport("merge", case_pc, Tool_BenchNow_u64() - l_t0_u64, (uint64_t)rounds_u32 * TOOL_BENCH_MERGE_ROUND_U32, "record");
+  if(!l_ordered_b) {
+    Tool_BenchReport("merge", "ORDER VIOLATION", 0U, 0U, "record");
+  }
+
+  return l_acc_u32;
+}
+
+/*==================[global functions]=======================================*/
+
+void Tool_BenchMerge(uint32_t iter_u32) {
+  uint32_t l_rounds_u32 = (iter_u32 / 64U) + 1U;
+  uint64_t l_ts_u64 = 0U;
+  uint32_t l_acc_u32 = 0U;
+  uint64_t l_t0_u64;
+
+  Tool_RingBenchMergeOneInit(&One_s);
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_r_u32 = 0U; l_r_u32 < l_rounds_u32; l_r_u32++) {
+    for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BENCH_MERGE_ROUND_U32; l_i_u32++) {
+      Tool_tsBench_t l_rec_s = {l_ts_u64++, l_i_u32};
+
+      l_acc_u32 += Tool_RingBenchMergeOnePush_u8(&One_s, l_rec_s);
+    }
+    for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BENCH_MERGE_ROUND_U32; l_i_u32 += TOOL_BENCH_MERGE_POP_U32) {
+      l_acc_u32 += Tool_RingBenchMergeOnePopN_u32(&One_s, Dst_s, TOOL_BENCH_MERGE_POP_U32);
+      l_acc_u32 += Dst_s[l_i_u32 & (TOOL_BENCH_MERGE_POP_U32 - 1U)].value;
+    }
+  }
+  Tool_BenchReport("merge", "single ring", Tool_BenchNow_u64() - l_t0_u64, (uint64_t)l_rounds_u32 * TOOL_BENCH_MERGE_ROUND_U32, "record");
+
+  l_acc_u32 += Tool_BenchMergeCase(l_rounds_u32, 1U, "merge 4 lanes");
+  l_acc_u32 += Tool_BenchMergeCase(l_rounds_u32, TOOL_BENCH_MERGE_RUN_U32, "merge 4 lanes runs 16");
+
+  Tool_BenchSink_u32 = l_acc_u32;
+}
+
+/** @} */
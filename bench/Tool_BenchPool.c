@@ -0,0 +1,94 @@
+/**
+ * \file Tool_BenchPool.c
+ * \brief Channel bank stepped by one thread versus a pinned worker pool.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * A bank of `TOOL_CFG_BATCH_CHANNELS_U32` RUN channels where only the first
+ * quarter holds data (uneven load: one worker's share carries all the
+ * rotations). Cases (cost per channel and step):
+ * - "Tool_ProcessAll": the calling thread alone,
+ * - "pool, N workers": `Tool_PoolProcessAll()` with 1, 2 and 4 workers
+ *   pinned from CPU 0 on; the steal count shows how much of the busy share
+ *   was taken over by the others.
+ *
+ * After each pool case the bank is compared with a reference bank stepped
+ * by `Tool_ProcessAll()` the same number of times. On fewer CPUs than
+ * workers the figures show the hand-off cost, not the scaling.
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#include "Tool_Bench.h"
+#include "Tool_Pool.h"
+#include <stdio.h>
+#include <string.h>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_BENCH_POOL_WORKERS_U32 (4U)
+
+/*==================[local data]=============================================*/
+
+static Tool_batch_t Bank_s;
+static Tool_batch_t Ref_s;
+static Tool_pool_t Pool_s;
+
+/*==================[local functions]========================================*/
+
+static void Tool_BenchPoolFill(Tool_batch_t *batch_ps) {
+  (void)Tool_BatchInit_u8(batch_ps, TOOL_CFG_BATCH_CHANNELS_U32);
+  for(uint32_t l_ch_u32 = 0U; l_ch_u32 < TOOL_CFG_BATCH_CHANNELS_U32; l_ch_u32++) {
+    uint32_t l_fill_u32 = (l_ch_u32 < (TOOL_CFG_BATCH_CHANNELS_U32 / 4U)) ? (((l_ch_u32 * 7U) % (TOOL_BUFFER_SIZE_U32 - 1U)) + 1U) : 0U;
+
+    (void)Tool_BatchSetMode_u8(batch_ps, l_ch_u32, Tool_modeRun_e, (uint8_t)l_ch_u32);
+    for(uint32_t l_i_u32 = 0U; l_i_u32 < l_fill_u32; l_i_u32++) {
+      (void)Tool_BatchPush_u8(batch_ps, l_ch_u32, (uint8_t)(l_i_u32 * 31U));
+    }
+  }
+}
+
+/*==================[global functions]=======================================*/
+
+void Tool_BenchPool(uint32_t iter_u32) {
+  uint32_t l_steps_u32 = (iter_u32 / TOOL_CFG_BATCH_CHANNELS_U32) + 1U;
+  uint64_t l_ops_u64 = (uint64_t)l_steps_u32 * TOOL_CFG_BATCH_CHANNELS_U32;
+  uint64_t l_t0_u64;
+
+  Tool_BenchPoolFill(&Ref_s);
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_s_u32 = 0U; l_s_u32 < l_steps_u32; l_s_u32++) {
+    Tool_ProcessAll(&Ref_s);
+  }
+  Tool_BenchReport("pool", "Tool_ProcessAll", Tool_BenchNow_u64() - l_t0_u64, l_ops_u64, "channel");
+
+  for(uint32_t l_w_u32 = 1U; l_w_u32 <= TOOL_BENCH_POOL_WORKERS_U32; l_w_u32 *= 2U) {
+    uint32_t l_steals_u32 = 0U;
+    char l_case_c[48];
+
+    Tool_BenchPoolFill(&Bank_s);
+    if(Tool_PoolInit_u8(&Pool_s, &Bank_s, l_w_u32, 0) != 0U) {
+      Tool_BenchReport("pool", "POOL START FAILED", 0U, 0U, "channel");
+    } else {
+      l_t0_u64 = Tool_BenchNow_u64();
+      for(uint32_t l_s_u32 = 0U; l_s_u32 < l_steps_u32; l_s_u32++) {
+        Tool_PoolProcessAll(&Pool_s);
+      }
+      for(uint32_t l_i_u32 = 0U; l_i_u32 < l_w_u32; l_i_u32++) {
+        l_steals_u32 += Pool_s.worker_a[l_i_u32].steals_u32;
+      }
+      (void)snprintf(l_case_c, sizeof(l_case_c), "pool, %lu worker%s, %lu steals", (unsigned long)l_w_u32, (l_w_u32 > 1U) ? "s" : "", (unsigned long)l_steals_u32);
+      Tool_BenchReport("pool", l_case_c, Tool_BenchNow_u64() - l_t0_u64, l_ops_u64, "channel");
+      Tool_PoolDeInit(&Pool_s);
+
+      if((memcmp(Bank_s.data_au8, Ref_s.data_au8, sizeof(Ref_s.data_au8)) != 0) || (memcmp(Bank_s.cycle_au32, Ref_s.cycle_au32, sizeof(Ref_s.cycle_au32)) != 0)) {
+        Tool_BenchReport("pool", "MISMATCH WITH Tool_ProcessAll", 0U, 0U, "channel");
+      }
+    }
+  }
+
+  Tool_BenchSink_u32 = Bank_s.data_au8[0][0];
+}
+
+/** @} */
@@ -0,0 +1,112 @@
+/**
+ * \file Tool_BenchRing.c
+ * \brief 32-bit sample throughput: byte ring versus typed ring.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * Cases (cost per 32-bit sample):
+ * - "u32 via byte API": four `Tool_Push_u8()` per sample, four
+ *   `Tool_Pop_u8()` and reassembly on the way out (bursts of 16 samples, the
+ *   byte ring's capacity),
+ * - "u32 typed push/pop": one `Tool_RingBenchPush_u8()` / `Pop_u8()` per sample,
+ * - "u32 typed bulk 256": `PushN` / `PopN` of 256 samples (fewer when the
+ *   index width limits the ring below 256).
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#include "Tool.h"
+#include "Tool_Bench.h"
+#include "Tool_Ring.h"
+#include <stdio.h>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_BENCH_RING_CAP_U32 TOOL_BENCH_CAP_U32(1024U)
+#define TOOL_BENCH_RING_BURST_U32 (TOOL_BUFFER_SIZE_U32 / 4U)
+#define TOOL_BENCH_RING_BULK_U32 ((TOOL_BENCH_RING_CAP_U32 < 256U) ? TOOL_BENCH_RING_CAP_U32 : 256U)
+#define TOOL_BENCH_RING_SKEW_U32 ((TOOL_BENCH_RING_BULK_U32 * 100U) / 256U)
+
+/*==================[local types]============================================*/
+
+TOOL_DEFINE_RING(Bench, uint32_t, TOOL_BENCH_RING_CAP_U32)
+
+/*==================[local data]=============================================*/
+
+static Tool_ringBench_t Ring_s;
+static uint32_t Src_u32[TOOL_BENCH_RING_BULK_U32];
+static uint32_t Dst_u32[TOOL_BENCH_RING_BULK_U32];
+
+/*==================[global functions]=======================================*/
+
+void Tool_BenchRing(uint32_t iter_u32) {
+  uint32_t l_acc_u32 = 0U;
+  uint64_t l_t0_u64;
+  uint64_t l_t1_u64;
+  char l_case_ac[32];
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BENCH_RING_BULK_U32; l_i_u32++) {
+    Src_u32[l_i_u32] = l_i_u32 * 0x9E3779B9UL;
+  }
+
+  Tool_Init();
+
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_n_u32 = 0U; l_n_u32 < iter_u32; l_n_u32++) {
+    for(uint32_t l_b_u32 = 0U; l_b_u32 < TOOL_BENCH_RING_BURST_U32; l_b_u32++) {
+      uint32_t l_val_u32 = l_b_u32 + l_n_u32;
+
+      l_acc_u32 += Tool_Push_u8((uint8_t)(l_val_u32 & 0xFFU));
+      l_acc_u32 += Tool_Push_u8((uint8_t)((l_val_u32 >> 8U) & 0xFFU));
+      l_acc_u32 += Tool_Push_u8((uint8_t)((l_val_u32 >> 16U) & 0xFFU));
+      l_acc_u32 += Tool_Push_u8((uint8_t)((l_val_u32 >> 24U) & 0xFFU));
+    }
+    for(uint32_t l_b_u32 = 0U; l_b_u32 < TOOL_BENCH_RING_BURST_U32; l_b_u32++) {
+      uint8_t l_b_u8[4];
+
+      l_acc_u32 += Tool_Pop_u8(&l_b_u8[0]);
+      l_acc_u32 += Tool_Pop_u8(&l_b_u8[1]);
+      l_acc_u32 += Tool_Pop_u8(&l_b_u8[2]);
+      l_acc_u32 += Tool_Pop_u8(&l_b_u8[3]);
+      l_acc_u32 += (uint32_t)l_b_u8[0] | ((uint32_t)l_b_u8[1] << 8U) | ((uint32_t)l_b_u8[2] << 16U) | ((uint32_t)l_b_u8[3] << 24U);
+    }
+  }
+  l_t1_u64 = Tool_BenchNow_u64();
+  Tool_BenchReport("ring", "u32 via byte API", l_t1_u64 - l_t0_u64, (uint64_t)iter_u32 * TOOL_BENCH_RING_BURST_U32, "sample");
+
+  Tool_DeInit();
+
+  Tool_RingBenchInit(&Ring_s);
+
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_n_u32 = 0U; l_n_u32 < iter_u32; l_n_u32++) {
+    for(uint32_t l_b_u32 = 0U; l_b_u32 < TOOL_BENCH_RING_BURST_U32; l_b_u32++) {
+      l_acc_u32 += Tool_RingBenchPush_u8(&Ring_s, l_b_u32 + l_n_u32);
+    }
+    for(uint32_t l_b_u32 = 0U; l_b_u32 < TOOL_BENCH_RING_BURST_U32; l_b_u32++) {
+      uint32_t l_val_u32 = 0U;
+
+      l_acc_u32 += Tool_RingBenchPop_u8(&Ring_s, &l_val_u32);
+      l_acc_u32 += l_val_u32;
+    }
+  }
+  l_t1_u64 = Tool_BenchNow_u64();
+  Tool_BenchReport("ring", "u32 typed push/pop", l_t1_u64 - l_t0_u64, (uint64_t)iter_u32 * TOOL_BENCH_RING_BURST_U32, "sample");
+
+  /* Offset start so the bulk copies regularly straddle the wrap point. */
+  (void)Tool_RingBenchPushN_u32(&Ring_s, Src_u32, TOOL_BENCH_RING_SKEW_U32);
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_n_u32 = 0U; l_n_u32 < iter_u32; l_n_u32++) {
+    l_acc_u32 += Tool_RingBenchPushN_u32(&Ring_s, Src_u32, TOOL_BENCH_RING_BULK_U32);
+    l_acc_u32 += Tool_RingBenchPopN_u32(&Ring_s, Dst_u32, TOOL_BENCH_RING_BULK_U32);
+    l_acc_u32 += Dst_u32[l_n_u32 & (TOOL_BENCH_RING_BULK_U32 - 1U)];
+  }
+  l_t1_u64 = Tool_BenchNow_u64();
+  (void)snprintf(l_case_ac, sizeof(l_case_ac), "u32 typed bulk %u", (unsigned)TOOL_BENCH_RING_BULK_U32);
+  Tool_BenchReport("ring", l_case_ac, l_t1_u64 - l_t0_u64, (uint64_t)iter_u32 * TOOL_BENCH_RING_BULK_U32, "sample");
+
+  Tool_BenchSink_u32 = l_acc_u32;
+}
+
+/** @} */
@@ -0,0 +1,149 @@
+/**
+ * \file Tool_BenchShard.c
+ * \brief Many producers: one shared ring versus per-producer shards.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * 1, 2 and 4 producer threads each push bursts of 16 u32 samples; the
+ * calling thread consumes with 64-sample pops. Cases (cost per sample over
+ * the whole transfer):
+ * - "shared": one `TOOL_DEFINE_RING()` ring, producers serialized by a mutex
+ *   (one queue with many writers),
+ * - "sharded": `TOOL_DEFINE_SHARDS()`, one lane per producer, no lock.
+ *
+ * Producers are spread over the online CPUs; on fewer CPUs than threads the
+ * figures show the per-call cost, not the scaling. The lane capacity is
+ * clamped to the configured index width; SPSC configurations only.
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#define _GNU_SOURCE
+
+#include "Tool_Bench.h"
+#include "Tool_Shard.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <unistd.h>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_BENCH_SHARD_CAP_U32 TOOL_BENCH_CAP_U32(1024U)
+#define TOOL_BENCH_SHARD_LANES_U32 (4U)
+#define TOOL_BENCH_SHARD_BURST_U32 (16U)
+#define TOOL_BENCH_SHARD_POP_U32 (64U)
+
+/*==================[local types]============================================*/
+
+TOOL_DEFINE_RING(BenchShared, uint32_t, TOOL_BENCH_SHARD_CAP_U32)
+TOOL_DEFINE_SHARDS(Bench, uint32_t, TOOL_BENCH_SHARD_CAP_U32, TOOL_BENCH_SHARD_LANES_U32)
+
+typedef struct {
+  pthread_t thr_s;
+  uint32_t lane_u32;
+  uint32_t bursts_u32;
+  bool sharded_b;
+} Tool_benchShardProd_t;
+
+/*==================[local data]=============================================*/
+
+static Tool_ringBenchShared_t Shared_s;
+static pthread_mutex_t SharedMtx_s = PTHREAD_MUTEX_INITIALIZER;
+static Tool_shardBench_t Shards_s;
+
+/*==================[local functions]========================================*/
+
+static void *Tool_BenchShardProducer(void *arg_p) {
+  const Tool_benchShardProd_t *l_prod_pc = (const Tool_benchShardProd_t *)arg_p;
+  long l_cpus_s32 = sysconf(_SC_NPROCESSORS_ONLN);
+  uint32_t l_src_u32[TOOL_BENCH_SHARD_BURST_U32];
+  cpu_set_t l_set_s;
+
+  /* Producers on CPU 1.., the consumer keeps CPU 0 when there is room. */
+  CPU_ZERO(&l_set_s);
+  CPU_SET((uint32_t)((l_prod_pc->lane_u32 + 1U) % (uint32_t)((l_cpus_s32 > 0L) ? l_cpus_s32 : 1L)), &l_set_s);
+  (void)pthread_setaffinity_np(pthread_self(), sizeof(l_set_s), &l_set_s);
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BENCH_SHARD_BURST_U32; l_i_u32++) {
+    l_src_u32[l_i_u32] = l_i_u32 + 1U;
+  }
+  for(uint32_t l_b_u32 = 0U; l_b_u32 < l_prod_pc->bursts_u32; l_b_u32++) {
+    uint32_t l_done_u32 = 0U;
+
+    while(l_done_u32 < TOOL_BENCH_SHARD_BURST_U32) {
+      uint32_t l_n_u32;
+
+      if(l_prod_pc->sharded_b) {
+        l_n_u32 = Tool_ShardBenchPushN_u32(&Shards_s, l_prod_pc->lane_u32, &l_src_u32[l_done_u32], TOOL_BENCH_SHARD_BURST_U32 - l_done_u32);
+      } else {
+        (void)pthread_mutex_lock(&SharedMtx_s);
+        l_n_u32 = Tool_RingBenchSharedPushN_u32(&Shared_s, &l_src_u32[l_done_u32], TOOL_BENCH_SHARD_BURST_U32 - l_done_u32);
+        (void)pthread_mutex_unlock(&SharedMtx_s);
+      }
+      if(l_n_u32 == 0U) {
+        sched_yield();
+      }
+      l_done_u32 += l_n_u32;
+    }
+  }
+
+  return NULL;
+}
+
+static void Tool_BenchShardCase(uint32_t iter_u32, uint32_t prods_u32, bool sharded_b) {
+  Tool_benchShardProd_t l_prod_s[TOOL_BENCH_SHARD_LANES_U32];
+  uint32_t l_dst_u32[TOOL_BENCH_SHARD_POP_U32];
+  uint32_t l_bursts_u32 = (iter_u32 / prods_u32) + 1U;
+  uint64_t l_total_u64 = (uint64_t)l_bursts_u32 * prods_u32 * TOOL_BENCH_SHARD_BURST_U32;
+  uint64_t l_recv_u64 = 0U;
+  uint32_t l_acc_u32 = 0U;
+  uint64_t l_t0_u64;
+  char l_case_c[40];
+
+  Tool_RingBenchSharedInit(&Shared_s);
+  Tool_ShardBenchInit(&Shards_s);
+
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_p_u32 = 0U; l_p_u32 < prods_u32; l_p_u32++) {
+    l_prod_s[l_p_u32].lane_u32 = l_p_u32;
+    l_prod_s[l_p_u32].bursts_u32 = l_bursts_u32;
+    l_prod_s[l_p_u32].sharded_b = sharded_b;
+    (void)pthread_create(&l_prod_s[l_p_u32].thr_s, NULL, Tool_BenchShardProducer, &l_prod_s[l_p_u32]);
+  }
+  while(l_recv_u64 < l_total_u64) {
+    uint32_t l_n_u32;
+
+    if(sharded_b) {
+      l_n_u32 = Tool_ShardBenchPopN_u32(&Shards_s, l_dst_u32, TOOL_BENCH_SHARD_POP_U32);
+    } else {
+      l_n_u32 = Tool_RingBenchSharedPopN_u32(&Shared_s, l_dst_u32, TOOL_BENCH_SHARD_POP_U32);
+    }
+    if(l_n_u32 == 0U) {
+      sched_yield();
+    }
+    for(uint32_t l_i_u32 = 0U; l_i_u32 < l_n_u32; l_i_u32++) {
+      l_acc_u32 += l_dst_u32[l_i_u32];
+    }
+    l_recv_u64 += l_n_u32;
+  }
+  for(uint32_t l_p_u32 = 0U; l_p_u32 < prods_u32; l_p_u32++) {
+    (void)pthread_join(l_prod_s[l_p_u32].thr_s, NULL);
+  }
+
+  (void)snprintf(l_case_c, sizeof(l_case_c), "%s, %lu producer%s", sharded_b ? "sharded" : "shared", (unsigned long)prods_u32, (prods_u32 > 1U) ? "s" : "");
+  Tool_BenchReport("shard", l_case_c, Tool_BenchNow_u64() - l_t0_u64, l_total_u64, "sample");
+  Tool_BenchSink_u32 = l_acc_u32;
+}
+
+/*==================[global functions]=======================================*/
+
+void Tool_BenchShard(uint32_t iter_u32) {
+  for(uint32_t l_p_u32 = 1U; l_p_u32 <= TOOL_BENCH_SHARD_LANES_U32; l_p_u32 *= 2U) {
+    Tool_BenchShardCase(iter_u32, l_p_u32, false);
+    Tool_BenchShardCase(iter_u32, l_p_u32, true);
+  }
+}
+
+/** @} */
@@ -0,0 +1,74 @@
+/**
+ * \file Tool_BenchSum.c
+ * \brief Byte-sum reduction: cost per byte of each kernel.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * Every kernel of `Tool_SumBytes_u32()` compiled in and supported by the CPU
+ * sums ranges of 64 B (one default ring), 4 KiB (L1) and 1 MiB (L2/L3).
+ * Each case is reported per byte. A final case runs `Tool_RunTst_u8()` with
+ * the default kernel, per call.
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#include "Tool.h"
+#include "Tool_Bench.h"
+#include "Tool_Sum.h"
+#include <stdio.h>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_BENCH_SUM_MAX_U32 (1024U * 1024U)
+
+/*==================[local data]=============================================*/
+
+static uint8_t Data_au8[TOOL_BENCH_SUM_MAX_U32];
+
+static const char *const KernelName_apc[TOOL_SUM_KERNELS_U32] = {"scalar", "sse2", "avx2", "neon"};
+
+static const uint32_t Sizes_au32[] = {64U, 4096U, TOOL_BENCH_SUM_MAX_U32};
+
+/*==================[global functions]=======================================*/
+
+void Tool_BenchSum(uint32_t iter_u32) {
+  Tool_sumKernel_e l_best_e = Tool_SumBest_e();
+  uint32_t l_acc_u32 = 0U;
+  uint64_t l_t0_u64;
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BENCH_SUM_MAX_U32; l_i_u32++) {
+    Data_au8[l_i_u32] = (uint8_t)((l_i_u32 * 131U) + 7U);
+  }
+
+  for(uint32_t l_k_u32 = 0U; l_k_u32 < TOOL_SUM_KERNELS_U32; l_k_u32++) {
+    if(Tool_SumSelect_u8((Tool_sumKernel_e)l_k_u32) != 0U) {
+      continue;
+    }
+    for(uint32_t l_s_u32 = 0U; l_s_u32 < (uint32_t)(sizeof(Sizes_au32) / sizeof(Sizes_au32[0])); l_s_u32++) {
+      uint32_t l_len_u32 = Sizes_au32[l_s_u32];
+      uint32_t l_rep_u32 = (uint32_t)(((uint64_t)iter_u32 * 64U) / l_len_u32) + 1U;
+      char l_case_ac[32];
+
+      l_t0_u64 = Tool_BenchNow_u64();
+      for(uint32_t l_r_u32 = 0U; l_r_u32 < l_rep_u32; l_r_u32++) {
+        l_acc_u32 += Tool_SumBytes_u32(Data_au8, l_len_u32);
+      }
+      (void)snprintf(l_case_ac, sizeof(l_case_ac), "%s %u B", KernelName_apc[l_k_u32], (unsigned)l_len_u32);
+      Tool_BenchReport("sum", l_case_ac, Tool_BenchNow_u64() - l_t0_u64, (uint64_t)l_rep_u32 * l_len_u32, "byte");
+    }
+  }
+  (void)Tool_SumSelect_u8(l_best_e);
+
+  Tool_Init();
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < iter_u32; l_i_u32++) {
+    l_acc_u32 += Tool_RunTst_u8();
+  }
+  Tool_BenchReport("sum", "Tool_RunTst_u8", Tool_BenchNow_u64() - l_t0_u64, iter_u32, "call");
+  Tool_DeInit();
+
+  Tool_BenchSink_u32 = l_acc_u32;
+}
+
+/** @} */
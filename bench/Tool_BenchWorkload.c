@@ -0,0 +1,99 @@
+/**
+ * \file Tool_BenchWorkload.c
+ * \brief Representative traffic profile of the Tool module.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * Used as the training run of the profile-guided build (cmake/ToolPgo.cmake)
+ * and as the figure of merit reported before and after PGO. The sequence is
+ * driven by a fixed-seed generator so every run executes the same calls.
+ *
+ * Per iteration:
+ * - a push burst of 1..64 bytes (overflow when the ring is already filled),
+ * - a pop burst of 1..64 bytes (underflow when the ring runs dry),
+ * - every 4th iteration one Tool_Process() cycle in RUN mode,
+ * - every 8th iteration a status read and a self-test,
+ * - one CRC over 8..256 bytes.
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#include "Tool.h"
+#include "Tool_Bench.h"
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_BENCH_WL_SEED_U32 (0x2545F491UL)
+
+/* Frame: up to 64 pushed bytes per iteration and one capped CRC input. */
+#define TOOL_BENCH_WL_FRAME_U32 ((TOOL_MAX_CRC_LEN_U32 > 64U) ? TOOL_MAX_CRC_LEN_U32 : 64U)
+
+/* CRC lengths 8..cap (just the cap when it is shorter than 8 bytes). */
+#define TOOL_BENCH_WL_CRC_MIN_U32 ((TOOL_MAX_CRC_LEN_U32 < 8U) ? TOOL_MAX_CRC_LEN_U32 : 8U)
+#define TOOL_BENCH_WL_CRC_SPAN_U32 ((TOOL_MAX_CRC_LEN_U32 - TOOL_BENCH_WL_CRC_MIN_U32) + 1U)
+
+/*==================[local functions]========================================*/
+
+static uint32_t Tool_BenchWlRand_u32(uint32_t *state_pu32) {
+  /* xorshift32: cheap and identical on every host. */
+  uint32_t l_x_u32 = *state_pu32;
+
+  l_x_u32 ^= l_x_u32 << 13U;
+  l_x_u32 ^= l_x_u32 >> 17U;
+  l_x_u32 ^= l_x_u32 << 5U;
+  *state_pu32 = l_x_u32;
+
+  return l_x_u32;
+}
+
+/*==================[global functions]=======================================*/
+
+void Tool_BenchWorkload(uint32_t iter_u32) {
+  uint8_t l_frame_u8[TOOL_BENCH_WL_FRAME_U32];
+  uint32_t l_rng_u32 = TOOL_BENCH_WL_SEED_U32;
+  uint32_t l_acc_u32 = 0U;
+  uint64_t l_t0_u64;
+  uint64_t l_t1_u64;
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BENCH_WL_FRAME_U32; l_i_u32++) {
+    l_frame_u8[l_i_u32] = (uint8_t)Tool_BenchWlRand_u32(&l_rng_u32);
+  }
+
+  Tool_Init();
+
+  l_t0_u64 = Tool_BenchNow_u64();
+  for(uint32_t l_n_u32 = 0U; l_n_u32 < iter_u32; l_n_u32++) {
+    uint32_t l_r_u32 = Tool_BenchWlRand_u32(&l_rng_u32);
+    uint32_t l_push_u32 = (l_r_u32 & 0x3FU) + 1U;
+    uint32_t l_pop_u32 = ((l_r_u32 >> 6U) & 0x3FU) + 1U;
+    uint32_t l_crc_u32 = ((l_r_u32 >> 12U) % TOOL_BENCH_WL_CRC_SPAN_U32) + TOOL_BENCH_WL_CRC_MIN_U32;
+
+    for(uint32_t l_b_u32 = 0U; l_b_u32 < l_push_u32; l_b_u32++) {
+      l_acc_u32 += Tool_Push_u8(l_frame_u8[l_b_u32]);
+    }
+    for(uint32_t l_b_u32 = 0U; l_b_u32 < l_pop_u32; l_b_u32++) {
+      uint8_t l_val_u8;
+
+      l_acc_u32 += Tool_Pop_u8(&l_val_u8);
+      l_acc_u32 += l_val_u8;
+    }
+    if((l_n_u32 & 3U) == 0U) {
+      (void)Tool_SetMode_u8(Tool_modeRun_e);
+      Tool_Process();
+      (void)Tool_SetMode_u8(Tool_modeIdle_e);
+    }
+    if((l_n_u32 & 7U) == 0U) {
+      l_acc_u32 += Tool_GetStatus_u32();
+      l_acc_u32 += Tool_RunTst_u8();
+    }
+    l_acc_u32 += Tool_ComputeCrc_u32(l_frame_u8, l_crc_u32);
+  }
+  l_t1_u64 = Tool_BenchNow_u64();
+  Tool_BenchReport("workload", "mixed traffic iteration", l_t1_u64 - l_t0_u64, iter_u32, "iter");
+
+  Tool_DeInit();
+  Tool_BenchSink_u32 = l_acc_u32;
+}
+
+/** @} */
@@ -0,0 +1,201 @@
+/**
+ * \file Tool_BenchXcore.c
+ * \brief Cross-core SPSC throughput: packed versus cache-line split ring.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * A producer thread streams 32-bit samples to a consumer thread, pinned to
+ * CPU 0 and CPU 1 when the machine has two. Cases (cost per sample, bursts
+ * of 16 and bulk 256 each):
+ * - "packed": the pre-split layout, both indices in one line next to the
+ *   data and the opposite index re-read on every call,
+ * - "split": `TOOL_DEFINE_RING()`, indices and data on separate lines with
+ *   cached opposite indices.
+ *
+ * On a single CPU the threads time-share and the figures show the call cost
+ * only; a note line says so. The capacity is clamped to the configured
+ * index width. Built for SPSC configurations only: the two threads share
+ * the ring indices.
+ *
+ * \defgroup Tool_Bench Tool Benchmarks
+ * @{
+ */
+
+#define _GNU_SOURCE
+
+#include "Tool_Bench.h"
+#include "Tool_Ring.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_BENCH_XCORE_CAP_U32 TOOL_BENCH_CAP_U32(1024U)
+#define TOOL_BENCH_XCORE_BURST_U32 (16U)
+#define TOOL_BENCH_XCORE_BULK_U32 ((TOOL_BENCH_XCORE_CAP_U32 < 256U) ? TOOL_BENCH_XCORE_CAP_U32 : 256U)
+
+/*==================[local types]============================================*/
+
+TOOL_DEFINE_RING(Xcore, uint32_t, TOOL_BENCH_XCORE_CAP_U32)
+
+/* Pre-split layout: indices share a line with each other and the data. */
+typedef struct {
+  Tool_cfgIdx_t head_u;
+  Tool_cfgIdx_t tail_u;
+  uint32_t data_a[TOOL_BENCH_XCORE_CAP_U32];
+} Tool_benchXcorePacked_t;
+
+typedef struct {
+  uint32_t (*put_pf)(const uint32_t *src_pc, uint32_t n_u32);
+  uint32_t (*get_pf)(uint32_t *dst_p, uint32_t n_u32);
+  uint32_t chunk_u32; /* Elements per call. */
+  uint64_t total_u64; /* Elements to transfer. */
+  uint32_t sum_u32;   /* Consumer checksum. */
+} Tool_benchXcoreJob_t;
+
+/*==================[local data]=============================================*/
+
+static Tool_benchXcorePacked_t Packed_s __attribute__((aligned(TOOL_RING_LINE_U32)));
+static Tool_ringXcore_t Split_s;
+
+/*==================[local functions]========================================*/
+
+static uint32_t Tool_BenchXcorePackedPut_u32(const uint32_t *src_pc, uint32_t n_u32) {
+  Tool_cfgIdx_t l_head_u = Packed_s.head_u;
+  uint32_t l_free_u32 = TOOL_BENCH_XCORE_CAP_U32 - (uint32_t)(Tool_cfgIdx_t)(l_head_u - TOOL_RING_LOAD_ACQ(Packed_s.tail_u));
+  uint32_t l_n_u32 = (n_u32 > l_free_u32) ? l_free_u32 : n_u32;
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < l_n_u32; l_i_u32++) {
+    Packed_s.data_a[(l_head_u + l_i_u32) & (TOOL_BENCH_XCORE_CAP_U32 - 1U)] = src_pc[l_i_u32];
+  }
+  TOOL_RING_STORE_REL(Packed_s.head_u, (Tool_cfgIdx_t)(l_head_u + l_n_u32));
+
+  return l_n_u32;
+}
+
+static uint32_t Tool_BenchXcorePackedGet_u32(uint32_t *dst_p, uint32_t n_u32) {
+  Tool_cfgIdx_t l_tail_u = Packed_s.tail_u;
+  uint32_t l_used_u32 = (uint32_t)(Tool_cfgIdx_t)(TOOL_RING_LOAD_ACQ(Packed_s.head_u) - l_tail_u);
+  uint32_t l_n_u32 = (n_u32 > l_used_u32) ? l_used_u32 : n_u32;
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < l_n_u32; l_i_u32++) {
+    dst_p[l_i_u32] = Packed_s.data_a[(l_tail_u + l_i_u32) & (TOOL_BENCH_XCORE_CAP_U32 - 1U)];
+  }
+  TOOL_RING_STORE_REL(Packed_s.tail_u, (Tool_cfgIdx_t)(l_tail_u + l_n_u32));
+
+  return l_n_u32;
+}
+
+static uint32_t Tool_BenchXcoreSplitPut_u32(const uint32_t *src_pc, uint32_t n_u32) {
+  return Tool_RingXcorePushN_u32(&Split_s, src_pc, n_u32);
+}
+
+static uint32_t Tool_BenchXcoreSplitGet_u32(uint32_t *dst_p, uint32_t n_u32) {
+  return Tool_RingXcorePopN_u32(&Split_s, dst_p, n_u32);
+}
+
+static void Tool_BenchXcorePin(uint32_t cpu_u32) {
+  cpu_set_t l_set_s;
+
+  CPU_ZERO(&l_set_s);
+  CPU_SET(cpu_u32, &l_set_s);
+  (void)pthread_setaffinity_np(pthread_self(), sizeof(l_set_s), &l_set_s);
+}
+
+static void *Tool_BenchXcoreProducer(void *arg_p) {
+  const Tool_benchXcoreJob_t *l_job_pc = (const Tool_benchXcoreJob_t *)arg_p;
+  uint32_t l_src_u32[TOOL_BENCH_XCORE_BULK_U32];
+  uint64_t l_sent_u64 = 0U;
+
+  Tool_BenchXcorePin(0U);
+  while(l_sent_u64 < l_job_pc->total_u64) {
+    uint32_t l_n_u32;
+
+    for(uint32_t l_i_u32 = 0U; l_i_u32 < l_job_pc->chunk_u32; l_i_u32++) {
+      l_src_u32[l_i_u32] = (uint32_t)l_sent_u64 + l_i_u32;
+    }
+    l_n_u32 = l_job_pc->put_pf(l_src_u32, l_job_pc->chunk_u32);
+    if(l_n_u32 == 0U) {
+      sched_yield();
+    }
+    /* A partial put resends the tail as the start of the next chunk. */
+    l_sent_u64 += l_n_u32;
+  }
+
+  return NULL;
+}
+
+static uint64_t Tool_BenchXcoreRun_u64(Tool_benchXcoreJob_t *job_ps) {
+  uint32_t l_dst_u32[TOOL_BENCH_XCORE_BULK_U32];
+  uint64_t l_recv_u64 = 0U;
+  uint64_t l_t0_u64;
+  pthread_t l_prod_s;
+
+  job_ps->sum_u32 = 0U;
+  l_t0_u64 = Tool_BenchNow_u64();
+  (void)pthread_create(&l_prod_s, NULL, Tool_BenchXcoreProducer, job_ps);
+  while(l_recv_u64 < job_ps->total_u64) {
+    uint32_t l_n_u32 = job_ps->get_pf(l_dst_u32, job_ps->chunk_u32);
+
+    if(l_n_u32 == 0U) {
+      sched_yield();
+    }
+    for(uint32_t l_i_u32 = 0U; l_i_u32 < l_n_u32; l_i_u32++) {
+      job_ps->sum_u32 += l_dst_u32[l_i_u32];
+    }
+    l_recv_u64 += l_n_u32;
+  }
+  (void)pthread_join(l_prod_s, NULL);
+
+  return Tool_BenchNow_u64() - l_t0_u64;
+}
+
+/*==================[global functions]=======================================*/
+
+void Tool_BenchXcore(uint32_t iter_u32) {
+  static const uint32_t Chunk_u32[2] = {TOOL_BENCH_XCORE_BURST_U32, TOOL_BENCH_XCORE_BULK_U32};
+  static const char *const Layout_pc[2] = {"packed", "split"};
+  static const char *const Kind_pc[2] = {"burst", "bulk"};
+  uint64_t l_total_u64 = (uint64_t)iter_u32 * TOOL_BENCH_XCORE_BULK_U32;
+  uint32_t l_expect_u32 = 0U;
+  bool l_multi_b = (sysconf(_SC_NPROCESSORS_ONLN) > 1L);
+  cpu_set_t l_saved_s;
+
+  for(uint64_t l_i_u64 = 0U; l_i_u64 < l_total_u64; l_i_u64++) {
+    l_expect_u32 += (uint32_t)l_i_u64;
+  }
+  if(!l_multi_b) {
+    (void)printf("%-10s note: single CPU, threads time-share (call cost only)\n", "xcore");
+  }
+
+  (void)pthread_getaffinity_np(pthread_self(), sizeof(l_saved_s), &l_saved_s);
+  Tool_BenchXcorePin(1U);
+  for(uint32_t l_l_u32 = 0U; l_l_u32 < 2U; l_l_u32++) {
+    for(uint32_t l_c_u32 = 0U; l_c_u32 < 2U; l_c_u32++) {
+      Tool_benchXcoreJob_t l_job_s;
+      char l_case_ac[32];
+      uint64_t l_ns_u64;
+
+      (void)memset(&Packed_s, 0, sizeof(Packed_s));
+      Tool_RingXcoreInit(&Split_s);
+      l_job_s.put_pf = (l_l_u32 == 0U) ? Tool_BenchXcorePackedPut_u32 : Tool_BenchXcoreSplitPut_u32;
+      l_job_s.get_pf = (l_l_u32 == 0U) ? Tool_BenchXcorePackedGet_u32 : Tool_BenchXcoreSplitGet_u32;
+      l_job_s.chunk_u32 = Chunk_u32[l_c_u32];
+      l_job_s.total_u64 = l_total_u64;
+
+      l_ns_u64 = Tool_BenchXcoreRun_u64(&l_job_s);
+      (void)snprintf(l_case_ac, sizeof(l_case_ac), "%s %s %u", Layout_pc[l_l_u32], Kind_pc[l_c_u32], (unsigned)Chunk_u32[l_c_u32]);
+      Tool_BenchReport("xcore", l_case_ac, l_ns_u64, l_total_u64, "sample");
+      if(l_job_s.sum_u32 != l_expect_u32) {
+        Tool_BenchReport("xcore", "CHECKSUM MISMATCH", 0U, 0U, "sample");
+      }
+    }
+  }
+  (void)pthread_setaffinity_np(pthread_self(), sizeof(l_saved_s), &l_saved_s);
+}
+
+/** @} */
@@ -0,0 +1,99 @@
+# Two-phase profile-guided optimization driver for the Tool library.
+#
+# Invoked by the `tool_pgo` target (or directly with `cmake -P`):
+#   cmake -DTOOL_SRC_DIR=<src> -DTOOL_WORK_DIR=<dir> [-DTOOL_C_COMPILER=<cc>]
+#         [-DTOOL_GENERATOR=<gen>] [-DTOOL_PGO_ITER=<n>] -P cmake/ToolPgo.cmake
+#
+# Steps (all builds are Release, in sub-directories of TOOL_WORK_DIR):
+#   1. base/  plain build, reference run of `tool_bench workload`.
+#   2. pgo/   TOOL_PGO=GENERATE build, training run of the same workload.
+#   3. pgo/   reconfigured with TOOL_PGO=USE (same object paths, so the
+#             profile matches), rebuilt and measured again.
+# The optimized library is copied to TOOL_WORK_DIR/libnew_pgo.a and the
+# speedup of the workload is printed. The workload is deterministic (fixed
+# seed) and the profile directory is wiped first, so reruns are reproducible.
+
+cmake_minimum_required(VERSION 3.16)
+
+foreach(l_var TOOL_SRC_DIR TOOL_WORK_DIR)
+    if(NOT DEFINED ${l_var})
+        message(FATAL_ERROR "ToolPgo: ${l_var} is required")
+    endif()
+endforeach()
+if(NOT DEFINED TOOL_PGO_ITER)
+    set(TOOL_PGO_ITER 200000)
+endif()
+
+set(l_common -DCMAKE_BUILD_TYPE=Release -DTOOL_BUILD_BENCH=ON -DTOOL_BUILD_HOST_TOOLS=OFF)
+if(DEFINED TOOL_C_COMPILER AND NOT TOOL_C_COMPILER STREQUAL "")
+    list(APPEND l_common -DCMAKE_C_COMPILER=${TOOL_C_COMPILER})
+endif()
+if(DEFINED TOOL_GENERATOR AND NOT TOOL_GENERATOR STREQUAL "")
+    list(APPEND l_common -G ${TOOL_GENERATOR})
+endif()
+
+set(l_profile_dir ${TOOL_WORK_DIR}/profile)
+
+function(tool_pgo_run l_desc)
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE l_rc OUTPUT_VARIABLE l_out ERROR_VARIABLE l_err)
+    if(NOT l_rc EQUAL 0)
+        message(FATAL_ERROR "ToolPgo: ${l_desc} failed (${l_rc})\n${l_out}\n${l_err}")
+    endif()
+    set(TOOL_PGO_OUT "${l_out}" PARENT_SCOPE)
+endfunction()
+
+function(tool_pgo_measure l_bin l_result)
+    tool_pgo_run("workload run" ${l_bin} -n ${TOOL_PGO_ITER} workload)
+    string(REGEX MATCH "mixed traffic iteration +([0-9.]+) ns/iter" l_match "${TOOL_PGO_OUT}")
+    if(NOT l_match)
+        message(FATAL_ERROR "ToolPgo: unexpected benchmark output\n${TOOL_PGO_OUT}")
+    endif()
+    set(${l_result} ${CMAKE_MATCH_1} PARENT_SCOPE)
+endfunction()
+
+file(REMOVE_RECURSE ${l_profile_dir})
+file(MAKE_DIRECTORY ${l_profile_dir})
+
+# 1. Reference build.
+message(STATUS "ToolPgo: reference build")
+tool_pgo_run("configure base" ${CMAKE_COMMAND} -S ${TOOL_SRC_DIR} -B ${TOOL_WORK_DIR}/base ${l_common} -DTOOL_PGO=OFF)
+tool_pgo_run("build base" ${CMAKE_COMMAND} --build ${TOOL_WORK_DIR}/base --target tool_bench)
+tool_pgo_measure(${TOOL_WORK_DIR}/base/tool_bench l_base_ns)
+
+# 2. Instrumented build and training run.
+message(STATUS "ToolPgo: instrumented build + training run")
+tool_pgo_run("configure generate" ${CMAKE_COMMAND} -S ${TOOL_SRC_DIR} -B ${TOOL_WORK_DIR}/pgo ${l_common} -DTOOL_PGO=GENERATE -DTOOL_PGO_DIR=${l_profile_dir})
+tool_pgo_run("build generate" ${CMAKE_COMMAND} --build ${TOOL_WORK_DIR}/pgo --target tool_bench)
+tool_pgo_run("training run" ${TOOL_WORK_DIR}/pgo/tool_bench -n ${TOOL_PGO_ITER} workload)
+
+# Clang writes raw profiles that must be merged first.
+file(GLOB l_raw ${l_profile_dir}/*.profraw)
+if(l_raw)
+    find_program(l_profdata NAMES llvm-profdata)
+    if(NOT l_profdata)
+        message(FATAL_ERROR "ToolPgo: llvm-profdata is needed to merge Clang profiles")
+    endif()
+    tool_pgo_run("profile merge" ${l_profdata} merge -output=${l_profile_dir}/tool.profdata ${l_raw})
+endif()
+
+# 3. Optimized rebuild in the same tree.
+message(STATUS "ToolPgo: profile-optimized build")
+tool_pgo_run("configure use" ${CMAKE_COMMAND} -S ${TOOL_SRC_DIR} -B ${TOOL_WORK_DIR}/pgo -DTOOL_PGO=USE)
+tool_pgo_run("build use" ${CMAKE_COMMAND} --build ${TOOL_WORK_DIR}/pgo --target tool_bench)
+tool_pgo_measure(${TOOL_WORK_DIR}/pgo/tool_bench l_pgo_ns)
+
+tool_pgo_run("copy artifact" ${CMAKE_COMMAND} -E copy ${TOOL_WORK_DIR}/pgo/libnew.a ${TOOL_WORK_DIR}/libnew_pgo.a)
+
+# The benchmark prints three decimals: drop the point to get integer ps.
+string(REPLACE "." "" l_base_ps ${l_base_ns})
+string(REPLACE "." "" l_pgo_ps ${l_pgo_ns})
+math(EXPR l_ratio "(${l_base_ps} * 1000) / ${l_pgo_ps}")
+math(EXPR l_ratio_int "${l_ratio} / 1000")
+math(EXPR l_ratio_frac "${l_ratio} % 1000")
+string(LENGTH "${l_ratio_frac}" l_len)
+while(l_len LESS 3)
+    string(PREPEND l_ratio_frac "0")
+    string(LENGTH "${l_ratio_frac}" l_len)
+endwhile()
+message(STATUS "ToolPgo: workload reference ${l_base_ns} ns/iter, PGO ${l_pgo_ns} ns/iter, speedup ${l_ratio_int}.${l_ratio_frac}x")
+message(STATUS "ToolPgo: artifact ${TOOL_WORK_DIR}/libnew_pgo.a (profile in ${l_profile_dir})")
@@ -9,169 +9,661 @@
  */
 
 #include "Tool.h"
+#include "Tool_Fast.h"
+#include "Tool_Inline.h"
+#include "Tool_Sum.h"
+#include "Tool_Trc.h"
 #include <stddef.h>
+#include <string.h>
 
 /*==================[local macros]===========================================*/
 
-#define TOOL_CRC_INIT_U32 (0xFFFFFFFFUL)
-#define TOOL_CRC_POLY_U32 (0xEDB88320UL)
+/* The library always provides the out-of-line definitions. */
+#if defined(TOOL_CFG_INLINE_HOT)
+#undef Tool_Push_u8
+#undef Tool_Pop_u8
+#undef Tool_GetSnapshot_u8
+#undef Tool_GetStatus_u32
+#undef Tool_ComputeCrc_u32
+#undef Tool_CopyCrc_u32
+#endif
+
+/*==================[external data]==========================================*/
+
+/* Module state: external linkage only for the inline fast path, so the
+ * names carry the module prefix (declared in Tool_Fast.h only). */
+uint8_t Tool_Buffer_u8[TOOL_BUFFER_SIZE_U32];
+uint32_t Tool_Head_u32;
+uint32_t Tool_Tail_u32;
+uint32_t Tool_Count_u32;
+
+uint32_t Tool_StatusFlg_u32;
+Tool_mode_e Tool_Mode_e;
+
+#if(TOOL_CFG_CONCURRENCY == TOOL_CFG_CONC_SPSC)
+/* Sequence counter guarding the bookkeeping above (single writer). */
+volatile uint32_t Tool_Seq_u32;
+#endif
+
+#if(TOOL_CFG_SHADOW != 0U)
+/* Running CRC of the buffer image and its per-position multipliers. */
+uint32_t Tool_ShadowCrc_u32;
+uint32_t Tool_ShadowPow_u32[TOOL_BUFFER_SIZE_U32];
+/* CRC terms of the bytes already swept by Tool_RunTstStep_u8(). */
+uint32_t Tool_TstCrc_u32;
+#endif
+
+/* Sliced self-test sweep (Tool_RunTstStep_u8): next byte (read by Tool_ShadowUpd). */
+uint32_t Tool_TstCursor_u32;
+
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+bool Tool_BlockSealed_b[TOOL_CRC_BLOCKS_U32];
+#endif
 
 /*==================[local data]=============================================*/
 
-/* File-static variables: no prefix and PascalCasing (per naming convention). */
-static uint8_t Buffer_u8[TOOL_BUFFER_SIZE_U32];
-static uint32_t Head_u32;
-static uint32_t Tail_u32;
-static uint32_t Count_u32;
+/* Sliced self-test sweep (Tool_RunTstStep_u8): partial sum. */
+static uint32_t TstSum_u32;
+
+#if(TOOL_CFG_PROC_CRC != 0U)
+/* Raw CRC register of the bytes emitted by Tool_Process(). */
+static uint32_t ProcCrc_u32 = TOOL_CRC_INIT_U32;
+#endif
+
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+/* Per sealed block: CRC and offset of the first byte it covers. */
+static uint32_t BlockCrc_u32[TOOL_CRC_BLOCKS_U32];
+static uint32_t BlockFrom_u32[TOOL_CRC_BLOCKS_U32];
+#endif
+
+#if(TOOL_CFG_CRC_ENGINE == TOOL_CFG_CRC_TABLE)
+/* CRC-32 (poly 0xEDB88320, LSB-first) remainder of each byte value. */
+const uint32_t Tool_CrcTbl_u32[256] = {
+  0x00000000UL, 0x77073096UL, 0xEE0E612CUL, 0x990951BAUL, 0x076DC419UL, 0x706AF48FUL,
+  0xE963A535UL, 0x9E6495A3UL, 0x0EDB8832UL, 0x79DCB8A4UL, 0xE0D5E91EUL, 0x97D2D988UL,
+  0x09B64C2BUL, 0x7EB17CBDUL, 0xE7B82D07UL, 0x90BF1D91UL, 0x1DB71064UL, 0x6AB020F2UL,
+  0xF3B97148UL, 0x84BE41DEUL, 0x1ADAD47DUL, 0x6DDDE4EBUL, 0xF4D4B551UL, 0x83D385C7UL,
+  0x136C9856UL, 0x646BA8C0UL, 0xFD62F97AUL, 0x8A65C9ECUL, 0x14015C4FUL, 0x63066CD9UL,
+  0xFA0F3D63UL, 0x8D080DF5UL, 0x3B6E20C8UL, 0x4C69105EUL, 0xD56041E4UL, 0xA2677172UL,
+  0x3C03E4D1UL, 0x4B04D447UL, 0xD20D85FDUL, 0xA50AB56BUL, 0x35B5A8FAUL, 0x42B2986CUL,
+  0xDBBBC9D6UL, 0xACBCF940UL, 0x32D86CE3UL, 0x45DF5C75UL, 0xDCD60DCFUL, 0xABD13D59UL,
+  0x26D930ACUL, 0x51DE003AUL, 0xC8D75180UL, 0xBFD06116UL, 0x21B4F4B5UL, 0x56B3C423UL,
+  0xCFBA9599UL, 0xB8BDA50FUL, 0x2802B89EUL, 0x5F058808UL, 0xC60CD9B2UL, 0xB10BE924UL,
+  0x2F6F7C87UL, 0x58684C11UL, 0xC1611DABUL, 0xB6662D3DUL, 0x76DC4190UL, 0x01DB7106UL,
+  0x98D220BCUL, 0xEFD5102AUL, 0x71B18589UL, 0x06B6B51FUL, 0x9FBFE4A5UL, 0xE8B8D433UL,
+  0x7807C9A2UL, 0x0F00F934UL, 0x9609A88EUL, 0xE10E9818UL, 0x7F6A0DBBUL, 0x086D3D2DUL,
+  0x91646C97UL, 0xE6635C01UL, 0x6B6B51F4UL, 0x1C6C6162UL, 0x856530D8UL, 0xF262004EUL,
+  0x6C0695EDUL, 0x1B01A57BUL, 0x8208F4C1UL, 0xF50FC457UL, 0x65B0D9C6UL, 0x12B7E950UL,
+  0x8BBEB8EAUL, 0xFCB9887CUL, 0x62DD1DDFUL, 0x15DA2D49UL, 0x8CD37CF3UL, 0xFBD44C65UL,
+  0x4DB26158UL, 0x3AB551CEUL, 0xA3BC0074UL, 0xD4BB30E2UL, 0x4ADFA541UL, 0x3DD895D7UL,
+  0xA4D1C46DUL, 0xD3D6F4FBUL, 0x4369E96AUL, 0x346ED9FCUL, 0xAD678846UL, 0xDA60B8D0UL,
+  0x44042D73UL, 0x33031DE5UL, 0xAA0A4C5FUL, 0xDD0D7CC9UL, 0x5005713CUL, 0x270241AAUL,
+  0xBE0B1010UL, 0xC90C2086UL, 0x5768B525UL, 0x206F85B3UL, 0xB966D409UL, 0xCE61E49FUL,
+  0x5EDEF90EUL, 0x29D9C998UL, 0xB0D09822UL, 0xC7D7A8B4UL, 0x59B33D17UL, 0x2EB40D81UL,
+  0xB7BD5C3BUL, 0xC0BA6CADUL, 0xEDB88320UL, 0x9ABFB3B6UL, 0x03B6E20CUL, 0x74B1D29AUL,
+  0xEAD54739UL, 0x9DD277AFUL, 0x04DB2615UL, 0x73DC1683UL, 0xE3630B12UL, 0x94643B84UL,
+  0x0D6D6A3EUL, 0x7A6A5AA8UL, 0xE40ECF0BUL, 0x9309FF9DUL, 0x0A00AE27UL, 0x7D079EB1UL,
+  0xF00F9344UL, 0x8708A3D2UL, 0x1E01F268UL, 0x6906C2FEUL, 0xF762575DUL, 0x806567CBUL,
+  0x196C3671UL, 0x6E6B06E7UL, 0xFED41B76UL, 0x89D32BE0UL, 0x10DA7A5AUL, 0x67DD4ACCUL,
+  0xF9B9DF6FUL, 0x8EBEEFF9UL, 0x17B7BE43UL, 0x60B08ED5UL, 0xD6D6A3E8UL, 0xA1D1937EUL,
+  0x38D8C2C4UL, 0x4FDFF252UL, 0xD1BB67F1UL, 0xA6BC5767UL, 0x3FB506DDUL, 0x48B2364BUL,
+  0xD80D2BDAUL, 0xAF0A1B4CUL, 0x36034AF6UL, 0x41047A60UL, 0xDF60EFC3UL, 0xA867DF55UL,
+  0x316E8EEFUL, 0x4669BE79UL, 0xCB61B38CUL, 0xBC66831AUL, 0x256FD2A0UL, 0x5268E236UL,
+  0xCC0C7795UL, 0xBB0B4703UL, 0x220216B9UL, 0x5505262FUL, 0xC5BA3BBEUL, 0xB2BD0B28UL,
+  0x2BB45A92UL, 0x5CB36A04UL, 0xC2D7FFA7UL, 0xB5D0CF31UL, 0x2CD99E8BUL, 0x5BDEAE1DUL,
+  0x9B64C2B0UL, 0xEC63F226UL, 0x756AA39CUL, 0x026D930AUL, 0x9C0906A9UL, 0xEB0E363FUL,
+  0x72076785UL, 0x05005713UL, 0x95BF4A82UL, 0xE2B87A14UL, 0x7BB12BAEUL, 0x0CB61B38UL,
+  0x92D28E9BUL, 0xE5D5BE0DUL, 0x7CDCEFB7UL, 0x0BDBDF21UL, 0x86D3D2D4UL, 0xF1D4E242UL,
+  0x68DDB3F8UL, 0x1FDA836EUL, 0x81BE16CDUL, 0xF6B9265BUL, 0x6FB077E1UL, 0x18B74777UL,
+  0x88085AE6UL, 0xFF0F6A70UL, 0x66063BCAUL, 0x11010B5CUL, 0x8F659EFFUL, 0xF862AE69UL,
+  0x616BFFD3UL, 0x166CCF45UL, 0xA00AE278UL, 0xD70DD2EEUL, 0x4E048354UL, 0x3903B3C2UL,
+  0xA7672661UL, 0xD06016F7UL, 0x4969474DUL, 0x3E6E77DBUL, 0xAED16A4AUL, 0xD9D65ADCUL,
+  0x40DF0B66UL, 0x37D83BF0UL, 0xA9BCAE53UL, 0xDEBB9EC5UL, 0x47B2CF7FUL, 0x30B5FFE9UL,
+  0xBDBDF21CUL, 0xCABAC28AUL, 0x53B39330UL, 0x24B4A3A6UL, 0xBAD03605UL, 0xCDD70693UL,
+  0x54DE5729UL, 0x23D967BFUL, 0xB3667A2EUL, 0xC4614AB8UL, 0x5D681B02UL, 0x2A6F2B94UL,
+  0xB40BBE37UL, 0xC30C8EA1UL, 0x5A05DF1BUL, 0x2D02EF8DUL
+};
+#endif
+
+/*==================[local functions]========================================*/
+
+#if(TOOL_CFG_SHADOW != 0U)
+/* Multiply a reflected CRC-32 polynomial by x^n modulo P. */
+static uint32_t Tool_ShadowMulX_u32(uint32_t val_u32, uint32_t n_u32) {
+  uint32_t l_val_u32 = val_u32;
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < n_u32; l_i_u32++) {
+    l_val_u32 = ((l_val_u32 & 1U) != 0U) ? ((l_val_u32 >> 1U) ^ TOOL_CRC_POLY_U32) : (l_val_u32 >> 1U);
+  }
+
+  return l_val_u32;
+}
+
+/* Multipliers of Tool_ShadowUpd(); the image is all zeros, so is its CRC. */
+static void Tool_ShadowInit(void) {
+  uint32_t l_pow_u32 = Tool_ShadowMulX_u32(0x80000000UL, 32U); /* x^32 */
+
+  for(uint32_t l_i_u32 = TOOL_BUFFER_SIZE_U32; l_i_u32 > 0U; l_i_u32--) {
+    Tool_ShadowPow_u32[l_i_u32 - 1U] = l_pow_u32;
+    l_pow_u32 = Tool_ShadowMulX_u32(l_pow_u32, 8U);
+  }
+  Tool_ShadowCrc_u32 = 0U;
+}
+#endif
+
+/* Next Tool_RunTstStep_u8() starts a new sweep. */
+static void Tool_TstRestart(void) {
+  Tool_TstCursor_u32 = 0U;
+  TstSum_u32 = 0U;
+#if(TOOL_CFG_SHADOW != 0U)
+  Tool_TstCrc_u32 = 0U;
+#endif
+}
+
+#if(TOOL_CFG_SHADOW != 0U) && (TOOL_CFG_CRC_BLOCK_U32 != 0U)
+/* Recompute the shadow CRC from the image. Needed after corrupted bytes were
+ * dropped: they no longer hold the values the shadow had folded in, so an
+ * incremental update would keep it out of step. Restarts a sliced sweep. */
+static void Tool_ShadowRebuild(void) {
+  Tool_ShadowCrc_u32 = Tool_CrcUpdInl_u32(0U, Tool_Buffer_u8, TOOL_BUFFER_SIZE_U32);
+  Tool_TstRestart();
+}
+#endif
+
+#if(TOOL_CFG_PROC_CRC != 0U)
+/* Fold one byte emitted by Tool_Process() into ProcCrc_u32. */
+static inline void Tool_ProcCrcUpd(uint8_t val_u8) {
+  ProcCrc_u32 = Tool_CrcUpdInl_u32(ProcCrc_u32, &val_u8, 1U);
+}
+#endif
+
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+static void Tool_BlockReset(void) {
+  for(uint32_t l_b_u32 = 0U; l_b_u32 < TOOL_CRC_BLOCKS_U32; l_b_u32++) {
+    Tool_BlockSealed_b[l_b_u32] = false;
+  }
+}
+#endif
+
+/* Longest contiguous run of at most want_u32 bytes from index_u32: up to the
+ * end of Tool_Buffer_u8 or, with block CRCs, of the block (blocks divide it). */
+static uint32_t Tool_RunLen_u32(uint32_t index_u32, uint32_t want_u32) {
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+  uint32_t l_run_u32 = TOOL_CFG_CRC_BLOCK_U32 - (index_u32 % TOOL_CFG_CRC_BLOCK_U32);
+#else
+  uint32_t l_run_u32 = TOOL_BUFFER_SIZE_U32 - index_u32;
+#endif
+
+  return (want_u32 < l_run_u32) ? want_u32 : l_run_u32;
+}
+
+/* Fused copy of one run of a block; only the first *crcLeft_pu32 bytes still
+ * feed the CRC (cap of Tool_ComputeCrc_u32()). */
+static uint32_t Tool_CopyRun_u32(uint32_t crc_u32, uint8_t *dst_pu8, const uint8_t *src_pcu8, uint32_t run_u32, uint32_t *crcLeft_pu32) {
+  uint32_t l_n_u32 = (run_u32 < *crcLeft_pu32) ? run_u32 : *crcLeft_pu32;
+  uint32_t l_crc_u32 = Tool_CopyCrcUpdInl_u32(crc_u32, dst_pu8, src_pcu8, l_n_u32);
+
+  (void)memcpy(&dst_pu8[l_n_u32], &src_pcu8[l_n_u32], run_u32 - l_n_u32);
+  *crcLeft_pu32 -= l_n_u32;
+
+  return l_crc_u32;
+}
+
+/* CRC of queued bytes [offset_u32, offset_u32 + length_u32) counted from
+ * Tool_Tail_u32, read in place: at most two runs, split where Tool_Buffer_u8 wraps. */
+static uint8_t Tool_QueuedCrc_u8(uint32_t offset_u32, uint32_t length_u32, uint32_t *crc_pu32) {
+  uint32_t l_count_u32 = Tool_Count_u32;
+  uint8_t l_ret_u8 = 0U;
+
+  if((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0U) {
+    l_ret_u8 = 2U;
+  } else if((length_u32 > l_count_u32) || (offset_u32 > (l_count_u32 - length_u32))) {
+    l_ret_u8 = 1U;
+  } else {
+    uint32_t l_from_u32 = Tool_Tail_u32 + offset_u32;
+    uint32_t l_len_u32 = (length_u32 > TOOL_MAX_CRC_LEN_U32) ? TOOL_MAX_CRC_LEN_U32 : length_u32;
+    uint32_t l_run_u32;
+    uint32_t l_crc_u32;
+
+    l_from_u32 = (l_from_u32 >= TOOL_BUFFER_SIZE_U32) ? (l_from_u32 - TOOL_BUFFER_SIZE_U32) : l_from_u32;
+    l_run_u32 = ((TOOL_BUFFER_SIZE_U32 - l_from_u32) < l_len_u32) ? (TOOL_BUFFER_SIZE_U32 - l_from_u32) : l_len_u32;
+    l_crc_u32 = Tool_CrcUpdInl_u32((uint32_t)TOOL_CRC_INIT_U32, &Tool_Buffer_u8[l_from_u32], l_run_u32);
+    l_crc_u32 = Tool_CrcUpdInl_u32(l_crc_u32, Tool_Buffer_u8, l_len_u32 - l_run_u32);
+    *crc_pu32 = l_crc_u32 ^ (uint32_t)0xFFFFFFFFUL;
+  }
+
+  return l_ret_u8;
+}
+
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+/* Seal block b_u32 over its bytes from offset from_u32 to its end. */
+static void Tool_BlockSealAt(uint32_t b_u32, uint32_t from_u32) {
+  uint32_t l_start_u32 = b_u32 * TOOL_CFG_CRC_BLOCK_U32;
+
+  BlockFrom_u32[b_u32] = from_u32;
+  BlockCrc_u32[b_u32] = Tool_ComputeCrcInl_u32(&Tool_Buffer_u8[l_start_u32 + from_u32], TOOL_CFG_CRC_BLOCK_U32 - from_u32);
+  Tool_BlockSealed_b[b_u32] = true;
+}
+
+/* First corrupted sealed block met within the next length_u32 queued bytes:
+ * *prefix_pu32 intact queued bytes lie before it, *bad_pu32 bytes are covered
+ * by it (up to the end of the block). Returns false if there is none. */
+static bool Tool_BlockScan_b(uint32_t length_u32, uint32_t *prefix_pu32, uint32_t *bad_pu32) {
+  uint32_t l_idx_u32 = Tool_Tail_u32;
+  uint32_t l_done_u32 = 0U;
+  bool l_bad_b = false;
+
+  while((l_done_u32 < length_u32) && !l_bad_b) {
+    uint32_t l_b_u32 = l_idx_u32 / TOOL_CFG_CRC_BLOCK_U32;
+    uint32_t l_start_u32 = l_b_u32 * TOOL_CFG_CRC_BLOCK_U32;
+    uint32_t l_from_u32 = BlockFrom_u32[l_b_u32];
+
+    if(Tool_BlockSealed_b[l_b_u32] && (Tool_ComputeCrcInl_u32(&Tool_Buffer_u8[l_start_u32 + l_from_u32], TOOL_CFG_CRC_BLOCK_U32 - l_from_u32) != BlockCrc_u32[l_b_u32])) {
+      /* A sealed block holds Tool_Tail_u32 at l_from_u32 or lies wholly after it. */
+      *prefix_pu32 = l_done_u32 + ((l_start_u32 + l_from_u32) - l_idx_u32);
+      *bad_pu32 = TOOL_CFG_CRC_BLOCK_U32 - l_from_u32;
+      l_bad_b = true;
+    }
+    l_done_u32 += TOOL_CFG_CRC_BLOCK_U32 - (l_idx_u32 - l_start_u32);
+    l_idx_u32 = (l_start_u32 + TOOL_CFG_CRC_BLOCK_U32) % TOOL_BUFFER_SIZE_U32;
+  }
+
+  return l_bad_b;
+}
+
+/* Drop the bad_u32 queued bytes that follow the prefix_u32 oldest ones
+ * (inside the writer's sequence bracket). The prefix moves up to close the
+ * gap, so it stays queued in order, and the blocks it now fills are resealed
+ * over it. The gap ends on a block boundary, so every block is whole again.
+ * The shadow CRC is rebuilt afterwards (see Tool_ShadowRebuild()). */
+static void Tool_BlockDrop(uint32_t prefix_u32, uint32_t bad_u32) {
+  uint32_t l_idx_u32;
+  uint32_t l_left_u32;
+
+  /* Last byte first: source and destination may overlap. */
+  for(uint32_t l_i_u32 = prefix_u32; l_i_u32 > 0U; l_i_u32--) {
+    uint32_t l_src_u32 = (Tool_Tail_u32 + l_i_u32 - 1U) % TOOL_BUFFER_SIZE_U32;
+
+    Tool_Buffer_u8[(l_src_u32 + bad_u32) % TOOL_BUFFER_SIZE_U32] = Tool_Buffer_u8[l_src_u32];
+  }
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < bad_u32; l_i_u32++) {
+    Tool_BlockSealed_b[Tool_Tail_u32 / TOOL_CFG_CRC_BLOCK_U32] = false;
+    Tool_Buffer_u8[Tool_Tail_u32] = 0U;
+    Tool_Tail_u32 = (Tool_Tail_u32 + 1U) % TOOL_BUFFER_SIZE_U32;
+  }
+  Tool_Count_u32 -= bad_u32;
+
+  l_idx_u32 = Tool_Tail_u32;
+  l_left_u32 = prefix_u32;
+  while(l_left_u32 != 0U) {
+    uint32_t l_from_u32 = l_idx_u32 % TOOL_CFG_CRC_BLOCK_U32;
 
-static uint32_t StatusFlg_u32;
-static Tool_mode_e Mode_e;
+    Tool_BlockSealAt(l_idx_u32 / TOOL_CFG_CRC_BLOCK_U32, l_from_u32);
+    l_left_u32 -= TOOL_CFG_CRC_BLOCK_U32 - l_from_u32;
+    l_idx_u32 = ((l_idx_u32 - l_from_u32) + TOOL_CFG_CRC_BLOCK_U32) % TOOL_BUFFER_SIZE_U32;
+  }
+#if(TOOL_CFG_SHADOW != 0U)
+  Tool_ShadowRebuild();
+#endif
+}
+#endif
 
 /*==================[global functions]=======================================*/
 
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+void Tool_BlockSeal(void) {
+  uint32_t l_b_u32 = (((Tool_Head_u32 + TOOL_BUFFER_SIZE_U32) - 1U) % TOOL_BUFFER_SIZE_U32) / TOOL_CFG_CRC_BLOCK_U32;
+  uint32_t l_start_u32 = l_b_u32 * TOOL_CFG_CRC_BLOCK_U32;
+  uint32_t l_from_u32 = 0U;
+
+  /* Bytes of the block before Tool_Tail_u32 are already consumed (or stale). */
+  if((Tool_Tail_u32 - l_start_u32) < TOOL_CFG_CRC_BLOCK_U32) {
+    l_from_u32 = Tool_Tail_u32 - l_start_u32;
+  }
+  Tool_BlockSealAt(l_b_u32, l_from_u32);
+}
+
+uint8_t Tool_BlockVerify_u8(void) {
+  uint32_t l_b_u32 = Tool_Tail_u32 / TOOL_CFG_CRC_BLOCK_U32;
+  uint32_t l_start_u32 = l_b_u32 * TOOL_CFG_CRC_BLOCK_U32;
+  uint32_t l_from_u32 = BlockFrom_u32[l_b_u32];
+  uint8_t l_ret_u8 = 0U;
+
+  TOOL_SEQ_WRITE_BEGIN();
+
+  Tool_BlockSealed_b[l_b_u32] = false;
+  if(Tool_ComputeCrcInl_u32(&Tool_Buffer_u8[l_start_u32 + l_from_u32], TOOL_CFG_CRC_BLOCK_U32 - l_from_u32) != BlockCrc_u32[l_b_u32]) {
+    /* Nothing was read since sealing: Tool_Tail_u32 is still at l_from_u32. */
+    for(uint32_t l_i_u32 = l_start_u32 + l_from_u32; l_i_u32 < (l_start_u32 + TOOL_CFG_CRC_BLOCK_U32); l_i_u32++) {
+      Tool_Buffer_u8[l_i_u32] = 0U;
+    }
+#if(TOOL_CFG_SHADOW != 0U)
+    Tool_ShadowRebuild();
+#endif
+    Tool_Tail_u32 = (l_start_u32 + TOOL_CFG_CRC_BLOCK_U32) % TOOL_BUFFER_SIZE_U32;
+    Tool_Count_u32 -= TOOL_CFG_CRC_BLOCK_U32 - l_from_u32;
+    Tool_StatusFlg_u32 |= TOOL_STATUS_CRC_U32;
+    l_ret_u8 = 4U;
+  }
+
+  TOOL_SEQ_WRITE_END();
+
+  return l_ret_u8;
+}
+#endif
+
+/* Error and recovery paths of Tool_Push_u8(), kept out of the hot path. */
+TOOL_COLD uint8_t Tool_PushSlow_u8(uint8_t value_u8) {
+  uint8_t l_ret_u8 = 0U;
+
+  TOOL_SEQ_WRITE_BEGIN();
+
+  /* Check initialization. */
+  if((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0U) {
+    Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+    l_ret_u8 = 2U;
+  } else if(Tool_Count_u32 >= TOOL_BUFFER_SIZE_U32) {
+    /* Overflow condition. */
+    Tool_StatusFlg_u32 |= TOOL_STATUS_OVF_U32;
+    l_ret_u8 = 1U;
+  } else {
+    /* Space again after an overflow: store and clear the flag. */
+#if(TOOL_CFG_SHADOW != 0U)
+    Tool_ShadowUpd(Tool_Head_u32, (uint8_t)(Tool_Buffer_u8[Tool_Head_u32] ^ value_u8));
+#endif
+    Tool_Buffer_u8[Tool_Head_u32] = value_u8;
+    Tool_Head_u32 = (Tool_Head_u32 + 1U) % TOOL_BUFFER_SIZE_U32;
+    Tool_Count_u32++;
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+    if((Tool_Head_u32 % TOOL_CFG_CRC_BLOCK_U32) == 0U) {
+      Tool_BlockSeal();
+    }
+#endif
+
+    Tool_StatusFlg_u32 &= ~TOOL_STATUS_OVF_U32;
+    l_ret_u8 = 0U;
+  }
+
+  TOOL_SEQ_WRITE_END();
+
+  return l_ret_u8;
+}
+
+/* Error paths of Tool_Pop_u8(), kept out of the hot path. */
+TOOL_COLD uint8_t Tool_PopSlow_u8(uint8_t *value_pu8) {
+  uint8_t l_ret_u8 = 0U;
+
+  TOOL_SEQ_WRITE_BEGIN();
+
+  /* Validate output pointer. */
+  if(value_pu8 == NULL) {
+    Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+    l_ret_u8 = 3U;
+  } else if((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0U) {
+    Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+    *value_pu8 = 0U;
+    l_ret_u8 = 2U;
+  } else {
+    /* Underflow condition. */
+    *value_pu8 = 0U;
+    l_ret_u8 = 1U;
+  }
+
+  TOOL_SEQ_WRITE_END();
+
+  return l_ret_u8;
+}
+
 void Tool_Init(void) {
   uint32_t l_i_u32 = 0U;
 
+  TOOL_SEQ_WRITE_BEGIN();
+
   /* Reset indices and counters. */
-  Head_u32 = 0U;
-  Tail_u32 = 0U;
-  Count_u32 = 0U;
+  Tool_Head_u32 = 0U;
+  Tool_Tail_u32 = 0U;
+  Tool_Count_u32 = 0U;
 
   /* Clear buffer content (bounded loop). */
   for(l_i_u32 = 0U; l_i_u32 < TOOL_BUFFER_SIZE_U32; l_i_u32++) {
-    Buffer_u8[l_i_u32] = 0U;
+    Tool_Buffer_u8[l_i_u32] = 0U;
   }
 
+#if(TOOL_CFG_SHADOW != 0U)
+  Tool_ShadowInit();
+#endif
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+  Tool_BlockReset();
+#endif
+
   /* Initialize status and mode. */
-  Mode_e = Tool_modeIdle_e;
-  StatusFlg_u32 = 0U;
-  StatusFlg_u32 |= TOOL_STATUS_INIT_U32;
+  Tool_Mode_e = Tool_modeIdle_e;
+  Tool_StatusFlg_u32 = 0U;
+  Tool_StatusFlg_u32 |= TOOL_STATUS_INIT_U32;
+
+  TOOL_SEQ_WRITE_END();
+
+  Tool_TstRestart();
+#if(TOOL_CFG_PROC_CRC != 0U)
+  ProcCrc_u32 = TOOL_CRC_INIT_U32;
+#endif
+
+  TOOL_TRC(Tool_trcOpInit_e, 0U, Tool_Count_u32);
 }
 
 void Tool_DeInit(void) {
   uint32_t l_i_u32 = 0U;
 
+  TOOL_SEQ_WRITE_BEGIN();
+
   /* Bring module to a safe and deterministic state. */
-  Mode_e = Tool_modeIdle_e;
-  StatusFlg_u32 = 0U;
+  Tool_Mode_e = Tool_modeIdle_e;
+  Tool_StatusFlg_u32 = 0U;
 
   /* Reset ring buffer bookkeeping. */
-  Head_u32 = 0U;
-  Tail_u32 = 0U;
-  Count_u32 = 0U;
+  Tool_Head_u32 = 0U;
+  Tool_Tail_u32 = 0U;
+  Tool_Count_u32 = 0U;
 
   /* Clear buffer content (bounded loop). */
   for(l_i_u32 = 0U; l_i_u32 < TOOL_BUFFER_SIZE_U32; l_i_u32++) {
-    Buffer_u8[l_i_u32] = 0U;
+    Tool_Buffer_u8[l_i_u32] = 0U;
   }
+#if(TOOL_CFG_SHADOW != 0U)
+  Tool_ShadowCrc_u32 = 0U;
+#endif
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+  Tool_BlockReset();
+#endif
+
+  TOOL_SEQ_WRITE_END();
+
+  Tool_TstRestart();
+#if(TOOL_CFG_PROC_CRC != 0U)
+  ProcCrc_u32 = TOOL_CRC_INIT_U32;
+#endif
+
+  TOOL_TRC(Tool_trcOpDeInit_e, 0U, Tool_Count_u32);
 }
 
 uint8_t Tool_SetMode_u8(Tool_mode_e mode) {
   uint8_t l_ret_u8 = 0U;
 
+  TOOL_SEQ_WRITE_BEGIN();
+
   /* Reject mode changes if not initialized. */
-  if((StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0U) {
-    StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+  if((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0U) {
+    Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
     l_ret_u8 = 1U;
   } else if((mode != Tool_modeIdle_e) && (mode != Tool_modeRun_e) && (mode != Tool_modeDiag_e)) {
     /* Invalid mode request. */
-    StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+    Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
     l_ret_u8 = 2U;
   } else {
     /* Accept the new mode. */
-    Mode_e = mode;
-    StatusFlg_u32 &= ~TOOL_STATUS_ERR_U32;
+    Tool_Mode_e = mode;
+    Tool_StatusFlg_u32 &= ~TOOL_STATUS_ERR_U32;
     l_ret_u8 = 0U;
   }
 
+  TOOL_SEQ_WRITE_END();
+
+  TOOL_TRC(Tool_trcOpSetMode_e, l_ret_u8, Tool_Count_u32);
+
   return l_ret_u8;
 }
 
-uint32_t Tool_GetStatus_u32(void) {
-  uint32_t l_status_u32;
+uint32_t Tool_GetStatus_u32(void) { return Tool_GetStatusInl_u32(); }
 
-  l_status_u32 = StatusFlg_u32;
-  l_status_u32 &= ~0x3UL;                         /* Clear bits [1:0] */
-  l_status_u32 |= ((uint32_t)Mode_e & 0x3UL);     /* Set bits [1:0] to Mode_e */
-  l_status_u32 &= 0x0000FFFFUL;                   /* Keep lower 16 bits */
-  l_status_u32 |= ((Count_u32 & 0xFFFFUL) << 16); /* Set bits [31:16] to Count_u32 lower 16 bits */
+uint8_t Tool_GetSnapshot_u8(Tool_snapshot_t *snapshot_ps) { return Tool_GetSnapshotInl_u8(snapshot_ps); }
 
-  return l_status_u32;
-}
-uint32_t Tool_ComputeCrc_u32(const uint8_t *data_pcu8, uint32_t length_u32) {
+uint32_t Tool_ComputeCrc_u32(const uint8_t *data_pcu8, uint32_t length_u32) { return Tool_ComputeCrcInl_u32(data_pcu8, length_u32); }
+
+uint32_t Tool_CopyCrc_u32(uint8_t *dst_pu8, const uint8_t *src_pcu8, uint32_t length_u32) { return Tool_CopyCrcInl_u32(dst_pu8, src_pcu8, length_u32); }
+
+uint8_t Tool_Push_u8(uint8_t value_u8) { return Tool_PushInl_u8(value_u8); }
+
+uint8_t Tool_Pop_u8(uint8_t *value_pu8) { return Tool_PopInl_u8(value_pu8); }
+
+uint8_t Tool_PushBlock_u8(const uint8_t *src_pcu8, uint32_t length_u32, uint32_t *crc_pu32) {
   uint32_t l_crc_u32 = (uint32_t)TOOL_CRC_INIT_U32;
+  uint8_t l_ret_u8 = 0U;
 
-  /* Defensive: null pointer or zero length -> return init CRC. */
-  if((data_pcu8 == NULL) || (length_u32 == 0U)) {
-    l_crc_u32 = (uint32_t)TOOL_CRC_INIT_U32;
+  TOOL_SEQ_WRITE_BEGIN();
+
+  if((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0U) {
+    Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+    l_ret_u8 = 2U;
+  } else if((src_pcu8 == NULL) && (length_u32 != 0U)) {
+    Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+    l_ret_u8 = 3U;
+  } else if(length_u32 > (TOOL_BUFFER_SIZE_U32 - Tool_Count_u32)) {
+    /* All or nothing: a partial frame is of no use to the reader. */
+    Tool_StatusFlg_u32 |= TOOL_STATUS_OVF_U32;
+    l_ret_u8 = 1U;
   } else {
-    /* Bounded iteration: cap to TOOL_MAX_CRC_LEN_U32. */
-    uint32_t l_len_u32 = (length_u32 > TOOL_MAX_CRC_LEN_U32) ? TOOL_MAX_CRC_LEN_U32 : length_u32;
+    uint32_t l_crcLeft_u32 = TOOL_MAX_CRC_LEN_U32;
+    uint32_t l_done_u32 = 0U;
 
-    for(uint32_t l_i_u32 = 0U; l_i_u32 < l_len_u32; l_i_u32++) {
-      uint32_t l_bit_u32 = 0U;
+    while(l_done_u32 < length_u32) {
+      uint32_t l_run_u32 = Tool_RunLen_u32(Tool_Head_u32, length_u32 - l_done_u32);
 
-      l_crc_u32 ^= (uint32_t)data_pcu8[l_i_u32];
-      for(l_bit_u32 = 0U; l_bit_u32 < 8U; l_bit_u32++) {
-        l_crc_u32 = (uint32_t)(((l_crc_u32 & 1U) != 0U) ? ((l_crc_u32 >> 1U) ^ TOOL_CRC_POLY_U32) : (l_crc_u32 >> 1U));
+#if(TOOL_CFG_SHADOW != 0U)
+      for(uint32_t l_i_u32 = 0U; l_i_u32 < l_run_u32; l_i_u32++) {
+        Tool_ShadowUpd(Tool_Head_u32 + l_i_u32, (uint8_t)(Tool_Buffer_u8[Tool_Head_u32 + l_i_u32] ^ src_pcu8[l_done_u32 + l_i_u32]));
+      }
+#endif
+      l_crc_u32 = Tool_CopyRun_u32(l_crc_u32, &Tool_Buffer_u8[Tool_Head_u32], &src_pcu8[l_done_u32], l_run_u32, &l_crcLeft_u32);
+      Tool_Head_u32 = (Tool_Head_u32 + l_run_u32) % TOOL_BUFFER_SIZE_U32;
+      Tool_Count_u32 += l_run_u32;
+      l_done_u32 += l_run_u32;
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+      if((Tool_Head_u32 % TOOL_CFG_CRC_BLOCK_U32) == 0U) {
+        Tool_BlockSeal();
       }
+#endif
     }
+
+    Tool_StatusFlg_u32 &= ~TOOL_STATUS_OVF_U32;
   }
 
-  /* Finalize CRC. */
-  l_crc_u32 ^= (uint32_t)0xFFFFFFFFUL;
+  TOOL_SEQ_WRITE_END();
 
-  return l_crc_u32;
+  if(crc_pu32 != NULL) {
+    *crc_pu32 = (l_ret_u8 == 0U) ? (l_crc_u32 ^ (uint32_t)0xFFFFFFFFUL) : 0U;
+  }
+
+  TOOL_TRC(Tool_trcOpPushBlock_e, l_ret_u8, Tool_Count_u32);
+
+  return l_ret_u8;
 }
 
-uint8_t Tool_Push_u8(uint8_t value_u8) {
+uint8_t Tool_PopBlock_u8(uint8_t *dst_pu8, uint32_t length_u32, uint32_t *crc_pu32) {
+  uint32_t l_crc_u32 = (uint32_t)TOOL_CRC_INIT_U32;
   uint8_t l_ret_u8 = 0U;
 
-  /* Check initialization. */
-  if((StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0U) {
-    StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+  TOOL_SEQ_WRITE_BEGIN();
+
+  if((dst_pu8 == NULL) && (length_u32 != 0U)) {
+    Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+    l_ret_u8 = 3U;
+  } else if((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0U) {
+    Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
     l_ret_u8 = 2U;
-  } else if(Count_u32 >= TOOL_BUFFER_SIZE_U32) {
-    /* Overflow condition. */
-    StatusFlg_u32 |= TOOL_STATUS_OVF_U32;
+  } else if(length_u32 > Tool_Count_u32) {
     l_ret_u8 = 1U;
   } else {
-    /* Store into ring buffer and update bookkeeping. */
-    Buffer_u8[Head_u32] = value_u8;
-    Head_u32 = (Head_u32 + 1U) % TOOL_BUFFER_SIZE_U32;
-    Count_u32++;
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+    /* Check every sealed block before the first byte leaves the ring. */
+    uint32_t l_prefix_u32 = 0U;
+    uint32_t l_bad_u32 = 0U;
+
+    if(Tool_BlockScan_b(length_u32, &l_prefix_u32, &l_bad_u32)) {
+      Tool_BlockDrop(l_prefix_u32, l_bad_u32);
+      Tool_StatusFlg_u32 |= TOOL_STATUS_CRC_U32;
+      l_ret_u8 = 4U;
+    }
+#endif
+    if(l_ret_u8 == 0U) {
+      uint32_t l_crcLeft_u32 = TOOL_MAX_CRC_LEN_U32;
+      uint32_t l_done_u32 = 0U;
+
+      while(l_done_u32 < length_u32) {
+        uint32_t l_run_u32 = Tool_RunLen_u32(Tool_Tail_u32, length_u32 - l_done_u32);
+
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+        Tool_BlockSealed_b[Tool_Tail_u32 / TOOL_CFG_CRC_BLOCK_U32] = false;
+#endif
+#if(TOOL_CFG_SHADOW != 0U)
+        for(uint32_t l_i_u32 = 0U; l_i_u32 < l_run_u32; l_i_u32++) {
+          Tool_ShadowUpd(Tool_Tail_u32 + l_i_u32, Tool_Buffer_u8[Tool_Tail_u32 + l_i_u32]);
+        }
+#endif
+        l_crc_u32 = Tool_CopyRun_u32(l_crc_u32, &dst_pu8[l_done_u32], &Tool_Buffer_u8[Tool_Tail_u32], l_run_u32, &l_crcLeft_u32);
+        (void)memset(&Tool_Buffer_u8[Tool_Tail_u32], 0, l_run_u32);
+        Tool_Tail_u32 = (Tool_Tail_u32 + l_run_u32) % TOOL_BUFFER_SIZE_U32;
+        Tool_Count_u32 -= l_run_u32;
+        l_done_u32 += l_run_u32;
+      }
+    }
+  }
 
-    StatusFlg_u32 &= ~TOOL_STATUS_OVF_U32;
-    l_ret_u8 = 0U;
+  TOOL_SEQ_WRITE_END();
+
+  if(crc_pu32 != NULL) {
+    *crc_pu32 = (l_ret_u8 == 0U) ? (l_crc_u32 ^ (uint32_t)0xFFFFFFFFUL) : 0U;
   }
 
+  TOOL_TRC(Tool_trcOpPopBlock_e, l_ret_u8, Tool_Count_u32);
+
   return l_ret_u8;
 }
 
-uint8_t Tool_Pop_u8(uint8_t *value_pu8) {
-  uint8_t l_ret_u8 = 0U;
+uint8_t Tool_CrcOfQueued_u8(uint32_t offset_u32, uint32_t length_u32, uint32_t *crc_pu32) {
+  uint32_t l_crc_u32 = 0U;
+  uint8_t l_ret_u8;
 
-  /* Validate output pointer. */
-  if(value_pu8 == NULL) {
-    StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+  if(crc_pu32 == NULL) {
     l_ret_u8 = 3U;
-  } else if((StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0U) {
-    StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
-    *value_pu8 = 0U;
-    l_ret_u8 = 2U;
-  } else if(Count_u32 == 0U) {
-    /* Underflow condition. */
-    *value_pu8 = 0U;
-    l_ret_u8 = 1U;
   } else {
-    /* Read from ring buffer and update bookkeeping. */
-    *value_pu8 = Buffer_u8[Tail_u32];
-    Buffer_u8[Tail_u32] = 0U;
-
-    Tail_u32 = (Tail_u32 + 1U) % TOOL_BUFFER_SIZE_U32;
-    Count_u32--;
-
-    l_ret_u8 = 0U;
+#if(TOOL_CFG_CONCURRENCY == TOOL_CFG_CONC_SINGLE)
+    l_ret_u8 = Tool_QueuedCrc_u8(offset_u32, length_u32, &l_crc_u32);
+#else
+    /* Read-only: retried like Tool_GetSnapshot_u8() if the writer moved. */
+    l_ret_u8 = 4U;
+    for(uint32_t l_try_u32 = 0U; (l_try_u32 < TOOL_SNAPSHOT_RETRY_U32) && (l_ret_u8 == 4U); l_try_u32++) {
+      uint32_t l_seq0_u32 = Tool_Seq_u32;
+
+      TOOL_FENCE_ACQ();
+      l_ret_u8 = Tool_QueuedCrc_u8(offset_u32, length_u32, &l_crc_u32);
+      TOOL_FENCE_ACQ();
+
+      if(((l_seq0_u32 & 1U) != 0U) || (l_seq0_u32 != Tool_Seq_u32)) {
+        l_ret_u8 = 4U;
+      }
+    }
+#endif
+    *crc_pu32 = (l_ret_u8 == 0U) ? l_crc_u32 : 0U;
   }
 
   return l_ret_u8;
@@ -180,39 +672,121 @@ uint8_t Tool_Pop_u8(uint8_t *value_pu8) {
 void Tool_Clear(void) {
   uint32_t l_index_u32;
 
-  Head_u32 = 0U;
-  Tail_u32 = 0U;
-  Count_u32 = 0U;
+  TOOL_SEQ_WRITE_BEGIN();
+
+  Tool_Head_u32 = 0U;
+  Tool_Tail_u32 = 0U;
+  Tool_Count_u32 = 0U;
 
   for(l_index_u32 = 0U; l_index_u32 < TOOL_BUFFER_SIZE_U32; l_index_u32++) {
-    Buffer_u8[l_index_u32] = 0U;
+    Tool_Buffer_u8[l_index_u32] = 0U;
   }
+#if(TOOL_CFG_SHADOW != 0U)
+  Tool_ShadowCrc_u32 = 0U;
+  Tool_TstCrc_u32 = 0U; /* Swept bytes are all zero now. */
+#endif
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+  Tool_BlockReset();
+#endif
+
+  Tool_StatusFlg_u32 &= ~TOOL_STATUS_ERR_U32;
+  Tool_StatusFlg_u32 &= ~TOOL_STATUS_OVF_U32;
+
+  TOOL_SEQ_WRITE_END();
+
+#if(TOOL_CFG_PROC_CRC != 0U)
+  ProcCrc_u32 = TOOL_CRC_INIT_U32;
+#endif
 
-  StatusFlg_u32 &= ~TOOL_STATUS_ERR_U32;
-  StatusFlg_u32 &= ~TOOL_STATUS_OVF_U32;
+  TOOL_TRC(Tool_trcOpClear_e, 0U, Tool_Count_u32);
 }
 uint8_t Tool_RunTst_u8(void) {
   uint8_t l_ret_u8 = 0U;
 
+  TOOL_SEQ_WRITE_BEGIN();
+
   /* Simple self-test: validate internal invariants and compute a checksum. */
-  if(Count_u32 > TOOL_BUFFER_SIZE_U32) {
-    StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+  if(Tool_Count_u32 > TOOL_BUFFER_SIZE_U32) {
+    Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
     l_ret_u8 = 1U;
   } else {
-    uint32_t l_sum_u32 = 0U;
-    for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BUFFER_SIZE_U32; l_i_u32++) {
-      l_sum_u32 += (uint32_t)Buffer_u8[l_i_u32];
-    }
+    uint32_t l_sum_u32 = Tool_SumBytes_u32(Tool_Buffer_u8, TOOL_BUFFER_SIZE_U32);
 
     /* Mark unexpected condition if checksum is suspiciously large (defensive).
      */
     if(l_sum_u32 > (255UL * TOOL_BUFFER_SIZE_U32)) {
-      StatusFlg_u32 |= TOOL_STATUS_UDF_U32;
+      Tool_StatusFlg_u32 |= TOOL_STATUS_UDF_U32;
       l_ret_u8 = 2U;
     } else {
-      StatusFlg_u32 &= ~TOOL_STATUS_UDF_U32;
+      Tool_StatusFlg_u32 &= ~TOOL_STATUS_UDF_U32;
       l_ret_u8 = 0U;
     }
+
+#if(TOOL_CFG_SHADOW != 0U)
+    /* Integrity: the image must still match the CRC kept by every write. */
+    if((l_ret_u8 == 0U) && (Tool_CrcUpdInl_u32(0U, Tool_Buffer_u8, TOOL_BUFFER_SIZE_U32) != Tool_ShadowCrc_u32)) {
+      Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+      l_ret_u8 = 4U;
+    }
+#endif
+  }
+
+  TOOL_SEQ_WRITE_END();
+
+  TOOL_TRC(Tool_trcOpRunTst_e, l_ret_u8, Tool_Count_u32);
+
+  return l_ret_u8;
+}
+
+uint8_t Tool_RunTstStep_u8(void) {
+  uint8_t l_ret_u8 = 3U;
+
+  TOOL_SEQ_WRITE_BEGIN();
+
+  /* Invariant first, on every slice: a violation aborts the sweep. */
+  if(Tool_Count_u32 > TOOL_BUFFER_SIZE_U32) {
+    Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+    Tool_TstRestart();
+    l_ret_u8 = 1U;
+  } else {
+    uint32_t l_end_u32 = ((TOOL_BUFFER_SIZE_U32 - Tool_TstCursor_u32) > TOOL_TST_SLICE_U32) ? (Tool_TstCursor_u32 + TOOL_TST_SLICE_U32) : TOOL_BUFFER_SIZE_U32;
+    uint32_t l_sum_u32 = TstSum_u32;
+
+    for(uint32_t l_i_u32 = Tool_TstCursor_u32; l_i_u32 < l_end_u32; l_i_u32++) {
+      l_sum_u32 += (uint32_t)Tool_Buffer_u8[l_i_u32];
+#if(TOOL_CFG_SHADOW != 0U)
+      Tool_TstCrc_u32 ^= Tool_ShadowTerm_u32(l_i_u32, Tool_Buffer_u8[l_i_u32]);
+#endif
+    }
+
+    if(l_end_u32 < TOOL_BUFFER_SIZE_U32) {
+      Tool_TstCursor_u32 = l_end_u32;
+      TstSum_u32 = l_sum_u32;
+    } else {
+      /* Sweep complete: same verdict as Tool_RunTst_u8(). */
+      if(l_sum_u32 > (255UL * TOOL_BUFFER_SIZE_U32)) {
+        Tool_StatusFlg_u32 |= TOOL_STATUS_UDF_U32;
+        l_ret_u8 = 2U;
+      } else {
+        Tool_StatusFlg_u32 &= ~TOOL_STATUS_UDF_U32;
+        l_ret_u8 = 0U;
+      }
+#if(TOOL_CFG_SHADOW != 0U)
+      /* Writes behind the cursor were folded in by Tool_ShadowUpd(), so the
+       * swept terms describe the current image. */
+      if((l_ret_u8 == 0U) && (Tool_TstCrc_u32 != Tool_ShadowCrc_u32)) {
+        Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+        l_ret_u8 = 4U;
+      }
+#endif
+      Tool_TstRestart();
+    }
+  }
+
+  TOOL_SEQ_WRITE_END();
+
+  if(l_ret_u8 != 3U) {
+    TOOL_TRC(Tool_trcOpRunTst_e, l_ret_u8, Tool_Count_u32);
   }
 
   return l_ret_u8;
@@ -226,13 +800,34 @@ void Tool_Process(void) {
   l_CycleCnt_u32++;
 
   for(l_iter_u32 = 0u; l_iter_u32 < TOOL_BUFFER_SIZE_U32; l_iter_u32++) {
-    if((Mode_e == Tool_modeRun_e) && (Count_u32 != 0u)) {
+    if((Tool_Mode_e == Tool_modeRun_e) && (Tool_Count_u32 != 0u)) {
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+      /* A corrupted block is dropped by the pop: nothing to rotate. */
+      if(Tool_Pop_u8(&l_val_u8) != 4U) {
+        l_val_u8 = l_val_u8 ^ (uint8_t)(l_CycleCnt_u32 & 0xFFu);
+        (void)Tool_Push_u8(l_val_u8);
+#if(TOOL_CFG_PROC_CRC != 0U)
+        Tool_ProcCrcUpd(l_val_u8);
+#endif
+      }
+#else
       (void)Tool_Pop_u8(&l_val_u8);
       l_val_u8 = l_val_u8 ^ (uint8_t)(l_CycleCnt_u32 & 0xFFu);
       (void)Tool_Push_u8(l_val_u8);
+#if(TOOL_CFG_PROC_CRC != 0U)
+      /* Same pass: the emitted byte is still in a register. */
+      Tool_ProcCrcUpd(l_val_u8);
+#endif
+#endif
     } else {
       /* No operation to keep deterministic timing */
     }
   }
+
+  TOOL_TRC(Tool_trcOpProcess_e, 0U, Tool_Count_u32);
 }
+
+#if(TOOL_CFG_PROC_CRC != 0U)
+uint32_t Tool_GetProcessCrc_u32(void) { return ProcCrc_u32 ^ (uint32_t)0xFFFFFFFFUL; }
+#endif
 /** @} */
@@ -11,18 +11,28 @@
 #ifndef TOOL_H
 #define TOOL_H
 
+#include "Tool_Cfg.h"
 #include <stdbool.h>
 #include <stdint.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /*==================[macros]=================================================*/
 
-#define TOOL_BUFFER_SIZE_U32 (64U)
-#define TOOL_MAX_CRC_LEN_U32 (256U)
+#define TOOL_BUFFER_SIZE_U32 (TOOL_CFG_BUFFER_SIZE_U32)
+#define TOOL_MAX_CRC_LEN_U32 (TOOL_CFG_MAX_CRC_LEN_U32)
+#define TOOL_TST_SLICE_U32 (TOOL_CFG_TST_SLICE_U32)
+#define TOOL_CRC_BLOCK_U32 (TOOL_CFG_CRC_BLOCK_U32)
 
 #define TOOL_STATUS_INIT_U32 (1U << 0U)
 #define TOOL_STATUS_ERR_U32 (1U << 1U)
 #define TOOL_STATUS_OVF_U32 (1U << 2U)
 #define TOOL_STATUS_UDF_U32 (1U << 3U)
+#define TOOL_STATUS_CRC_U32 (1U << 4U)
+
+#define TOOL_SNAPSHOT_RETRY_U32 (8U)
 
 /*==================[types]==================================================*/
 
@@ -31,6 +41,17 @@
  */
 typedef enum { Tool_modeIdle_e = 0, Tool_modeRun_e = 1, Tool_modeDiag_e = 2 } Tool_mode_e;
 
+/**
+ * \brief Coherent view of the Tool bookkeeping, taken under the sequence counter.
+ */
+typedef struct {
+  Tool_mode_e mode_e;      /**< Operating mode. */
+  uint32_t statusFlg_u32;  /**< Internal status flags. */
+  uint32_t count_u32;      /**< Ring-buffer fill level. */
+  uint32_t head_u32;       /**< Ring-buffer write index. */
+  uint32_t tail_u32;       /**< Ring-buffer read index. */
+} Tool_snapshot_t;
+
 /*==================[function prototypes]====================================*/
 
 /**
@@ -44,38 +65,38 @@ typedef enum { Tool_modeIdle_e = 0, Tool_modeRun_e = 1, Tool_modeDiag_e = 2 } To
  *
  * The processing logic:
  * - Reset ring-buffer bookkeeping:
- *   - Set `Head_u32 = 0`, `Tail_u32 = 0`, `Count_u32 = 0`.
+ *   - Set `Tool_Head_u32 = 0`, `Tool_Tail_u32 = 0`, `Tool_Count_u32 = 0`.
  * - Clear the internal buffer content with a bounded loop over
  * `TOOL_BUFFER_SIZE_U32`.
  * - Initialize operating mode:
- *   - Set `Mode_e = Tool_modeIdle_e`.
+ *   - Set `Tool_Mode_e = Tool_modeIdle_e`.
  * - Initialize status flags:
- *   - Clear `StatusFlg_u32`.
+ *   - Clear `Tool_StatusFlg_u32`.
  *   - Set `TOOL_STATUS_INIT_U32`.
  *
  * @par Interface summary
  *
  * | Interface       | In | Out | Type / Signature              | Param | Factor | Offset | Size                     | Range   | Unit |
  * |-----------------|----|-----|-------------------------------|-------|--------|--------|--------------------------|---------|------|
- * | Buffer_u8       |    |  X  | uint8_t[TOOL_BUFFER_SIZE_U32] |   -   |   1    |   0    | TOOL_BUFFER_SIZE_U32     | 0       | [-]  |
- * | Head_u32        |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 0       | [-]  |
- * | Tail_u32        |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 0       | [-]  |
- * | Count_u32       |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 0       | [-]  |
- * | Mode_e          |    |  X  | Tool_mode_e (static)          |   -   |   1    |   0    | 1                        | 0       | [-]  |
- * | StatusFlg_u32   |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 1       | [-]  |
+ * | Tool_Buffer_u8  |    |  X  | uint8_t[TOOL_BUFFER_SIZE_U32] |   -   |   1    |   0    | TOOL_BUFFER_SIZE_U32     | 0       | [-]  |
+ * | Tool_Head_u32   |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 0       | [-]  |
+ * | Tool_Tail_u32   |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 0       | [-]  |
+ * | Tool_Count_u32  |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 0       | [-]  |
+ * | Tool_Mode_e     |    |  X  | Tool_mode_e (static)          |   -   |   1    |   0    | 1                        | 0       | [-]  |
+ * | Tool_StatusFlg_u32   |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 1       | [-]  |
  *
  * @par Activity diagram (PlantUML)
  *
  * @startuml
  * start
- * :Head_u32 = 0;
- * :Tail_u32 = 0;
- * :Count_u32 = 0;
+ * :Tool_Head_u32 = 0;
+ * :Tool_Tail_u32 = 0;
+ * :Tool_Count_u32 = 0;
  * :for i in [0..TOOL_BUFFER_SIZE_U32-1];
- * :Buffer_u8[i] = 0;
- * :Mode_e = Tool_modeIdle_e;
- * :StatusFlg_u32 = 0;
- * :StatusFlg_u32 |= TOOL_STATUS_INIT_U32;
+ * :Tool_Buffer_u8[i] = 0;
+ * :Tool_Mode_e = Tool_modeIdle_e;
+ * :Tool_StatusFlg_u32 = 0;
+ * :Tool_StatusFlg_u32 |= TOOL_STATUS_INIT_U32;
  * stop
  * @enduml
  *
@@ -93,10 +114,10 @@ void Tool_Init(void);
  * flags.
  *
  * The processing logic:
- * - Set `Mode_e = Tool_modeIdle_e`.
- * - Clear `StatusFlg_u32` (removes INIT/ERR/OVF/UDF flags).
+ * - Set `Tool_Mode_e = Tool_modeIdle_e`.
+ * - Clear `Tool_StatusFlg_u32` (removes INIT/ERR/OVF/UDF flags).
  * - Reset ring-buffer bookkeeping:
- *   - Set `Head_u32 = 0`, `Tail_u32 = 0`, `Count_u32 = 0`.
+ *   - Set `Tool_Head_u32 = 0`, `Tool_Tail_u32 = 0`, `Tool_Count_u32 = 0`.
  * - Clear the internal buffer content with a bounded loop over
  * `TOOL_BUFFER_SIZE_U32`.
  *
@@ -104,24 +125,24 @@ void Tool_Init(void);
  *
  * | Interface       | In | Out | Type / Signature              | Param | Factor | Offset | Size                     | Range   | Unit |
  * |-----------------|----|-----|-------------------------------|-------|--------|--------|--------------------------|---------|------|
- * | Buffer_u8       |    |  X  | uint8_t[TOOL_BUFFER_SIZE_U32] |   -   |   1    |   0    | TOOL_BUFFER_SIZE_U32     | 0       | [-]  |
- * | Head_u32        |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 0       | [-]  |
- * | Tail_u32        |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 0       | [-]  |
- * | Count_u32       |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 0       | [-]  |
- * | Mode_e          |    |  X  | Tool_mode_e (static)          |   -   |   1    |   0    | 1                        | 0       | [-]  |
- * | StatusFlg_u32   |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 0       | [-]  |
+ * | Tool_Buffer_u8  |    |  X  | uint8_t[TOOL_BUFFER_SIZE_U32] |   -   |   1    |   0    | TOOL_BUFFER_SIZE_U32     | 0       | [-]  |
+ * | Tool_Head_u32   |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 0       | [-]  |
+ * | Tool_Tail_u32   |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 0       | [-]  |
+ * | Tool_Count_u32  |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 0       | [-]  |
+ * | Tool_Mode_e     |    |  X  | Tool_mode_e (static)          |   -   |   1    |   0    | 1                        | 0       | [-]  |
+ * | Tool_StatusFlg_u32   |    |  X  | uint32_t (static)             |   -   |   1    |   0    | 1                        | 0       | [-]  |
  *
  * @par Activity diagram (PlantUML)
  *
  * @startuml
  * start
- * :Mode_e = Tool_modeIdle_e;
- * :StatusFlg_u32 = 0;
- * :Head_u32 = 0;
- * :Tail_u32 = 0;
- * :Count_u32 = 0;
+ * :Tool_Mode_e = Tool_modeIdle_e;
+ * :Tool_StatusFlg_u32 = 0;
+ * :Tool_Head_u32 = 0;
+ * :Tool_Tail_u32 = 0;
+ * :Tool_Count_u32 = 0;
  * :for i in [0..TOOL_BUFFER_SIZE_U32-1];
- * :Buffer_u8[i] = 0;
+ * :Tool_Buffer_u8[i] = 0;
  * stop
  * @enduml
  *
@@ -142,23 +163,23 @@ void Tool_DeInit(void);
  * | Interface       | In | Out | Type / Signature              | Param | Factor | Offset | Size  | Range   | Unit |
  * |-----------------|----|-----|-------------------------------|-------|--------|--------|-------|---------|------|
  * | Mode            | X  |  X  | Tool_mode_e (static)          |   -   |   1    |   0    | 1     | [0,1,2] | [-]  |
- * | StatusFlg_u32   | X  |  X  | uint32_t (static)             |   -   |   1    |   0    | 1     | 0       | [-]  |
+ * | Tool_StatusFlg_u32   | X  |  X  | uint32_t (static)             |   -   |   1    |   0    | 1     | 0       | [-]  |
  * | returned val    |    |  X  | uint8_t                       |   -   |   1    |   0    | 1     | [0,1,2] | [-]  | 
  *
  * @par Activity diagram (PlantUML)
  *
  * @startuml
  * start
- * if ((StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0) then (not init)
- *   :StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+ * if ((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0) then (not init)
+ *   :Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
  *   :return 1;
  * else (init)
  *   if (mode is invalid) then (invalid)
- *     :StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+ *     :Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
  *     :return 2;
  *   else (valid)
- *     :Mode_e = mode;
- *     :StatusFlg_u32 &= ~TOOL_STATUS_ERR_U32;
+ *     :Tool_Mode_e = mode;
+ *     :Tool_StatusFlg_u32 &= ~TOOL_STATUS_ERR_U32;
  *     :return 0;
  *   endif
  * endif
@@ -186,22 +207,28 @@ uint8_t Tool_SetMode_u8(Tool_mode_e mode);
  *   - Bits [1:0] overwritten by the current mode encoding.
  * - Current ring-buffer fill level (Count) in the upper 16 bits.
  *
+ * Mode, flags and count are read through `Tool_GetSnapshot_u8()`, so they
+ * belong to the same state even while another context is pushing. If no
+ * coherent view is obtained within `TOOL_SNAPSHOT_RETRY_U32` attempts, the
+ * last attempt is packed (best effort, the caller is never blocked).
+ *
  * @par Interface summary
  *
  * | Interface       | In  | Out | Type / Signature              | Param | Factor | Offset | Size | Range   | Unit |
  * |-----------------|-----|-----|-------------------------------|-------|--------|--------|------|---------|------|
- * | Count_u32       |  X  |     | uint32_t (static)             |   -   |   1    |   0    | 1    | -       | [-]  |
- * | Mode_e          |  X  |     | Tool_mode_e (static)          |   -   |   1    |   0    | 1    | -       | [-]  |
- * | StatusFlg_u32   |  X  |     | uint32_t (static)             |   -   |   1    |   0    | 1    | -       | [-]  |
+ * | Tool_Count_u32  |  X  |     | uint32_t (static)             |   -   |   1    |   0    | 1    | -       | [-]  |
+ * | Tool_Mode_e     |  X  |     | Tool_mode_e (static)          |   -   |   1    |   0    | 1    | -       | [-]  |
+ * | Tool_StatusFlg_u32   |  X  |     | uint32_t (static)             |   -   |   1    |   0    | 1    | -       | [-]  |
  * | returned val    |     |  X  | uint32_t                      |   -   |   1    |   0    | 1    | -       | [-]  |
  *
  * @par Activity diagram (PlantUML)
  *
  * @startuml
  * start
- * :l_status_u32 = StatusFlg_u32;
- * :l_status_u32 bits[1:0] = (uint32_t)Mode_e & 0x3;
- * :l_status_u32 bits[31:16] = (Count_u32 & 0xFFFF);
+ * :Tool_GetSnapshot_u8(&l_snap);
+ * :l_status_u32 = l_snap.statusFlg_u32;
+ * :l_status_u32 bits[1:0] = (uint32_t)l_snap.mode_e & 0x3;
+ * :l_status_u32 bits[31:16] = (l_snap.count_u32 & 0xFFFF);
  * :return l_status_u32;
  * stop
  * @enduml
@@ -214,6 +241,78 @@ uint8_t Tool_SetMode_u8(Tool_mode_e mode);
  */
 uint32_t Tool_GetStatus_u32(void);
 
+/**
+ * @brief Take a coherent snapshot of the Tool bookkeeping.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Let a monitoring context read mode, flags, count, head and tail as one
+ * consistent set while the data path keeps running.
+ *
+ * Every function that modifies the bookkeeping increments the sequence counter
+ * `Tool_Seq_u32` before and after the update, so the counter is odd while an update
+ * is in progress. The reader never takes a lock: it retries until it sees the
+ * same even counter value before and after copying the fields. Writers never
+ * wait for readers. A single writing context is assumed (the data path).
+ *
+ * The processing logic:
+ * - If `snapshot_ps == NULL`:
+ *   - Return `2`.
+ * - Else, at most `TOOL_SNAPSHOT_RETRY_U32` times:
+ *   - Read `Tool_Seq_u32`, copy the fields, read `Tool_Seq_u32` again.
+ *   - If both reads are equal and even, return `0`.
+ * - Return `1` (the snapshot holds the last, possibly torn, attempt).
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range    | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|------|----------|------|
+ * | snapshot_ps    |    |  X  | Tool_snapshot_t*            |  out  |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_Seq_u32   | X  |     | volatile uint32_t (static)  |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_Mode_e    | X  |     | Tool_mode_e (static)        |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_StatusFlg_u32  | X  |     | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_Count_u32 | X  |     | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_Head_u32  | X  |     | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_Tail_u32  | X  |     | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | returned val   |    |  X  | uint8_t                     |  out  |   1    |   0    |   1  | [0,1,2]  | [-]  |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (snapshot_ps == NULL) then (null)
+ *   :return 2;
+ * else (valid)
+ *   :l_try = 0;
+ *   repeat
+ *     :l_seq0 = Tool_Seq_u32;
+ *     :acquire fence;
+ *     :copy Tool_Mode_e, Tool_StatusFlg_u32, Tool_Count_u32, Tool_Head_u32, Tool_Tail_u32;
+ *     :acquire fence;
+ *     :l_seq1 = Tool_Seq_u32;
+ *     :l_try++;
+ *   repeat while ((l_seq0 odd or l_seq0 != l_seq1) and l_try < TOOL_SNAPSHOT_RETRY_U32)
+ *   if (l_seq0 even and l_seq0 == l_seq1) then (coherent)
+ *     :return 0;
+ *   else (writer busy)
+ *     :return 1;
+ *   endif
+ * endif
+ * stop
+ * @enduml
+ *
+ * @param snapshot_ps
+ * Output pointer receiving the snapshot.
+ *
+ * @return uint8_t
+ * Return code:
+ * - 0: coherent snapshot taken
+ * - 1: no coherent snapshot within `TOOL_SNAPSHOT_RETRY_U32` attempts
+ * - 2: NULL output pointer
+ */
+uint8_t Tool_GetSnapshot_u8(Tool_snapshot_t *snapshot_ps);
+
 /**
  * @brief Compute a CRC-32 (LSB-first) over a byte array (bounded length).
  *
@@ -268,6 +367,60 @@ uint32_t Tool_GetStatus_u32(void);
  */
 uint32_t Tool_ComputeCrc_u32(const uint8_t *data_pcu8, uint32_t length_u32);
 
+/**
+ * @brief Copy a byte array and compute its CRC in a single pass.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Return exactly what `memcpy(dst_pu8, src_pcu8, length_u32)` followed by
+ * `Tool_ComputeCrc_u32(dst_pu8, length_u32)` returns, reading the source
+ * only once. The CRC covers the first `TOOL_MAX_CRC_LEN_U32` bytes like
+ * `Tool_ComputeCrc_u32()`; longer arrays are still copied completely.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature | Param | Factor | Offset | Size   | Range          | Unit |
+ * |----------------|----|-----|------------------|-------|--------|--------|--------|----------------|------|
+ * | dst_pu8        |    |  X  | uint8_t*         |  out  |   1    |   0    | length | pointer / NULL | [-]  |
+ * | src_pcu8       | X  |     | const uint8_t*   |   in  |   1    |   0    | length | pointer / NULL | [-]  |
+ * | length_u32     | X  |     | uint32_t         |   in  |   1    |   0    |   1    | -              | [B]  |
+ * | return val     |    |  X  | uint32_t         |  out  |   1    |   0    |   1    | -              | [-]  |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (dst_pu8 or src_pcu8 NULL, or length_u32 == 0) then (yes)
+ *   :nothing copied;
+ *   :return 0;
+ * else (no)
+ *   :l_len = min(length_u32, TOOL_MAX_CRC_LEN_U32);
+ *   :crc_u32 = 0xFFFFFFFF;
+ *   repeat :load 8 bytes (or 1 at the end);
+ *     :store them to dst_pu8;
+ *     :advance crc_u32 over them;
+ *   repeat while (l_len bytes done?) is (no)
+ *   :copy remaining length_u32 - l_len bytes;
+ *   :return crc_u32 ^ 0xFFFFFFFF;
+ * endif
+ * stop
+ * @enduml
+ *
+ * @param dst_pu8
+ * Destination; must not overlap the source.
+ *
+ * @param src_pcu8
+ * Source bytes.
+ *
+ * @param length_u32
+ * Number of bytes to copy.
+ *
+ * @return uint32_t
+ * CRC-32 of the copied bytes, same value as `Tool_ComputeCrc_u32()`.
+ */
+uint32_t Tool_CopyCrc_u32(uint8_t *dst_pu8, const uint8_t *src_pcu8, uint32_t length_u32);
+
 /**
  * @brief Push one byte into the Tool ring buffer.
  *
@@ -279,41 +432,45 @@ uint32_t Tool_ComputeCrc_u32(const uint8_t *data_pcu8, uint32_t length_u32);
  * The processing logic:
  * - If module is not initialized:
  *   - Set `TOOL_STATUS_ERR_U32` and return `2`.
- * - Else if the buffer is full (`Count_u32 >= TOOL_BUFFER_SIZE_U32`):
+ * - Else if the buffer is full (`Tool_Count_u32 >= TOOL_BUFFER_SIZE_U32`):
  *   - Set `TOOL_STATUS_OVF_U32` and return `1`.
  * - Else:
- *   - Store `value_u8` at `Buffer_u8[Head_u32]`.
- *   - Increment `Head_u32` modulo `TOOL_BUFFER_SIZE_U32`.
- *   - Increment `Count_u32`.
+ *   - Store `value_u8` at `Tool_Buffer_u8[Tool_Head_u32]`.
+ *   - Increment `Tool_Head_u32` modulo `TOOL_BUFFER_SIZE_U32`.
+ *   - Increment `Tool_Count_u32`.
  *   - Clear `TOOL_STATUS_OVF_U32`.
  *   - Return `0`.
  *
+ * The common case (initialized, OVF flag clear, space left) runs as
+ * straight-line code through `Tool_PushUnchecked()` (Tool_Fast.h) without
+ * writing `Tool_StatusFlg_u32`; every other case is handled out of line.
+ *
  * @par Interface summary
  *
  * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range    | Unit |
  * |----------------|----|-----|-----------------------------|-------|--------|--------|------|----------|------|
  * | value_u8       | X  |     | uint8_t                     |   in  |   1    |   0    |   1  | -        | [-]  |
- * | Buffer_u8      |    |  X  | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64  | -        | [-]  |
- * | Head_u32       | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
- * | Count_u32      | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
- * | StatusFlg_u32  | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_Buffer_u8 |    |  X  | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64  | -        | [-]  |
+ * | Tool_Head_u32  | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_Count_u32 | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_StatusFlg_u32  | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
  * | returned val   |    |  X  | uint8_t                     |   out |   1    |   0    |   1  | [0,1,2]  | [-]  |
  *
  * @par Activity diagram (PlantUML)
  *
  * @startuml
  * start
- * if ((StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0) then (not init)
- *   :StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+ * if ((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0) then (not init)
+ *   :Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
  *   :return 2;
- * elseif (Count_u32 >= TOOL_BUFFER_SIZE_U32) then (full)
- *   :StatusFlg_u32 |= TOOL_STATUS_OVF_U32;
+ * elseif (Tool_Count_u32 >= TOOL_BUFFER_SIZE_U32) then (full)
+ *   :Tool_StatusFlg_u32 |= TOOL_STATUS_OVF_U32;
  *   :return 1;
  * else (space)
- *   :Buffer_u8[Head_u32] = value_u8;
- *   :Head_u32 = (Head_u32 + 1) % TOOL_BUFFER_SIZE_U32;
- *   :Count_u32++;
- *   :StatusFlg_u32 &= ~TOOL_STATUS_OVF_U32;
+ *   :Tool_Buffer_u8[Tool_Head_u32] = value_u8;
+ *   :Tool_Head_u32 = (Tool_Head_u32 + 1) % TOOL_BUFFER_SIZE_U32;
+ *   :Tool_Count_u32++;
+ *   :Tool_StatusFlg_u32 &= ~TOOL_STATUS_OVF_U32;
  *   :return 0;
  * endif
  * stop
@@ -344,45 +501,64 @@ uint8_t Tool_Push_u8(uint8_t value_u8);
  *   - Set `TOOL_STATUS_ERR_U32` and return `3`.
  * - Else if module is not initialized:
  *   - Set `TOOL_STATUS_ERR_U32`, write `*value_pu8 = 0`, and return `2`.
- * - Else if the buffer is empty (`Count_u32 == 0`):
+ * - Else if the buffer is empty (`Tool_Count_u32 == 0`):
  *   - Write `*value_pu8 = 0` and return `1`.
+ * - Else if block CRCs are on (`TOOL_CFG_CRC_BLOCK`), the byte at `Tool_Tail_u32`
+ *   belongs to a sealed block and the block's CRC does not match:
+ *   - Set `TOOL_STATUS_CRC_U32`, drop the rest of the block (cleared,
+ *     `Tool_Tail_u32` to the next block, `Tool_Count_u32` reduced accordingly).
+ *   - Write `*value_pu8 = 0` and return `4`.
  * - Else:
- *   - Read `Buffer_u8[Tail_u32]` into `*value_pu8`.
- *   - Clear `Buffer_u8[Tail_u32]` to `0`.
- *   - Increment `Tail_u32` modulo `TOOL_BUFFER_SIZE_U32`.
- *   - Decrement `Count_u32`.
+ *   - Read `Tool_Buffer_u8[Tool_Tail_u32]` into `*value_pu8`.
+ *   - Clear `Tool_Buffer_u8[Tool_Tail_u32]` to `0`.
+ *   - Increment `Tool_Tail_u32` modulo `TOOL_BUFFER_SIZE_U32`.
+ *   - Decrement `Tool_Count_u32`.
  *   - Return `0`.
  *
+ * The success case runs as straight-line code through
+ * `Tool_PopUnchecked_u8()` (Tool_Fast.h); error cases are handled out of line.
+ *
+ * Block CRCs: a block of `TOOL_CRC_BLOCK_U32` bytes is sealed when a push
+ * fills its last byte; its CRC (`Tool_ComputeCrc_u32()` over the bytes still
+ * queued in it) is checked once, by the first pop that reads from it. Sealing
+ * and checking cost O(block) once per block, O(1) per byte on average. The
+ * bytes of a block that is still being filled are not protected.
+ *
  * @par Interface summary
  *
  * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range    | Unit |
  * |----------------|----|-----|-----------------------------|-------|--------|--------|------|----------|------|
  * | value_u8       | X  |     | uint8_t                     |   in  |   1    |   0    |   1  | -        | [-]  |
- * | Buffer_u8      | X  |  X  | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64  | -        | [-]  |
- * | Tail_u32       | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
- * | Count_u32      | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
- * | StatusFlg_u32  | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
- * | returned val   |    |  X  | uint8_t                     |   out |   1    |   0    |   1  | [0,1,2]  | [-]  |
+ * | Tool_Buffer_u8 | X  |  X  | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64  | -        | [-]  |
+ * | Tool_Tail_u32  | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_Count_u32 | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_StatusFlg_u32  | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | returned val   |    |  X  | uint8_t                     |   out |   1    |   0    |   1  | [0..4]   | [-]  |
  *
  * @par Activity diagram (PlantUML)
  *
  * @startuml
  * start
  * if (value_pu8 == NULL) then (null)
- *   :StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+ *   :Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
  *   :return 3;
- * elseif ((StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0) then (not init)
- *   :StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+ * elseif ((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0) then (not init)
+ *   :Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
  *   :*value_pu8 = 0;
  *   :return 2;
- * elseif (Count_u32 == 0) then (empty)
+ * elseif (Tool_Count_u32 == 0) then (empty)
  *   :*value_pu8 = 0;
  *   :return 1;
+ * elseif (block of Tool_Tail_u32 sealed and CRC mismatch) then (corrupt)
+ *   :Tool_StatusFlg_u32 |= TOOL_STATUS_CRC_U32;
+ *   :drop rest of the block;
+ *   :*value_pu8 = 0;
+ *   :return 4;
  * else (has data)
- *   :*value_pu8 = Buffer_u8[Tail_u32];
- *   :Buffer_u8[Tail_u32] = 0;
- *   :Tail_u32 = (Tail_u32 + 1) % TOOL_BUFFER_SIZE_U32;
- *   :Count_u32--;
+ *   :*value_pu8 = Tool_Buffer_u8[Tool_Tail_u32];
+ *   :Tool_Buffer_u8[Tool_Tail_u32] = 0;
+ *   :Tool_Tail_u32 = (Tool_Tail_u32 + 1) % TOOL_BUFFER_SIZE_U32;
+ *   :Tool_Count_u32--;
  *   :return 0;
  * endif
  * stop
@@ -397,9 +573,240 @@ uint8_t Tool_Push_u8(uint8_t value_u8);
  * - 1: buffer empty (underflow)
  * - 2: module not initialized
  * - 3: NULL output pointer
+ * - 4: corrupted block dropped (`TOOL_CFG_CRC_BLOCK` only)
  */
 uint8_t Tool_Pop_u8(uint8_t *value_pu8);
 
+/**
+ * @brief Push a block of bytes and return its CRC, copied and checked in one pass.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Append `length_u32` bytes as a whole (nothing is pushed if they do not
+ * all fit). The bytes go into `Tool_Buffer_u8` in at most two contiguous runs
+ * (before and after the wrap) through the fused copy-and-CRC kernel, so
+ * `*crc_pu32` equals `Tool_ComputeCrc_u32(src_pcu8, length_u32)` without a
+ * second pass over the data.
+ *
+ * With `TOOL_CFG_SHADOW` the shadow CRC is folded per byte, and with
+ * `TOOL_CFG_CRC_BLOCK` the runs also stop at block boundaries so that each
+ * block filled is sealed as by `Tool_Push_u8()`.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size   | Range          | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|--------|----------------|------|
+ * | src_pcu8       | X  |     | const uint8_t*              |   in  |   1    |   0    | length | pointer / NULL | [-]  |
+ * | length_u32     | X  |     | uint32_t                    |   in  |   1    |   0    |   1    | -              | [B]  |
+ * | crc_pu32       |    |  X  | uint32_t*                   |  out  |   1    |   0    |   1    | pointer / NULL | [-]  |
+ * | Tool_Buffer_u8 |    |  X  | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64    | -              | [-]  |
+ * | Tool_Head_u32  | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1    | -              | [-]  |
+ * | Tool_Count_u32 | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1    | -              | [-]  |
+ * | Tool_StatusFlg_u32  | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1    | -              | [-]  |
+ * | returned val   |    |  X  | uint8_t                     |  out  |   1    |   0    |   1    | [0..3]         | [-]  |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if ((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0) then (not init)
+ *   :Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+ *   :return 2;
+ * elseif (src_pcu8 == NULL and length_u32 != 0) then (null)
+ *   :Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+ *   :return 3;
+ * elseif (length_u32 > TOOL_BUFFER_SIZE_U32 - Tool_Count_u32) then (no room)
+ *   :Tool_StatusFlg_u32 |= TOOL_STATUS_OVF_U32;
+ *   :return 1;
+ * else (room)
+ *   repeat :run = bytes up to the end of Tool_Buffer_u8 (or of the block);
+ *     :copy run to Tool_Buffer_u8[Tool_Head_u32] and advance CRC;
+ *     :Tool_Head_u32 += run; Tool_Count_u32 += run;
+ *   repeat while (bytes left?) is (yes)
+ *   :Tool_StatusFlg_u32 &= ~TOOL_STATUS_OVF_U32;
+ *   :*crc_pu32 = CRC;
+ *   :return 0;
+ * endif
+ * stop
+ * @enduml
+ *
+ * @param src_pcu8
+ * Bytes to push.
+ *
+ * @param length_u32
+ * Number of bytes; 0 pushes nothing and succeeds.
+ *
+ * @param crc_pu32
+ * Receives the CRC of the block (`Tool_ComputeCrc_u32()` semantics, 0 when
+ * nothing was pushed); may be NULL.
+ *
+ * @return uint8_t
+ * Return code:
+ * - 0: pushed successfully
+ * - 1: not enough space (nothing pushed)
+ * - 2: module not initialized
+ * - 3: NULL source pointer
+ */
+uint8_t Tool_PushBlock_u8(const uint8_t *src_pcu8, uint32_t length_u32, uint32_t *crc_pu32);
+
+/**
+ * @brief Pop a block of bytes and return its CRC, copied and checked in one pass.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Remove the `length_u32` oldest bytes as a whole (nothing is popped if
+ * fewer are queued). The bytes leave `Tool_Buffer_u8` in at most two contiguous
+ * runs through the fused copy-and-CRC kernel, so `*crc_pu32` equals
+ * `Tool_ComputeCrc_u32(dst_pu8, length_u32)` without a second pass over the
+ * data. The freed slots are cleared like in `Tool_Pop_u8()`.
+ *
+ * With `TOOL_CFG_CRC_BLOCK` every sealed block in the range is checked
+ * before anything is copied. If one is corrupted, only the bytes of that
+ * block are dropped instead, `TOOL_STATUS_CRC_U32` is set and 4 is returned.
+ * The intact bytes queued before it stay queued, in order (they move up to
+ * close the gap and their blocks are resealed), so a retry delivers them.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size   | Range          | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|--------|----------------|------|
+ * | dst_pu8        |    |  X  | uint8_t*                    |  out  |   1    |   0    | length | pointer / NULL | [-]  |
+ * | length_u32     | X  |     | uint32_t                    |   in  |   1    |   0    |   1    | -              | [B]  |
+ * | crc_pu32       |    |  X  | uint32_t*                   |  out  |   1    |   0    |   1    | pointer / NULL | [-]  |
+ * | Tool_Buffer_u8 | X  |  X  | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64    | -              | [-]  |
+ * | Tool_Tail_u32  | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1    | -              | [-]  |
+ * | Tool_Count_u32 | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1    | -              | [-]  |
+ * | Tool_StatusFlg_u32  | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1    | -              | [-]  |
+ * | returned val   |    |  X  | uint8_t                     |  out  |   1    |   0    |   1    | [0..4]         | [-]  |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (dst_pu8 == NULL and length_u32 != 0) then (null)
+ *   :Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+ *   :return 3;
+ * elseif ((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0) then (not init)
+ *   :Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+ *   :return 2;
+ * elseif (length_u32 > Tool_Count_u32) then (too few)
+ *   :return 1;
+ * elseif (sealed block in range with CRC mismatch) then (corrupt)
+ *   :drop the bytes of that block, earlier bytes stay queued;
+ *   :Tool_StatusFlg_u32 |= TOOL_STATUS_CRC_U32;
+ *   :return 4;
+ * else (has data)
+ *   repeat :run = bytes up to the end of Tool_Buffer_u8 (or of the block);
+ *     :copy run from Tool_Buffer_u8[Tool_Tail_u32] and advance CRC;
+ *     :clear the run;
+ *     :Tool_Tail_u32 += run; Tool_Count_u32 -= run;
+ *   repeat while (bytes left?) is (yes)
+ *   :*crc_pu32 = CRC;
+ *   :return 0;
+ * endif
+ * stop
+ * @enduml
+ *
+ * @param dst_pu8
+ * Receives the popped bytes.
+ *
+ * @param length_u32
+ * Number of bytes; 0 pops nothing and succeeds.
+ *
+ * @param crc_pu32
+ * Receives the CRC of the block (`Tool_ComputeCrc_u32()` semantics, 0 when
+ * nothing was popped); may be NULL.
+ *
+ * @return uint8_t
+ * Return code:
+ * - 0: popped successfully
+ * - 1: fewer than `length_u32` bytes queued (nothing popped)
+ * - 2: module not initialized
+ * - 3: NULL output pointer
+ * - 4: corrupted block dropped (`TOOL_CFG_CRC_BLOCK` only, nothing copied,
+ *   earlier bytes still queued)
+ */
+uint8_t Tool_PopBlock_u8(uint8_t *dst_pu8, uint32_t length_u32, uint32_t *crc_pu32);
+
+/**
+ * @brief CRC-32 of queued bytes, computed in place.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Checksum part of what is queued without popping it. The region starts
+ * `offset_u32` bytes after the oldest queued byte and spans `length_u32`
+ * bytes. It is read directly from `Tool_Buffer_u8`. Where the ring wraps the
+ * region is taken as two contiguous runs, so the cost is that of one
+ * contiguous CRC and nothing is copied. `*crc_pu32` equals
+ * `Tool_ComputeCrc_u32()` over the same bytes, including the
+ * `TOOL_MAX_CRC_LEN_U32` cap.
+ *
+ * Nothing is written: head, tail, count, flags and the sequence counter stay
+ * as they are. With `TOOL_CFG_CONCURRENCY=SPSC` the read is validated against
+ * `Tool_Seq_u32` like in `Tool_GetSnapshot_u8()`, at most
+ * `TOOL_SNAPSHOT_RETRY_U32` times.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range          | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|------|----------------|------|
+ * | offset_u32     | X  |     | uint32_t                    |   in  |   1    |   0    |   1  | -              | [B]  |
+ * | length_u32     | X  |     | uint32_t                    |   in  |   1    |   0    |   1  | -              | [B]  |
+ * | crc_pu32       |    |  X  | uint32_t*                   |  out  |   1    |   0    |   1  | pointer        | [-]  |
+ * | Tool_Buffer_u8 | X  |     | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64  | -              | [-]  |
+ * | Tool_Tail_u32  | X  |     | uint32_t (static)           |   -   |   1    |   0    |   1  | -              | [-]  |
+ * | Tool_Count_u32 | X  |     | uint32_t (static)           |   -   |   1    |   0    |   1  | -              | [-]  |
+ * | Tool_StatusFlg_u32  | X  |     | uint32_t (static)           |   -   |   1    |   0    |   1  | -              | [-]  |
+ * | Tool_Seq_u32   | X  |     | volatile uint32_t (static)  |   -   |   1    |   0    |   1  | -              | [-]  |
+ * | returned val   |    |  X  | uint8_t                     |  out  |   1    |   0    |   1  | [0..4]         | [-]  |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (crc_pu32 == NULL) then (null)
+ *   :return 3;
+ *   stop
+ * endif
+ * repeat :l_seq0 = Tool_Seq_u32 (SPSC only);
+ *   if ((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0) then (not init)
+ *     :l_ret = 2;
+ *   elseif (offset_u32 + length_u32 > Tool_Count_u32) then (not queued)
+ *     :l_ret = 1;
+ *   else (queued)
+ *     :from = (Tool_Tail_u32 + offset_u32) % TOOL_BUFFER_SIZE_U32;
+ *     :CRC over Tool_Buffer_u8[from..] up to the end of the array;
+ *     :continue over Tool_Buffer_u8[0..] for the wrapped rest;
+ *     :l_ret = 0;
+ *   endif
+ * repeat while (SPSC and Tool_Seq_u32 odd or changed, tries left?) is (yes)
+ * :*crc_pu32 = (l_ret == 0) ? CRC : 0;
+ * :return l_ret (4 if every try raced a writer);
+ * stop
+ * @enduml
+ *
+ * @param offset_u32
+ * Bytes to skip after the oldest queued byte.
+ *
+ * @param length_u32
+ * Bytes to checksum; 0 gives the CRC of nothing (0).
+ *
+ * @param crc_pu32
+ * Receives the CRC (`Tool_ComputeCrc_u32()` semantics), 0 on error.
+ *
+ * @return uint8_t
+ * Return code:
+ * - 0: CRC computed
+ * - 1: region not entirely queued
+ * - 2: module not initialized
+ * - 3: NULL output pointer
+ * - 4: no coherent read within `TOOL_SNAPSHOT_RETRY_U32` attempts (SPSC only)
+ */
+uint8_t Tool_CrcOfQueued_u8(uint32_t offset_u32, uint32_t length_u32, uint32_t *crc_pu32);
+
 /**
  * @brief Clear the Tool ring buffer content and related flags.
  *
@@ -411,35 +818,39 @@ uint8_t Tool_Pop_u8(uint8_t *value_pu8);
  *
  * The processing logic:
  * - Reset ring-buffer bookkeeping:
- *   - Set `Head_u32 = 0`, `Tail_u32 = 0`, `Count_u32 = 0`.
+ *   - Set `Tool_Head_u32 = 0`, `Tool_Tail_u32 = 0`, `Tool_Count_u32 = 0`.
  * - Clear the internal buffer content with a bounded loop over
  * `TOOL_BUFFER_SIZE_U32`.
  * - Clear status flags:
  *   - Clear `TOOL_STATUS_ERR_U32`.
  *   - Clear `TOOL_STATUS_OVF_U32`.
  *   - Do not modify `TOOL_STATUS_INIT_U32`.
+ * - With `TOOL_CFG_PROC_CRC` on, restart the `Tool_GetProcessCrc_u32()`
+ *   stream: the bytes it covered are gone.
  *
  * @par Interface summary
  *
  * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range   | Unit |
  * |----------------|----|-----|-----------------------------|-------|--------|--------|------|---------|------|
- * | Buffer_u8      |    |  X  | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64  | 0       | [-]  |
- * | Tail_u32       |    |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | 0       | [-]  |
- * | Head_u32       |    |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | 0       | [-]  |
- * | Count_u32      |    |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | 0       | [-]  |
- * | StatusFlg_u32  |    |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | 0       | [-]  |
+ * | Tool_Buffer_u8 |    |  X  | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64  | 0       | [-]  |
+ * | Tool_Tail_u32  |    |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | 0       | [-]  |
+ * | Tool_Head_u32  |    |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | 0       | [-]  |
+ * | Tool_Count_u32 |    |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | 0       | [-]  |
+ * | Tool_StatusFlg_u32  |    |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | 0       | [-]  |
+ * | ProcCrc_u32    |    |  X  | uint32_t (static, PROC_CRC) |   -   |   1    |   0    |   1  | -       | [-]  |
  *
  * @par Activity diagram (PlantUML)
  *
  * @startuml
  * start
- * :Head_u32 = 0;
- * :Tail_u32 = 0;
- * :Count_u32 = 0;
+ * :Tool_Head_u32 = 0;
+ * :Tool_Tail_u32 = 0;
+ * :Tool_Count_u32 = 0;
  * :for i in [0..TOOL_BUFFER_SIZE_U32-1];
- * :Buffer_u8[i] = 0;
- * :StatusFlg_u32 &= ~TOOL_STATUS_ERR_U32;
- * :StatusFlg_u32 &= ~TOOL_STATUS_OVF_U32;
+ * :Tool_Buffer_u8[i] = 0;
+ * :Tool_StatusFlg_u32 &= ~TOOL_STATUS_ERR_U32;
+ * :Tool_StatusFlg_u32 &= ~TOOL_STATUS_OVF_U32;
+ * :PROC_CRC: ProcCrc_u32 = TOOL_CRC_INIT_U32;
  * stop
  * @enduml
  *
@@ -458,45 +869,55 @@ void Tool_Clear(void);
  * conditions.
  *
  * The processing logic:
- * - If `Count_u32 > TOOL_BUFFER_SIZE_U32`:
+ * - If `Tool_Count_u32 > TOOL_BUFFER_SIZE_U32`:
  *   - Set `TOOL_STATUS_ERR_U32`.
  *   - Return `1`.
  * - Else:
- *   - Compute `l_sum_u32 = sum(Buffer_u8[i])` for all `i` in
- * `0..TOOL_BUFFER_SIZE_U32-1`.
+ *   - Compute `l_sum_u32 = sum(Tool_Buffer_u8[i])` for all `i` in
+ * `0..TOOL_BUFFER_SIZE_U32-1` (`Tool_SumBytes_u32()`, SIMD where available).
  *   - If `l_sum_u32 > (255 * TOOL_BUFFER_SIZE_U32)`:
  *     - Set `TOOL_STATUS_UDF_U32`.
  *     - Return `2`.
  *   - Else:
  *     - Clear `TOOL_STATUS_UDF_U32`.
  *     - Return `0`.
+ *   - With `TOOL_CFG_SHADOW` on, before returning `0`: if the raw CRC-32 of
+ *     the whole `Tool_Buffer_u8` image differs from the running CRC that every
+ *     push, pop and clear updates in O(1), set `TOOL_STATUS_ERR_U32` and
+ *     return `4` (a byte changed behind the module's back, e.g. a bit flip).
  *
  * @par Interface summary
  *
  * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range       | Unit |
  * |----------------|----|-----|-----------------------------|-------|--------|--------|------|-------------|------|
- * | Buffer_u8      | X  |     | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64  | 0           | [-]  |
- * | Count_u32      | X  |     | uint32_t (static)           |   -   |   1    |   0    |   1  | 0           | [-]  |
- * | StatusFlg_u32  |    |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | 0           | [-]  |
- * | Returned val   |    |  X  | uint8_t                     |   -   |   1    |   0    |   1  | 0 / 1 / 2   | [-]  |
+ * | Tool_Buffer_u8 | X  |     | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64  | 0           | [-]  |
+ * | Tool_Count_u32 | X  |     | uint32_t (static)           |   -   |   1    |   0    |   1  | 0           | [-]  |
+ * | Tool_ShadowCrc_u32  | X  |     | uint32_t (static, SHADOW)   |   -   |   1    |   0    |   1  | -           | [-]  |
+ * | Tool_StatusFlg_u32  |    |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | 0           | [-]  |
+ * | Returned val   |    |  X  | uint8_t                     |   -   |   1    |   0    |   1  | 0/1/2/4     | [-]  |
  *
  * @par Activity diagram (PlantUML)
  *
  * @startuml
  * start
- * if (Count_u32 > TOOL_BUFFER_SIZE_U32) then (bad)
- *   :StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+ * if (Tool_Count_u32 > TOOL_BUFFER_SIZE_U32) then (bad)
+ *   :Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
  *   :return 1;
  * else (ok)
  *   :sum = 0;
  *   :for i in [0..TOOL_BUFFER_SIZE_U32-1];
- *   :sum += Buffer_u8[i];
+ *   :sum += Tool_Buffer_u8[i];
  *   if (sum > 255*TOOL_BUFFER_SIZE_U32) then (unexpected)
- *     :StatusFlg_u32 |= TOOL_STATUS_UDF_U32;
+ *     :Tool_StatusFlg_u32 |= TOOL_STATUS_UDF_U32;
  *     :return 2;
  *   else (normal)
- *     :StatusFlg_u32 &= ~TOOL_STATUS_UDF_U32;
- *     :return 0;
+ *     :Tool_StatusFlg_u32 &= ~TOOL_STATUS_UDF_U32;
+ *     if (SHADOW and CRC(Tool_Buffer_u8) != Tool_ShadowCrc_u32) then (corrupt)
+ *       :Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+ *       :return 4;
+ *     else (intact)
+ *       :return 0;
+ *     endif
  *   endif
  * endif
  * stop
@@ -507,9 +928,105 @@ void Tool_Clear(void);
  * - 0: self-test passed
  * - 1: internal invariant violated (Count too large)
  * - 2: unexpected checksum condition (UDF flag set)
+ * - 4: buffer content does not match the shadow CRC (`TOOL_CFG_SHADOW` only)
  */
 uint8_t Tool_RunTst_u8(void);
 
+/**
+ * @brief Run one slice of the self-test; the verdict comes after a full sweep.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Same checks as `Tool_RunTst_u8()`, spread over several calls so that the
+ * cost per call stays bounded on large buffers. Each call checks the
+ * invariant on `Tool_Count_u32` and adds a window of at most
+ * `TOOL_TST_SLICE_U32` bytes to a partial checksum, starting at a
+ * module-static cursor. A full sweep takes
+ * `K = ceil(TOOL_BUFFER_SIZE_U32 / TOOL_TST_SLICE_U32)` calls; the K-th call
+ * reports the verdict and starts the next sweep.
+ *
+ * The processing logic:
+ * - If `Tool_Count_u32 > TOOL_BUFFER_SIZE_U32`:
+ *   - Set `TOOL_STATUS_ERR_U32`, restart the sweep.
+ *   - Return `1`.
+ * - Else:
+ *   - `sum += Tool_Buffer_u8[i]` for `i` in `cursor .. min(cursor + SLICE, SIZE) - 1`
+ *     (with `TOOL_CFG_SHADOW` the CRC terms of these bytes go into `Tool_TstCrc_u32`).
+ *   - If the end of the buffer is not reached: advance the cursor, return `3`.
+ *   - Else: restart the sweep and, as `Tool_RunTst_u8()`:
+ *     - If `sum > (255 * TOOL_BUFFER_SIZE_U32)`: set `TOOL_STATUS_UDF_U32`,
+ *       return `2`.
+ *     - Else: clear `TOOL_STATUS_UDF_U32`, return `0`.
+ *     - With `TOOL_CFG_SHADOW`, if that passed and `Tool_TstCrc_u32 !=
+ *       Tool_ShadowCrc_u32`: set `TOOL_STATUS_ERR_U32`, return `4`.
+ *
+ * The windows of one sweep are read at different times, so the checksum is
+ * not a snapshot of the buffer; the bound it is compared against holds for
+ * any byte content. The swept-region CRC is kept current instead: every
+ * `Tool_ShadowUpd()` behind the cursor is folded into it as well, so at the
+ * end of a sweep it must equal the shadow CRC. A byte corrupted before the
+ * cursor reaches it fails this sweep, one corrupted behind it the next.
+ * `Tool_Init()`, `Tool_DeInit()` and `Tool_Clear()` restart or rebase the sweep.
+ * The trace records the verdicts and failures only.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size  | Range         | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|-------|---------------|------|
+ * | Tool_Buffer_u8 | X  |     | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    | SLICE | 0..255        | [-]  |
+ * | Tool_Count_u32 | X  |     | uint32_t (static)           |   -   |   1    |   0    |   1   | 0..SIZE       | [-]  |
+ * | Tool_TstCursor_u32 | X  |  X  | uint32_t (extern)           |   -   |   1    |   0    |   1   | 0..SIZE-1     | [-]  |
+ * | TstSum_u32     | X  |  X  | uint32_t (static)           |   -   |   1    |   0    |   1   | 0..255*SIZE   | [-]  |
+ * | Tool_TstCrc_u32 | X  |  X  | uint32_t (SHADOW)           |   -   |   1    |   0    |   1   | -             | [-]  |
+ * | Tool_StatusFlg_u32  |    |  X  | uint32_t (static)           |   -   |   1    |   0    |   1   | bitfield      | [-]  |
+ * | Returned val   |    |  X  | uint8_t                     |   -   |   1    |   0    |   1   | 0..4          | [-]  |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (Tool_Count_u32 > TOOL_BUFFER_SIZE_U32) then (bad)
+ *   :Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+ *   :cursor = 0; sum = 0;
+ *   :return 1;
+ * else (ok)
+ *   :end = min(cursor + TOOL_TST_SLICE_U32, TOOL_BUFFER_SIZE_U32);
+ *   :for i in [cursor..end-1];
+ *   :sum += Tool_Buffer_u8[i]; (SHADOW) tstCrc ^= term(i, Tool_Buffer_u8[i]);
+ *   if (end < TOOL_BUFFER_SIZE_U32) then (sweep in progress)
+ *     :cursor = end;
+ *     :return 3;
+ *   else (sweep complete)
+ *     if (sum > 255*TOOL_BUFFER_SIZE_U32) then (unexpected)
+ *       :Tool_StatusFlg_u32 |= TOOL_STATUS_UDF_U32;
+ *       :ret = 2;
+ *     else (normal)
+ *       :Tool_StatusFlg_u32 &= ~TOOL_STATUS_UDF_U32;
+ *       :ret = 0;
+ *       if (SHADOW and tstCrc != Tool_ShadowCrc_u32) then (corrupt)
+ *         :Tool_StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+ *         :ret = 4;
+ *       endif
+ *     endif
+ *     :cursor = 0; sum = 0; tstCrc = 0;
+ *     :return ret;
+ *   endif
+ * endif
+ * stop
+ * @enduml
+ *
+ * @return uint8_t
+ * Return code:
+ * - 0: sweep complete, self-test passed
+ * - 1: internal invariant violated (Count too large), sweep restarted
+ * - 2: sweep complete, unexpected checksum condition (UDF flag set)
+ * - 3: slice checked, sweep still in progress
+ * - 4: sweep complete, buffer content does not match the shadow CRC
+ *   (`TOOL_CFG_SHADOW` only)
+ */
+uint8_t Tool_RunTstStep_u8(void);
+
 /**
  * @brief Run one deterministic processing step of the Tool module.
  *
@@ -524,22 +1041,26 @@ uint8_t Tool_RunTst_u8(void);
  * - Maintain a function-static cycle counter:
  *   - `l_CycleCnt_u32++` each call (wraps naturally).
  * - Run a bounded loop for `TOOL_BUFFER_SIZE_U32` iterations:
- *   - If `Mode_e == Tool_modeRun_e` AND `Count_u32 != 0`:
+ *   - If `Tool_Mode_e == Tool_modeRun_e` AND `Tool_Count_u32 != 0`:
  *     - Pop one byte into `l_val_u8`.
  *     - Transform: `l_val_u8 = l_val_u8 ^ (l_CycleCnt_u32 & 0xFF)`.
  *     - Push the transformed byte back into the buffer.
  *   - Else:
  *     - Do no buffer manipulation (keep deterministic timing).
+ * - With `TOOL_CFG_PROC_CRC` on, every byte pushed back is also folded into
+ *   a running CRC of the emitted stream in the same iteration (read with
+ *   `Tool_GetProcessCrc_u32()`).
  *
  * @par Interface summary
  *
  * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range    | Unit |
  * |----------------|----|-----|-----------------------------|-------|--------|--------|------|----------|------|
- * | Mode_e         | X  |     | Tool_mode_e (static)        |   -   |   1    |   0    |   1  | -        | [-]  |
- * | Buffer_u8      | X  |     | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64  | 0        | [-]  |
+ * | Tool_Mode_e    | X  |     | Tool_mode_e (static)        |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_Buffer_u8 | X  |     | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64  | 0        | [-]  |
  * | l_CycleCnt_u32 | X  |     | uint32_t (static local)     |   -   |   1    |   0    |   1  | 0        | [-]  |
  * | Tool_Pop_u8    | X  |     | uint8_t (uint8_t *value_pu8)|   -   |   1    |   0    |   1  | -        | [-]  |
  * | Tool_Push_u8   | X  |     | uint8_t (uint8_t value_u8)  |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | ProcCrc_u32    | X  |  X  | uint32_t (static, PROC_CRC) |   -   |   1    |   0    |   1  | -        | [-]  |
  *
  * @par Activity diagram (PlantUML)
  *
@@ -547,10 +1068,11 @@ uint8_t Tool_RunTst_u8(void);
  * start
  * :static local l_CycleCnt_u32++;
  * :for iter in [0..TOOL_BUFFER_SIZE_U32-1];
- * if (Mode_e == RUN and Count_u32 != 0) then (yes)
+ * if (Tool_Mode_e == RUN and Tool_Count_u32 != 0) then (yes)
  *   :Tool_Pop_u8(&val);
  *   :val = val XOR (l_CycleCnt_u32 & 0xFF);
  *   :Tool_Push_u8(val);
+ *   :PROC_CRC: ProcCrc_u32 = CRC step(ProcCrc_u32, val);
  * else (no)
  *   :no-op (bounded);
  * endif
@@ -562,6 +1084,27 @@ uint8_t Tool_RunTst_u8(void);
  */
 void Tool_Process(void);
 
+#if(TOOL_CFG_PROC_CRC != 0U)
+/**
+ * @brief CRC of every byte emitted by `Tool_Process()` since the last restart.
+ *
+ * @details
+ * The stream is the sequence of transformed bytes pushed back into the ring
+ * by all `Tool_Process()` calls, in order. The value is what
+ * `Tool_ComputeCrc_u32()` would return over that whole sequence if it had
+ * no length cap. `Tool_Init()`, `Tool_DeInit()` and `Tool_Clear()` restart
+ * it; call from the context that runs `Tool_Process()`.
+ *
+ * @return uint32_t
+ * CRC-32 of the emitted stream (0 before anything was emitted).
+ */
+uint32_t Tool_GetProcessCrc_u32(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* TOOL_H */
 
 /** @} */
@@ -0,0 +1,285 @@
+/**
+ * \file Tool.hpp
+ * \brief Header-only C++20 layer over the Tool module.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * Nothing in this header is compiled into the C library: the C build and its
+ * ABI are unchanged, C++ callers include this file next to linking `new`.
+ *
+ * - `Tool::Ring<T, N, Policy>`: typed SPSC ring with the same cache-line
+ *   layout, cached indices and memory ordering as `TOOL_DEFINE_RING()`
+ *   (Tool_Ring.h), so it compiles to the same code as the handwritten C
+ *   fast path.
+ * - `Tool::CrcTbl`, `Tool::CrcUpd()`, `Tool::ComputeCrc()`: CRC-32 with a
+ *   table generated at compile time; usable in constant expressions and
+ *   bit-identical to `Tool_ComputeCrc_u32()`.
+ *
+ * \defgroup Tool_Cpp Tool C++ Layer
+ * @{
+ */
+
+#ifndef TOOL_HPP
+#define TOOL_HPP
+
+#include "Tool.h"
+#include "Tool_Ring.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+namespace Tool {
+
+/*==================[types]==================================================*/
+
+/**
+ * \brief Overflow policy: a push into a full ring fails (return code 1).
+ */
+struct Reject {
+  static constexpr bool overwrite_b = false;
+};
+
+/**
+ * \brief Overflow policy: a push into a full ring drops the oldest elements.
+ *
+ * The producer then moves the read index, so this policy is only valid when
+ * producer and consumer run in the same context.
+ */
+struct Overwrite {
+  static constexpr bool overwrite_b = true;
+};
+
+/*==================[constexpr CRC]==========================================*/
+
+/**
+ * @brief Build the CRC-32 (poly 0xEDB88320, LSB-first) lookup table.
+ *
+ * @return std::array<std::uint32_t, 256>
+ * Remainder of each byte value.
+ */
+constexpr std::array<std::uint32_t, 256U> MakeCrcTbl() {
+  std::array<std::uint32_t, 256U> l_tbl_a{};
+
+  for(std::uint32_t l_i_u32 = 0U; l_i_u32 < 256U; l_i_u32++) {
+    std::uint32_t l_crc_u32 = l_i_u32;
+
+    for(std::uint32_t l_bit_u32 = 0U; l_bit_u32 < 8U; l_bit_u32++) {
+      l_crc_u32 = ((l_crc_u32 & 1U) != 0U) ? ((l_crc_u32 >> 1U) ^ 0xEDB88320UL) : (l_crc_u32 >> 1U);
+    }
+    l_tbl_a[l_i_u32] = l_crc_u32;
+  }
+
+  return l_tbl_a;
+}
+
+/* Generated at compile time, one instance per program. */
+inline constexpr std::array<std::uint32_t, 256U> CrcTbl = MakeCrcTbl();
+
+/**
+ * @brief Advance a raw CRC-32 register (no init, final XOR or cap).
+ *
+ * Same contract as `Tool_CrcUpdInl_u32()`.
+ *
+ * @param crc_u32
+ * Current CRC register.
+ *
+ * @param data_s
+ * Input bytes.
+ *
+ * @return std::uint32_t
+ * Updated CRC register.
+ */
+constexpr std::uint32_t CrcUpd(std::uint32_t crc_u32, std::span<const std::uint8_t> data_s) noexcept {
+  std::uint32_t l_crc_u32 = crc_u32;
+
+  for(const std::uint8_t l_b_u8 : data_s) {
+    l_crc_u32 = (l_crc_u32 >> 8U) ^ CrcTbl[(l_crc_u32 ^ l_b_u8) & 0xFFU];
+  }
+
+  return l_crc_u32;
+}
+
+/**
+ * @brief CRC-32 with the contract of `Tool_ComputeCrc_u32()`.
+ *
+ * An empty span yields 0; input beyond `TOOL_MAX_CRC_LEN_U32` bytes is
+ * ignored, exactly like the C function.
+ *
+ * @param data_s
+ * Input bytes.
+ *
+ * @return std::uint32_t
+ * Final CRC-32 value.
+ */
+constexpr std::uint32_t ComputeCrc(std::span<const std::uint8_t> data_s) noexcept {
+  std::size_t l_len_sz = (data_s.size() > TOOL_MAX_CRC_LEN_U32) ? TOOL_MAX_CRC_LEN_U32 : data_s.size();
+
+  return CrcUpd(0xFFFFFFFFUL, data_s.first(l_len_sz)) ^ 0xFFFFFFFFUL;
+}
+
+namespace Detail {
+inline constexpr std::array<std::uint8_t, 9U> CrcCheck_a = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+} // namespace Detail
+
+/* The table is checked uncapped; the cap may be shorter than the check input. */
+static_assert((CrcUpd(0xFFFFFFFFUL, Detail::CrcCheck_a) ^ 0xFFFFFFFFUL) == 0xCBF43926UL, "Tool::CrcUpd: CRC-32 check value mismatch");
+static_assert((TOOL_MAX_CRC_LEN_U32 < Detail::CrcCheck_a.size()) || (ComputeCrc(Detail::CrcCheck_a) == 0xCBF43926UL),
+              "Tool::ComputeCrc: CRC-32 check value mismatch");
+
+/*==================[ring]===================================================*/
+
+/**
+ * @brief Typed ring buffer with compile-time capacity and overflow policy.
+ *
+ * @details
+ * Return codes follow the C API: `Push()` 0 ok / 1 full (with `Overwrite`:
+ * 1 means the oldest element was dropped), `Pop()` 0 ok / 1 empty. Bulk
+ * transfers return the number of elements moved.
+ *
+ * @tparam T
+ * Element type (trivially copyable).
+ *
+ * @tparam N
+ * Capacity in elements (power of two, at most `TOOL_RING_CAP_MAX_U32`).
+ *
+ * @tparam Policy
+ * `Tool::Reject` (default) or `Tool::Overwrite`.
+ */
+template <typename T, std::uint32_t N, typename Policy = Reject>
+class Ring {
+  static_assert(std::is_trivially_copyable_v<T>, "Tool::Ring: element type must be trivially copyable");
+  static_assert((N != 0U) && ((N & (N - 1U)) == 0U), "Tool::Ring: capacity must be a power of two");
+  static_assert(N <= TOOL_RING_CAP_MAX_U32, "Tool::Ring: capacity does not fit TOOL_CFG_INDEX_WIDTH");
+
+public:
+  static constexpr std::uint32_t Capacity() noexcept { return N; }
+
+  void Clear() noexcept {
+    Head_u = 0U;
+    TailCache_u = 0U;
+    Tail_u = 0U;
+    HeadCache_u = 0U;
+  }
+
+  std::uint32_t Count() const noexcept { return static_cast<Tool_cfgIdx_t>(TOOL_RING_LOAD_ACQ(Head_u) - TOOL_RING_LOAD_ACQ(Tail_u)); }
+
+  std::uint8_t Push(const T &value) noexcept {
+    std::uint8_t l_ret_u8 = 0U;
+    Tool_cfgIdx_t l_head_u = Head_u;
+
+    if(Free(l_head_u, 1U) == 0U) {
+      l_ret_u8 = 1U;
+      if constexpr(Policy::overwrite_b) {
+        TailCache_u = static_cast<Tool_cfgIdx_t>(Tail_u + 1U);
+        TOOL_RING_STORE_REL(Tail_u, TailCache_u);
+      }
+    }
+    if((l_ret_u8 == 0U) || Policy::overwrite_b) {
+      Data_a[l_head_u & (N - 1U)] = value;
+      TOOL_RING_STORE_REL(Head_u, static_cast<Tool_cfgIdx_t>(l_head_u + 1U));
+    }
+
+    return l_ret_u8;
+  }
+
+  std::uint8_t Pop(T &value) noexcept {
+    std::uint8_t l_ret_u8 = 0U;
+    Tool_cfgIdx_t l_tail_u = Tail_u;
+
+    if(Used(l_tail_u, 1U) == 0U) {
+      l_ret_u8 = 1U;
+    } else {
+      value = Data_a[l_tail_u & (N - 1U)];
+      TOOL_RING_STORE_REL(Tail_u, static_cast<Tool_cfgIdx_t>(l_tail_u + 1U));
+    }
+
+    return l_ret_u8;
+  }
+
+  std::uint32_t PushN(std::span<const T> src_s) noexcept {
+    std::uint32_t l_n_u32 = static_cast<std::uint32_t>((src_s.size() > N) ? N : src_s.size());
+    Tool_cfgIdx_t l_head_u = Head_u;
+    std::uint32_t l_free_u32 = Free(l_head_u, l_n_u32);
+
+    if constexpr(Policy::overwrite_b) {
+      /* Keep the newest elements, drop the oldest queued ones to make room. */
+      src_s = src_s.last(l_n_u32);
+      if(l_n_u32 > l_free_u32) {
+        TailCache_u = static_cast<Tool_cfgIdx_t>(Tail_u + (l_n_u32 - l_free_u32));
+        TOOL_RING_STORE_REL(Tail_u, TailCache_u);
+      }
+    } else {
+      l_n_u32 = (l_n_u32 > l_free_u32) ? l_free_u32 : l_n_u32;
+    }
+    if(l_n_u32 != 0U) {
+      std::uint32_t l_pos_u32 = l_head_u & (N - 1U);
+      std::uint32_t l_run_u32 = ((N - l_pos_u32) > l_n_u32) ? l_n_u32 : (N - l_pos_u32);
+
+      /* Up to the physical end of the array, then the wrapped remainder. */
+      std::memcpy(&Data_a[l_pos_u32], src_s.data(), l_run_u32 * sizeof(T));
+      std::memcpy(&Data_a[0], src_s.data() + l_run_u32, (l_n_u32 - l_run_u32) * sizeof(T));
+    }
+    TOOL_RING_STORE_REL(Head_u, static_cast<Tool_cfgIdx_t>(l_head_u + l_n_u32));
+
+    return l_n_u32;
+  }
+
+  std::uint32_t PopN(std::span<T> dst_s) noexcept {
+    Tool_cfgIdx_t l_tail_u = Tail_u;
+    std::uint32_t l_want_u32 = static_cast<std::uint32_t>((dst_s.size() > N) ? N : dst_s.size());
+    std::uint32_t l_used_u32 = Used(l_tail_u, l_want_u32);
+    std::uint32_t l_n_u32 = (l_want_u32 > l_used_u32) ? l_used_u32 : l_want_u32;
+
+    if(l_n_u32 != 0U) {
+      std::uint32_t l_pos_u32 = l_tail_u & (N - 1U);
+      std::uint32_t l_run_u32 = ((N - l_pos_u32) > l_n_u32) ? l_n_u32 : (N - l_pos_u32);
+
+      std::memcpy(dst_s.data(), &Data_a[l_pos_u32], l_run_u32 * sizeof(T));
+      std::memcpy(dst_s.data() + l_run_u32, &Data_a[0], (l_n_u32 - l_run_u32) * sizeof(T));
+    }
+    TOOL_RING_STORE_REL(Tail_u, static_cast<Tool_cfgIdx_t>(l_tail_u + l_n_u32));
+
+    return l_n_u32;
+  }
+
+private:
+  /* Producer side: free slots, refreshing the cached tail only when short. */
+  std::uint32_t Free(Tool_cfgIdx_t head_u, std::uint32_t want_u32) noexcept {
+    std::uint32_t l_free_u32 = N - static_cast<Tool_cfgIdx_t>(head_u - TailCache_u);
+
+    if(l_free_u32 < want_u32) {
+      TailCache_u = TOOL_RING_LOAD_ACQ(Tail_u);
+      l_free_u32 = N - static_cast<Tool_cfgIdx_t>(head_u - TailCache_u);
+    }
+
+    return l_free_u32;
+  }
+
+  /* Consumer side: queued elements, refreshing the cached head only when short. */
+  std::uint32_t Used(Tool_cfgIdx_t tail_u, std::uint32_t want_u32) noexcept {
+    std::uint32_t l_used_u32 = static_cast<Tool_cfgIdx_t>(HeadCache_u - tail_u);
+
+    /* Above N: an overwriting push moved Tail_u past the cached head. */
+    if((l_used_u32 < want_u32) || (l_used_u32 > N)) {
+      HeadCache_u = TOOL_RING_LOAD_ACQ(Head_u);
+      l_used_u32 = static_cast<Tool_cfgIdx_t>(HeadCache_u - tail_u);
+    }
+
+    return l_used_u32;
+  }
+
+  alignas(TOOL_RING_LINE_U32) Tool_cfgIdx_t Head_u = 0U; /* Free-running write index (producer line). */
+  Tool_cfgIdx_t TailCache_u = 0U;                        /* Producer's last view of Tail_u. */
+  alignas(TOOL_RING_LINE_U32) Tool_cfgIdx_t Tail_u = 0U; /* Free-running read index (consumer line). */
+  Tool_cfgIdx_t HeadCache_u = 0U;                        /* Consumer's last view of Head_u. */
+  alignas(TOOL_RING_LINE_U32) std::array<T, N> Data_a{};
+};
+
+} // namespace Tool
+
+#endif /* TOOL_HPP */
+
+/** @} */
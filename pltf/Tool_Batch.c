@@ -0,0 +1,226 @@
+/**
+ * \file Tool_Batch.c
+ * \brief Tool module batch engine: many byte channels in struct-of-arrays layout.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * \defgroup Tool_Batch Tool Batch Engine
+ * @{
+ */
+
+#include "Tool_Batch.h"
+#include <stddef.h>
+#include <string.h>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_BATCH_NONE_U8 (0U)   /* Step leaves the channel unchanged. */
+#define TOOL_BATCH_XOR_U8 (1U)    /* Every queued byte XORed once, no rotation. */
+#define TOOL_BATCH_ROTATE_U8 (2U) /* Rotation by N mod count plus partial XOR. */
+
+/*==================[local data]=============================================*/
+
+/* Work class per fill level; depends on TOOL_BUFFER_SIZE_U32 only. */
+static uint8_t Class_au8[TOOL_BUFFER_SIZE_U32 + 1U];
+
+/*==================[local functions]========================================*/
+
+static void Tool_BatchXor(uint8_t *row_pu8, uint32_t tail_u32, uint32_t count_u32, uint8_t x_u8) {
+  uint32_t l_run_u32 = ((TOOL_BUFFER_SIZE_U32 - tail_u32) < count_u32) ? (TOOL_BUFFER_SIZE_U32 - tail_u32) : count_u32;
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < l_run_u32; l_i_u32++) {
+    row_pu8[tail_u32 + l_i_u32] ^= x_u8;
+  }
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < (count_u32 - l_run_u32); l_i_u32++) {
+    row_pu8[l_i_u32] ^= x_u8;
+  }
+}
+
+static void Tool_BatchRotate(uint8_t *row_pu8, uint32_t tail_u32, uint32_t count_u32, uint8_t x_u8) {
+  uint32_t l_rot_u32 = TOOL_BUFFER_SIZE_U32 % count_u32;
+  uint8_t l_even_u8 = (((TOOL_BUFFER_SIZE_U32 / count_u32) & 1U) != 0U) ? x_u8 : 0U; /* Visited N/c times. */
+  uint8_t l_odd_u8 = (uint8_t)(l_even_u8 ^ x_u8);                                     /* Visited N/c + 1 times. */
+  uint8_t l_lin_u8[TOOL_BUFFER_SIZE_U32];
+  uint32_t l_pos_u32 = tail_u32;
+
+  for(uint32_t l_m_u32 = 0U; l_m_u32 < count_u32; l_m_u32++) {
+    l_lin_u8[l_m_u32] = row_pu8[l_pos_u32];
+    l_pos_u32 = ((l_pos_u32 + 1U) == TOOL_BUFFER_SIZE_U32) ? 0U : (l_pos_u32 + 1U);
+  }
+
+  /* New element m is old element j = (m + rot) mod c; j < rot got one more visit. */
+  l_pos_u32 = tail_u32;
+  for(uint32_t l_m_u32 = 0U; l_m_u32 < count_u32; l_m_u32++) {
+    uint32_t l_j_u32 = l_m_u32 + l_rot_u32;
+
+    l_j_u32 = (l_j_u32 >= count_u32) ? (l_j_u32 - count_u32) : l_j_u32;
+    row_pu8[l_pos_u32] = (uint8_t)(l_lin_u8[l_j_u32] ^ ((l_j_u32 < l_rot_u32) ? l_odd_u8 : l_even_u8));
+    l_pos_u32 = ((l_pos_u32 + 1U) == TOOL_BUFFER_SIZE_U32) ? 0U : (l_pos_u32 + 1U);
+  }
+}
+
+/*==================[global functions]=======================================*/
+
+uint8_t Tool_BatchInit_u8(Tool_batch_t *batch_ps, uint32_t n_u32) {
+  uint8_t l_ret_u8 = 0U;
+
+  if(batch_ps == NULL) {
+    l_ret_u8 = 3U;
+  } else if((n_u32 == 0U) || (n_u32 > TOOL_CFG_BATCH_CHANNELS_U32)) {
+    l_ret_u8 = 2U;
+  } else {
+    Class_au8[0] = TOOL_BATCH_NONE_U8;
+    for(uint32_t l_c_u32 = 1U; l_c_u32 <= TOOL_BUFFER_SIZE_U32; l_c_u32++) {
+      if((TOOL_BUFFER_SIZE_U32 % l_c_u32) != 0U) {
+        Class_au8[l_c_u32] = TOOL_BATCH_ROTATE_U8;
+      } else {
+        Class_au8[l_c_u32] = (((TOOL_BUFFER_SIZE_U32 / l_c_u32) & 1U) != 0U) ? TOOL_BATCH_XOR_U8 : TOOL_BATCH_NONE_U8;
+      }
+    }
+
+    (void)memset(batch_ps, 0, sizeof(*batch_ps));
+    for(uint32_t l_ch_u32 = 0U; l_ch_u32 < TOOL_BATCH_SLOTS_U32; l_ch_u32++) {
+      batch_ps->period_au32[l_ch_u32] = 1U;
+      batch_ps->due_au32[l_ch_u32] = 1U;
+    }
+    batch_ps->n_u32 = n_u32;
+  }
+
+  return l_ret_u8;
+}
+
+uint8_t Tool_BatchSetMode_u8(Tool_batch_t *batch_ps, uint32_t ch_u32, Tool_mode_e mode, uint8_t key_u8) {
+  uint8_t l_ret_u8 = 0U;
+
+  if((batch_ps == NULL) || (ch_u32 >= batch_ps->n_u32)) {
+    l_ret_u8 = 2U;
+  } else if((mode != Tool_modeIdle_e) && (mode != Tool_modeRun_e) && (mode != Tool_modeDiag_e)) {
+    l_ret_u8 = 1U;
+  } else {
+    batch_ps->mode_au8[ch_u32] = (uint8_t)mode;
+    batch_ps->key_au8[ch_u32] = key_u8;
+  }
+
+  return l_ret_u8;
+}
+
+uint8_t Tool_BatchSetCadence_u8(Tool_batch_t *batch_ps, uint32_t ch_u32, uint32_t period_u32) {
+  uint8_t l_ret_u8 = 0U;
+
+  if((batch_ps == NULL) || (ch_u32 >= batch_ps->n_u32)) {
+    l_ret_u8 = 2U;
+  } else if(period_u32 == 0U) {
+    l_ret_u8 = 1U;
+  } else {
+    batch_ps->period_au32[ch_u32] = period_u32;
+    batch_ps->due_au32[ch_u32] = 1U;
+  }
+
+  return l_ret_u8;
+}
+
+uint8_t Tool_BatchPush_u8(Tool_batch_t *batch_ps, uint32_t ch_u32, uint8_t value_u8) {
+  uint8_t l_ret_u8 = 0U;
+
+  if((batch_ps == NULL) || (ch_u32 >= batch_ps->n_u32)) {
+    l_ret_u8 = 2U;
+  } else if(batch_ps->count_au32[ch_u32] >= TOOL_BUFFER_SIZE_U32) {
+    l_ret_u8 = 1U;
+  } else {
+    batch_ps->data_au8[ch_u32][batch_ps->head_au32[ch_u32]] = value_u8;
+    batch_ps->head_au32[ch_u32] = (batch_ps->head_au32[ch_u32] + 1U) % TOOL_BUFFER_SIZE_U32;
+    batch_ps->count_au32[ch_u32]++;
+  }
+
+  return l_ret_u8;
+}
+
+uint8_t Tool_BatchPop_u8(Tool_batch_t *batch_ps, uint32_t ch_u32, uint8_t *value_pu8) {
+  uint8_t l_ret_u8 = 0U;
+
+  if(value_pu8 == NULL) {
+    l_ret_u8 = 3U;
+  } else if((batch_ps == NULL) || (ch_u32 >= batch_ps->n_u32)) {
+    l_ret_u8 = 2U;
+  } else if(batch_ps->count_au32[ch_u32] == 0U) {
+    *value_pu8 = 0U;
+    l_ret_u8 = 1U;
+  } else {
+    uint32_t l_tail_u32 = batch_ps->tail_au32[ch_u32];
+
+    *value_pu8 = batch_ps->data_au8[ch_u32][l_tail_u32];
+    batch_ps->data_au8[ch_u32][l_tail_u32] = 0U;
+    batch_ps->tail_au32[ch_u32] = (l_tail_u32 + 1U) % TOOL_BUFFER_SIZE_U32;
+    batch_ps->count_au32[ch_u32]--;
+  }
+
+  return l_ret_u8;
+}
+
+uint8_t Tool_ProcessBlocks_u8(Tool_batch_t *batch_ps, uint32_t first_u32, uint32_t blocks_u32) {
+  uint8_t l_ret_u8 = 0U;
+  uint32_t l_inUse_u32 = (batch_ps != NULL) ? (((batch_ps->n_u32 + TOOL_BATCH_BLOCK_U32) - 1U) / TOOL_BATCH_BLOCK_U32) : 0U;
+
+  if((batch_ps == NULL) || (first_u32 > l_inUse_u32) || (blocks_u32 > (l_inUse_u32 - first_u32))) {
+    l_ret_u8 = 2U;
+  } else {
+    uint32_t l_lo_u32 = first_u32 * TOOL_BATCH_BLOCK_U32;
+    uint32_t l_hi_u32 = (first_u32 + blocks_u32) * TOOL_BATCH_BLOCK_U32;
+
+    l_hi_u32 = (l_hi_u32 > batch_ps->n_u32) ? batch_ps->n_u32 : l_hi_u32;
+
+    /* Bookkeeping across channels, one block at a time: fixed trip count, no
+     * branches, so each inner loop becomes a few vector instructions. Slots
+     * past n_u32 stay IDLE and empty. */
+    for(uint32_t l_b_u32 = first_u32; l_b_u32 < (first_u32 + blocks_u32); l_b_u32++) {
+      uint32_t l_base_u32 = l_b_u32 * TOOL_BATCH_BLOCK_U32;
+      uint32_t *l_cycle_pu32 = &batch_ps->cycle_au32[l_base_u32];
+      uint32_t *l_due_pu32 = &batch_ps->due_au32[l_base_u32];
+      const uint32_t *l_period_pcu32 = &batch_ps->period_au32[l_base_u32];
+      const uint8_t *l_mode_pcu8 = &batch_ps->mode_au8[l_base_u32];
+      const uint32_t *l_count_pcu32 = &batch_ps->count_au32[l_base_u32];
+      uint8_t *l_class_pu8 = &batch_ps->class_au8[l_base_u32];
+      uint8_t l_step_au8[TOOL_BATCH_BLOCK_U32];
+
+      for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BATCH_BLOCK_U32; l_i_u32++) {
+        uint32_t l_due_u32 = l_due_pu32[l_i_u32] - 1U;
+        uint32_t l_step_u32 = (l_due_u32 == 0U) ? 1U : 0U;
+
+        l_cycle_pu32[l_i_u32] += l_step_u32;
+        l_due_pu32[l_i_u32] = l_due_u32 + (l_period_pcu32[l_i_u32] * l_step_u32);
+        l_step_au8[l_i_u32] = (uint8_t)(0U - l_step_u32);
+      }
+      for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BATCH_BLOCK_U32; l_i_u32++) {
+        l_class_pu8[l_i_u32] = (uint8_t)(l_step_au8[l_i_u32] & ((l_mode_pcu8[l_i_u32] == (uint8_t)Tool_modeRun_e) ? 0xFFU : 0U));
+      }
+      for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_BATCH_BLOCK_U32; l_i_u32++) {
+        l_class_pu8[l_i_u32] &= Class_au8[l_count_pcu32[l_i_u32]];
+      }
+    }
+
+    /* Data pass: only channels whose content actually changes. */
+    for(uint32_t l_ch_u32 = l_lo_u32; l_ch_u32 < l_hi_u32; l_ch_u32++) {
+      uint8_t l_class_u8 = batch_ps->class_au8[l_ch_u32];
+
+      if(l_class_u8 != TOOL_BATCH_NONE_U8) {
+        uint8_t l_x_u8 = (uint8_t)((uint8_t)batch_ps->cycle_au32[l_ch_u32] ^ batch_ps->key_au8[l_ch_u32]);
+
+        if(l_class_u8 == TOOL_BATCH_XOR_U8) {
+          Tool_BatchXor(batch_ps->data_au8[l_ch_u32], batch_ps->tail_au32[l_ch_u32], batch_ps->count_au32[l_ch_u32], l_x_u8);
+        } else {
+          Tool_BatchRotate(batch_ps->data_au8[l_ch_u32], batch_ps->tail_au32[l_ch_u32], batch_ps->count_au32[l_ch_u32], l_x_u8);
+        }
+      }
+    }
+  }
+
+  return l_ret_u8;
+}
+
+void Tool_ProcessAll(Tool_batch_t *batch_ps) {
+  if(batch_ps != NULL) {
+    (void)Tool_ProcessBlocks_u8(batch_ps, 0U, ((batch_ps->n_u32 + TOOL_BATCH_BLOCK_U32) - 1U) / TOOL_BATCH_BLOCK_U32);
+  }
+}
+
+/** @} */
@@ -0,0 +1,239 @@
+/**
+ * \file Tool_Batch.h
+ * \brief Tool module batch engine: many byte channels in struct-of-arrays layout.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * A `Tool_batch_t` holds up to `TOOL_CFG_BATCH_CHANNELS_U32` independent
+ * channels, each a byte ring of `TOOL_BUFFER_SIZE_U32` slots with the same
+ * semantics as the module singleton. Heads, tails, counts, modes, cycle
+ * counters and XOR keys live in one array per field, so `Tool_ProcessAll()`
+ * walks them in blocks of `TOOL_BATCH_BLOCK_U32` channels with fixed-length,
+ * branch-free loops that the compiler turns into vector code already at
+ * -O2, instead of paying a call and a dozen branches per channel.
+ *
+ * `Tool_ProcessAll()` applies one `Tool_Process()` step to every channel:
+ * each channel's cycle counter advances, and every RUN channel holding data
+ * gets its content rotated and XORed exactly as `Tool_Process()` would do,
+ * with the XOR byte `(uint8_t)cycle ^ key`. Key 0 reproduces `Tool_Process()`
+ * bit for bit. Instead of 2 * `TOOL_BUFFER_SIZE_U32` pop/push calls the
+ * result is computed in closed form; fill levels that divide the buffer size
+ * an even number of times are left unchanged by a step and cost nothing.
+ *
+ * Each channel has a cadence: with period `p` it is stepped on every `p`-th
+ * call only (its cycle counter advances on those calls only), as if
+ * `Tool_Process()` were called for it at that lower rate. The default is 1.
+ *
+ * `Tool_ProcessBlocks_u8()` runs the same step on a block-aligned slice of
+ * the bank, so disjoint slices can be stepped from different threads (see
+ * Tool_Pool.h).
+ *
+ * Channels have no status flags and no trace; a rejected push is reported by
+ * the return code only.
+ *
+ * \defgroup Tool_Batch Tool Batch Engine
+ * @{
+ */
+
+#ifndef TOOL_BATCH_H
+#define TOOL_BATCH_H
+
+#include "Tool.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================[macros]=================================================*/
+
+#define TOOL_BATCH_BLOCK_U32 (16U) /* Channels per bookkeeping block (vector width in bytes). */
+
+/* Array length: channels rounded up to whole blocks. */
+#define TOOL_BATCH_SLOTS_U32 (((TOOL_CFG_BATCH_CHANNELS_U32 + TOOL_BATCH_BLOCK_U32) - 1U) / TOOL_BATCH_BLOCK_U32 * TOOL_BATCH_BLOCK_U32)
+
+/*==================[types]==================================================*/
+
+/**
+ * \brief Channel bank, one array per field (struct of arrays).
+ */
+typedef struct {
+  uint32_t head_au32[TOOL_BATCH_SLOTS_U32];                     /**< Write index per channel. */
+  uint32_t tail_au32[TOOL_BATCH_SLOTS_U32];                     /**< Read index per channel. */
+  uint32_t count_au32[TOOL_BATCH_SLOTS_U32];                    /**< Fill level per channel. */
+  uint32_t cycle_au32[TOOL_BATCH_SLOTS_U32];                    /**< Process cycle counter per channel. */
+  uint32_t period_au32[TOOL_BATCH_SLOTS_U32];                   /**< Cadence: step every period-th call (>= 1). */
+  uint32_t due_au32[TOOL_BATCH_SLOTS_U32];                      /**< Calls left until the next step. */
+  uint8_t mode_au8[TOOL_BATCH_SLOTS_U32];                       /**< Tool_mode_e per channel. */
+  uint8_t key_au8[TOOL_BATCH_SLOTS_U32];                        /**< XOR key per channel. */
+  uint8_t class_au8[TOOL_BATCH_SLOTS_U32];                      /**< Scratch: work class of the current step. */
+  uint8_t data_au8[TOOL_BATCH_SLOTS_U32][TOOL_BUFFER_SIZE_U32]; /**< Ring storage, one row per channel. */
+  uint32_t n_u32;                                               /**< Channels in use. */
+} Tool_batch_t;
+
+/*==================[function prototypes]====================================*/
+
+/**
+ * @brief Reset a channel bank.
+ *
+ * @details
+ * All channels empty, IDLE, key 0, cycle counter 0, cadence 1.
+ *
+ * @param batch_ps
+ * Channel bank.
+ *
+ * @param n_u32
+ * Channels in use (1 .. `TOOL_CFG_BATCH_CHANNELS_U32`).
+ *
+ * @return uint8_t
+ * - 0: Success.
+ * - 2: `n_u32` out of range (bank left untouched).
+ * - 3: `batch_ps` is NULL.
+ */
+uint8_t Tool_BatchInit_u8(Tool_batch_t *batch_ps, uint32_t n_u32);
+
+/**
+ * @brief Set the operating mode and XOR key of one channel.
+ *
+ * @param batch_ps
+ * Channel bank.
+ *
+ * @param ch_u32
+ * Channel index.
+ *
+ * @param mode
+ * New mode.
+ *
+ * @param key_u8
+ * XOR key combined with the channel's cycle counter.
+ *
+ * @return uint8_t
+ * - 0: Success.
+ * - 1: Invalid mode.
+ * - 2: Invalid channel or NULL bank.
+ */
+uint8_t Tool_BatchSetMode_u8(Tool_batch_t *batch_ps, uint32_t ch_u32, Tool_mode_e mode, uint8_t key_u8);
+
+/**
+ * @brief Set the cadence of one channel.
+ *
+ * @details
+ * The channel is stepped on every `period_u32`-th `Tool_ProcessAll()` (or
+ * `Tool_ProcessBlocks_u8()`) call, starting with the next one.
+ *
+ * @param batch_ps
+ * Channel bank.
+ *
+ * @param ch_u32
+ * Channel index.
+ *
+ * @param period_u32
+ * Calls per step (>= 1; 1 steps on every call).
+ *
+ * @return uint8_t
+ * - 0: Success.
+ * - 1: `period_u32` is 0.
+ * - 2: Invalid channel or NULL bank.
+ */
+uint8_t Tool_BatchSetCadence_u8(Tool_batch_t *batch_ps, uint32_t ch_u32, uint32_t period_u32);
+
+/**
+ * @brief Push one byte into a channel.
+ *
+ * @return uint8_t
+ * - 0: Success.
+ * - 1: Channel full.
+ * - 2: Invalid channel or NULL bank.
+ */
+uint8_t Tool_BatchPush_u8(Tool_batch_t *batch_ps, uint32_t ch_u32, uint8_t value_u8);
+
+/**
+ * @brief Pop one byte from a channel (the slot is cleared).
+ *
+ * @return uint8_t
+ * - 0: Success.
+ * - 1: Channel empty (`*value_pu8 = 0`).
+ * - 2: Invalid channel or NULL bank.
+ * - 3: `value_pu8` is NULL.
+ */
+uint8_t Tool_BatchPop_u8(Tool_batch_t *batch_ps, uint32_t ch_u32, uint8_t *value_pu8);
+
+/**
+ * @brief Run one process step on every channel of the bank.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Replace a loop of per-channel `Tool_Process()` calls by one pass over the
+ * struct-of-arrays bank. The result per channel equals `Tool_Process()` on a
+ * module holding that channel's state, with XOR byte `(uint8_t)cycle ^ key`.
+ *
+ * Effect of one step on a RUN channel with fill level `c` (N =
+ * `TOOL_BUFFER_SIZE_U32`): the N pop/push pairs of `Tool_Process()` rotate
+ * the queued sequence by `N mod c` and XOR element `j` once per visit, i.e.
+ * `N / c + (j < N mod c)` times. Head and tail return to where they were.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range          | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|------|----------------|------|
+ * | batch_ps       | X  |  X  | Tool_batch_t*               | inout |   1    |   0    |   1  | pointer / NULL | [-]  |
+ * | cycle_au32     | X  |  X  | uint32_t[]                  |   -   |   1    |   0    |   n  | -              | [-]  |
+ * | mode_au8       | X  |     | uint8_t[]                   |   -   |   1    |   0    |   n  | Tool_mode_e    | [-]  |
+ * | count_au32     | X  |     | uint32_t[]                  |   -   |   1    |   0    |   n  | 0..N           | [-]  |
+ * | data_au8       | X  |  X  | uint8_t[][N]                |   -   |   1    |   0    |  n*N | -              | [-]  |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :due[] -= 1; due channels: due[] = period[], cycle[] += 1 (vector);
+ * :class[] = (due && mode == RUN) ? class of count : NONE (vector + table);
+ * repeat :next channel with class != NONE;
+ *   if (XOR: N mod count == 0, N / count odd) then (yes)
+ *     :XOR queued bytes with (uint8_t)cycle ^ key;
+ *   else (ROTATE: N mod count != 0)
+ *     :rotate queued bytes by N mod count, XOR odd-visited ones;
+ *   endif
+ * repeat while (more channels)
+ * stop
+ * @enduml
+ *
+ * @param batch_ps
+ * Channel bank; NULL is ignored.
+ *
+ * @return void
+ */
+void Tool_ProcessAll(Tool_batch_t *batch_ps);
+
+/**
+ * @brief Run one process step on a slice of the bank.
+ *
+ * @details
+ * Same as `Tool_ProcessAll()` restricted to channels
+ * [`first_u32` * `TOOL_BATCH_BLOCK_U32`, (`first_u32` + `blocks_u32`) *
+ * `TOOL_BATCH_BLOCK_U32`). Calls on disjoint slices touch disjoint memory
+ * and may run concurrently.
+ *
+ * @param batch_ps
+ * Channel bank.
+ *
+ * @param first_u32
+ * First block.
+ *
+ * @param blocks_u32
+ * Number of blocks.
+ *
+ * @return uint8_t
+ * - 0: Success.
+ * - 2: Slice outside the channels in use, or NULL bank.
+ */
+uint8_t Tool_ProcessBlocks_u8(Tool_batch_t *batch_ps, uint32_t first_u32, uint32_t blocks_u32);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOL_BATCH_H */
+
+/** @} */
@@ -0,0 +1,317 @@
+/**
+ * \file Tool_Co.hpp
+ * \brief C++20 coroutine facade over Tool::Ring (header only).
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * A consumer coroutine writes `co_await channel.Read(dst)` and is suspended
+ * until `dst.size()` elements are queued, instead of polling `Pop()` in a loop
+ * or sleeping. The producer (any thread) pushes through the channel; when a
+ * push satisfies the pending request, the waiting coroutine is handed to a
+ * single-threaded `Tool::Co::Executor`, which resumes it on its own thread.
+ *
+ * Example:
+ * @code
+ * Tool::Co::Executor l_exec;
+ * Tool::Co::Channel<std::uint8_t, 256U> l_ch(l_exec);
+ *
+ * Tool::Co::Task Consumer(Tool::Co::Executor &exec, Tool::Co::Channel<std::uint8_t, 256U> &ch) {
+ *   std::array<std::uint8_t, 8U> l_msg_a;
+ *
+ *   co_await exec.Schedule();
+ *   for(;;) {
+ *     (void)co_await ch.Read(l_msg_a);
+ *     ...
+ *   }
+ * }
+ * @endcode
+ *
+ * Limits: one consumer coroutine per channel (SPSC), one producer context.
+ * The producer runs on another thread than the reader, so the header needs
+ * `TOOL_CFG_CONCURRENCY=SPSC` (atomic ring indices).
+ *
+ * \defgroup Tool_Co Tool Coroutine Facade
+ * @{
+ */
+
+#ifndef TOOL_CO_HPP
+#define TOOL_CO_HPP
+
+#include "Tool.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <span>
+
+#if(TOOL_CFG_CONCURRENCY != TOOL_CFG_CONC_SPSC)
+#error "Tool_Co.hpp: producer and reader run on different threads (use CONCURRENCY=SPSC)"
+#endif
+
+namespace Tool::Co {
+
+/*==================[types]==================================================*/
+
+/**
+ * \brief Detached coroutine: starts eagerly and frees itself when done.
+ */
+struct Task {
+  struct promise_type {
+    Task get_return_object() noexcept { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+};
+
+/**
+ * @brief Single-threaded executor resuming coroutines in posting order.
+ *
+ * @details
+ * `Post()` may be called from any thread; `Run()` executes on the calling
+ * thread and sleeps on a condition variable while nothing is ready, so an
+ * idle consumer costs no CPU. The ready queue is a `Tool::Ring` of handles;
+ * its capacity bounds the number of coroutines waiting at the same time.
+ *
+ * @tparam N
+ * Ready-queue capacity (power of two).
+ */
+template <std::uint32_t N = 64U>
+class BasicExecutor {
+public:
+  /**
+   * @brief Queue a coroutine for resumption on the executor thread.
+   *
+   * @return std::uint8_t
+   * 0 queued, 1 ready queue full (handle not queued).
+   */
+  std::uint8_t Post(std::coroutine_handle<> handle) noexcept {
+    std::uint8_t l_ret_u8;
+
+    {
+      std::lock_guard<std::mutex> l_lock(Mtx_s);
+      l_ret_u8 = Ready_s.Push(handle);
+    }
+    Cv_s.notify_one();
+
+    return l_ret_u8;
+  }
+
+  /**
+   * @brief Resume queued coroutines until `Stop()` is called.
+   */
+  void Run() noexcept {
+    std::unique_lock<std::mutex> l_lock(Mtx_s);
+
+    while(!Stop_b) {
+      std::coroutine_handle<> l_h;
+
+      if(Ready_s.Pop(l_h) == 0U) {
+        l_lock.unlock();
+        l_h.resume();
+        l_lock.lock();
+      } else {
+        Cv_s.wait(l_lock);
+      }
+    }
+    Stop_b = false;
+  }
+
+  /**
+   * @brief Resume everything that is ready now, without blocking.
+   *
+   * @return std::uint32_t
+   * Number of coroutines resumed.
+   */
+  std::uint32_t Poll() noexcept {
+    std::uint32_t l_n_u32 = 0U;
+    std::coroutine_handle<> l_h;
+
+    while(PopReady(l_h)) {
+      l_h.resume();
+      l_n_u32++;
+    }
+
+    return l_n_u32;
+  }
+
+  /**
+   * @brief Make `Run()` return once the current coroutine suspends.
+   */
+  void Stop() noexcept {
+    {
+      std::lock_guard<std::mutex> l_lock(Mtx_s);
+      Stop_b = true;
+    }
+    Cv_s.notify_one();
+  }
+
+  /**
+   * @brief Awaitable that moves the awaiting coroutine onto the executor.
+   *
+   * If the ready queue is full the coroutine is not suspended and simply
+   * continues on the calling thread.
+   */
+  auto Schedule() noexcept {
+    struct Awaiter {
+      BasicExecutor *Exec_p;
+
+      bool await_ready() const noexcept { return false; }
+      bool await_suspend(std::coroutine_handle<> handle) const noexcept { return Exec_p->Post(handle) == 0U; }
+      void await_resume() const noexcept {}
+    };
+
+    return Awaiter{this};
+  }
+
+private:
+  bool PopReady(std::coroutine_handle<> &handle) noexcept {
+    std::lock_guard<std::mutex> l_lock(Mtx_s);
+
+    return Ready_s.Pop(handle) == 0U;
+  }
+
+  std::mutex Mtx_s;
+  std::condition_variable Cv_s;
+  Tool::Ring<std::coroutine_handle<>, N> Ready_s;
+  bool Stop_b = false;
+};
+
+using Executor = BasicExecutor<>;
+
+/**
+ * @brief Ring with an awaitable read side.
+ *
+ * @details
+ * The producer calls `Push()` / `Write()` (or pushes into `Ring()` directly
+ * and then calls `Commit()`). The wake-up is issued only when the pending
+ * request can be served, so a reader waiting for 8 elements is not resumed
+ * for every single byte.
+ *
+ * Lost wake-ups are excluded with the usual store/fence/load pairing: the
+ * reader publishes its handle and then re-checks the fill level, the producer
+ * publishes the data and then checks for a handle; whichever side takes the
+ * handle out of `Waiter_p` resumes the coroutine.
+ *
+ * @tparam T
+ * Element type.
+ *
+ * @tparam N
+ * Capacity in elements (power of two).
+ *
+ * @tparam E
+ * Executor type.
+ */
+template <typename T, std::uint32_t N, typename E = Executor>
+class Channel {
+public:
+  explicit Channel(E &exec) noexcept : Exec_s(exec) {}
+
+  Channel(const Channel &) = delete;
+  Channel &operator=(const Channel &) = delete;
+
+  /** Underlying ring, e.g. for bulk pushes followed by `Commit()`. */
+  Tool::Ring<T, N> &Ring() noexcept { return Ring_s; }
+
+  std::uint8_t Push(const T &value) noexcept {
+    std::uint8_t l_ret_u8 = Ring_s.Push(value);
+
+    Commit();
+
+    return l_ret_u8;
+  }
+
+  std::uint32_t Write(std::span<const T> src_s) noexcept {
+    std::uint32_t l_n_u32 = Ring_s.PushN(src_s);
+
+    Commit();
+
+    return l_n_u32;
+  }
+
+  /**
+   * @brief Producer side: resume the reader if its request is now satisfied.
+   *
+   * If the executor's ready queue is full, the handle is put back into
+   * `Waiter_p`. The reader stays armed, and the next `Commit()` (or `Push()`
+   * / `Write()`) retries the hand-over.
+   *
+   * @return std::uint8_t
+   * 0 nothing to do or reader handed over, 1 ready queue full (reader still
+   * waiting).
+   */
+  std::uint8_t Commit() noexcept {
+    std::uint8_t l_ret_u8 = 0U;
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    void *l_w_p = Waiter_p.load(std::memory_order_acquire);
+
+    if((l_w_p != nullptr) && (Ring_s.Count() >= Need_u32.load(std::memory_order_relaxed))) {
+      if(Waiter_p.compare_exchange_strong(l_w_p, nullptr, std::memory_order_acq_rel)) {
+        if(Exec_s.Post(std::coroutine_handle<>::from_address(l_w_p)) != 0U) {
+          /* The reader is suspended and this is the only producer: nobody
+           * else can have touched Waiter_p since the exchange. */
+          Waiter_p.store(l_w_p, std::memory_order_release);
+          l_ret_u8 = 1U;
+        }
+      }
+    }
+
+    return l_ret_u8;
+  }
+
+  /**
+   * @brief Awaitable filling `dst_s` completely.
+   *
+   * Requests larger than the capacity are served with `N` elements.
+   * `co_await` yields the number of elements copied.
+   */
+  auto Read(std::span<T> dst_s) noexcept {
+    struct Awaiter {
+      Channel *Ch_p;
+      std::span<T> Dst_s;
+
+      std::uint32_t Need() const noexcept { return static_cast<std::uint32_t>((Dst_s.size() > N) ? N : Dst_s.size()); }
+
+      bool await_ready() const noexcept { return Ch_p->Ring_s.Count() >= Need(); }
+
+      bool await_suspend(std::coroutine_handle<> handle) const noexcept {
+        bool l_suspend_b = true;
+        void *l_self_p = handle.address();
+
+        Ch_p->Need_u32.store(Need(), std::memory_order_relaxed);
+        Ch_p->Waiter_p.store(l_self_p, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        /* Data may have arrived before the handle was visible: take it back. */
+        if(Ch_p->Ring_s.Count() >= Need()) {
+          if(Ch_p->Waiter_p.compare_exchange_strong(l_self_p, nullptr, std::memory_order_acq_rel)) {
+            l_suspend_b = false;
+          }
+        }
+
+        return l_suspend_b;
+      }
+
+      std::uint32_t await_resume() const noexcept { return Ch_p->Ring_s.PopN(Dst_s.first(Need())); }
+    };
+
+    return Awaiter{this, dst_s};
+  }
+
+private:
+  E &Exec_s;
+  Tool::Ring<T, N> Ring_s;
+  std::atomic<void *> Waiter_p{nullptr};
+  std::atomic<std::uint32_t> Need_u32{0U};
+};
+
+} // namespace Tool::Co
+
+#endif /* TOOL_CO_HPP */
+
+/** @} */
@@ -0,0 +1,105 @@
+/**
+ * \file Tool_CrcN.h
+ * \brief Tool module CRC-32 of many independent buffers, interleaved.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * `Tool_ComputeCrc_u32()` is one long dependency chain: each byte step needs
+ * the register of the previous one, so a short frame leaves most execution
+ * units idle. `Tool_ComputeCrcN_u8()` runs `TOOL_CRCN_LANES_U32` frames side
+ * by side instead. The lanes advance together one 4-byte word at a time
+ * (single bytes for the tail), and their chains are independent: with the
+ * table engine the lookups of all lanes overlap in the pipeline, with the
+ * bitwise engine the lanes sit in one vector register and every bit step
+ * advances all of them.
+ *
+ * When a lane reaches the end of its frame, the result is stored and the
+ * next frame of the batch is loaded into that lane. Frames of mixed lengths
+ * therefore keep all lanes busy until the batch runs out. Every result is
+ * bit-identical to `Tool_ComputeCrc_u32()` on the same frame, including the
+ * `TOOL_MAX_CRC_LEN_U32` cap.
+ *
+ * \defgroup Tool_CrcN Tool Multi-Buffer CRC
+ * @{
+ */
+
+#ifndef TOOL_CRCN_H
+#define TOOL_CRCN_H
+
+#include "Tool_Cfg.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================[macros]=================================================*/
+
+#define TOOL_CRCN_LANES_U32 (4U) /* Frames in flight at once. */
+
+/*==================[function prototypes]====================================*/
+
+/**
+ * @brief CRC-32 of `n_u32` independent buffers.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Set `crc_au32[i] = Tool_ComputeCrc_u32(data_apcu8[i], length_au32[i])`
+ * for every `i` in `0..n_u32-1`, with the byte steps of up to
+ * `TOOL_CRCN_LANES_U32` buffers interleaved.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range          | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|------|----------------|------|
+ * | data_apcu8     | X  |     | const uint8_t *const[]      |   in  |   1    |   0    | n    | entries / NULL | [-]  |
+ * | length_au32    | X  |     | const uint32_t[]            |   in  |   1    |   0    | n    | -              | [B]  |
+ * | crc_au32       |    |  X  | uint32_t[]                  |  out  |   1    |   0    | n    | -              | [-]  |
+ * | n_u32          | X  |     | uint32_t                    |   in  |   1    |   0    |   1  | -              | [-]  |
+ * | returned val   |    |  X  | uint8_t                     |  out  |   1    |   0    |   1  | [0,3]          | [-]  |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (any array NULL and n_u32 != 0) then (null)
+ *   :return 3;
+ *   stop
+ * endif
+ * :empty or NULL buffers -> crc 0;
+ * :load up to LANES buffers into the lanes;
+ * while (lane active?) is (yes)
+ *   :m = shortest remaining length of the active lanes;
+ *   :m bytes, all lanes interleaved, by words then bytes (idle lanes shadow an active one);
+ *   :finished lanes -> store final CRC, load next buffer;
+ * endwhile
+ * :return 0;
+ * stop
+ * @enduml
+ *
+ * @param data_apcu8
+ * Buffers; an entry may be NULL (its CRC is 0, as for `Tool_ComputeCrc_u32()`).
+ *
+ * @param length_au32
+ * Length of each buffer; capped to `TOOL_MAX_CRC_LEN_U32`.
+ *
+ * @param crc_au32
+ * Receives the CRC of each buffer.
+ *
+ * @param n_u32
+ * Number of buffers; 0 does nothing.
+ *
+ * @return uint8_t
+ * - 0: Success.
+ * - 3: `data_apcu8`, `length_au32` or `crc_au32` is NULL while `n_u32 != 0`.
+ */
+uint8_t Tool_ComputeCrcN_u8(const uint8_t *const data_apcu8[], const uint32_t length_au32[], uint32_t crc_au32[], uint32_t n_u32);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOL_CRCN_H */
+
+/** @} */
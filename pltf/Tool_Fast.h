@@ -0,0 +1,336 @@
+/**
+ * \file Tool_Fast.h
+ * \brief Tool module unchecked fast-path interface (internal callers only).
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * The functions in this header skip every validation done by the checked API
+ * in Tool.h. They are meant for callers that have already established the
+ * preconditions (module initialized, space/data available), e.g. after one
+ * `Tool_GetSnapshot_u8()` for a whole burst. They do not update
+ * `Tool_StatusFlg_u32` and do not emit trace records, but they do bracket their
+ * update with the sequence counter so snapshots stay coherent.
+ *
+ * \defgroup Tool_Fast Tool Unchecked Fast Path
+ * @{
+ */
+
+#ifndef TOOL_FAST_H
+#define TOOL_FAST_H
+
+#include "Tool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================[macros]=================================================*/
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TOOL_LIKELY(cond) (__builtin_expect((int)((cond) != 0), 1) != 0)
+#define TOOL_UNLIKELY(cond) (__builtin_expect((int)((cond) != 0), 0) != 0)
+#define TOOL_COLD __attribute__((cold, noinline))
+#define TOOL_FENCE_ACQ() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define TOOL_FENCE_REL() __atomic_thread_fence(__ATOMIC_RELEASE)
+#else
+#error "Tool_Fast.h: provide branch hints and acquire/release fences for this compiler"
+#endif
+
+#define TOOL_CRC_INIT_U32 (0xFFFFFFFFUL)
+#define TOOL_CRC_POLY_U32 (0xEDB88320UL)
+
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+#define TOOL_CRC_BLOCKS_U32 (TOOL_BUFFER_SIZE_U32 / TOOL_CFG_CRC_BLOCK_U32)
+#endif
+
+#if(TOOL_CFG_CONCURRENCY == TOOL_CFG_CONC_SPSC)
+/* Writer side of the sequence counter: odd while the bookkeeping changes. */
+#define TOOL_SEQ_WRITE_BEGIN()        \
+  do {                                \
+    Tool_Seq_u32 = Tool_Seq_u32 + 1U; \
+    TOOL_FENCE_REL();                 \
+  } while(0)
+
+#define TOOL_SEQ_WRITE_END()          \
+  do {                                \
+    TOOL_FENCE_REL();                 \
+    Tool_Seq_u32 = Tool_Seq_u32 + 1U; \
+  } while(0)
+#else
+/* Single context: nothing can observe a partial update. */
+#define TOOL_SEQ_WRITE_BEGIN() \
+  do {                         \
+  } while(0)
+
+#define TOOL_SEQ_WRITE_END() \
+  do {                       \
+  } while(0)
+#endif
+
+/*==================[external data]==========================================*/
+
+/* Module state owned by Tool.c; exposed only for the inline functions below. */
+extern uint8_t Tool_Buffer_u8[TOOL_BUFFER_SIZE_U32];
+extern uint32_t Tool_Head_u32;
+extern uint32_t Tool_Tail_u32;
+extern uint32_t Tool_Count_u32;
+
+extern uint32_t Tool_StatusFlg_u32;
+extern Tool_mode_e Tool_Mode_e;
+
+#if(TOOL_CFG_CONCURRENCY == TOOL_CFG_CONC_SPSC)
+extern volatile uint32_t Tool_Seq_u32;
+#endif
+
+#if(TOOL_CFG_SHADOW != 0U)
+/* Raw CRC-32 register (no init, no final XOR) of the whole Tool_Buffer_u8 image. */
+extern uint32_t Tool_ShadowCrc_u32;
+/* Per position: x^(8 * (TOOL_BUFFER_SIZE_U32 - index) + 24) mod P, reflected. */
+extern uint32_t Tool_ShadowPow_u32[TOOL_BUFFER_SIZE_U32];
+/* Sliced self-test: next position to sweep, CRC terms of the positions before it. */
+extern uint32_t Tool_TstCursor_u32;
+extern uint32_t Tool_TstCrc_u32;
+#endif
+
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+/* Per block: sealed (full, CRC stored, not read since). */
+extern bool Tool_BlockSealed_b[TOOL_CRC_BLOCKS_U32];
+#endif
+
+/*==================[function prototypes]====================================*/
+
+/**
+ * @brief Out-of-line remainder of `Tool_Push_u8()` once the fast path is ruled out.
+ *
+ * @details
+ * Handles "not initialized" (ERR, returns 2), "full" (OVF, returns 1) and a
+ * successful push while the OVF flag is still set (clears it, returns 0).
+ *
+ * @param value_u8
+ * Byte value to push into the ring buffer.
+ *
+ * @return uint8_t
+ * Same return codes as `Tool_Push_u8()`.
+ */
+uint8_t Tool_PushSlow_u8(uint8_t value_u8);
+
+/**
+ * @brief Out-of-line remainder of `Tool_Pop_u8()` once the fast path is ruled out.
+ *
+ * @details
+ * Handles NULL pointer (ERR, returns 3), "not initialized" (ERR, returns 2)
+ * and "empty" (returns 1).
+ *
+ * @param value_pu8
+ * Output pointer receiving the popped byte.
+ *
+ * @return uint8_t
+ * Same return codes as `Tool_Pop_u8()`.
+ */
+uint8_t Tool_PopSlow_u8(uint8_t *value_pu8);
+
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+/**
+ * @brief Seal the block that the last push filled.
+ *
+ * @details
+ * Stores the CRC of the block's queued bytes (from `Tool_Tail_u32` if it lies in
+ * the block, else from the block start). Called inside the writer's sequence
+ * bracket when `Tool_Head_u32` reaches a block boundary.
+ *
+ * @return void
+ */
+void Tool_BlockSeal(void);
+
+/**
+ * @brief Check the sealed block at `Tool_Tail_u32` before its first byte is read.
+ *
+ * @details
+ * On a match the block is unsealed. On a mismatch `TOOL_STATUS_CRC_U32` is
+ * set and the queued bytes of the block are dropped.
+ *
+ * @return uint8_t
+ * - 0: Block intact.
+ * - 4: Block corrupted and dropped.
+ */
+uint8_t Tool_BlockVerify_u8(void);
+#endif
+
+/*==================[inline functions]=======================================*/
+
+#if(TOOL_CFG_SHADOW != 0U)
+/**
+ * @brief CRC term of one byte value at one buffer position.
+ *
+ * @details
+ * The CRC register is linear in the buffer bytes: the CRC of the whole
+ * image is the XOR of the terms `value * x^(8 * (N - index) + 24) mod P`
+ * of its positions. The product takes eight shift/XOR steps with no
+ * data-dependent branch, whatever the buffer size.
+ *
+ * @param index_u32
+ * Position (`< TOOL_BUFFER_SIZE_U32`).
+ *
+ * @param value_u8
+ * Byte value (or change of value).
+ *
+ * @return uint32_t
+ * Term to XOR into a raw CRC register of the image.
+ */
+static inline uint32_t Tool_ShadowTerm_u32(uint32_t index_u32, uint8_t value_u8) {
+  uint32_t l_pow_u32 = Tool_ShadowPow_u32[index_u32];
+  uint32_t l_crc_u32 = 0U;
+
+  for(uint32_t l_bit_u32 = 0U; l_bit_u32 < 8U; l_bit_u32++) {
+    l_crc_u32 ^= l_pow_u32 & (0U - (((uint32_t)value_u8 >> (7U - l_bit_u32)) & 1U));
+    l_pow_u32 = (l_pow_u32 >> 1U) ^ ((uint32_t)TOOL_CRC_POLY_U32 & (0U - (l_pow_u32 & 1U)));
+  }
+
+  return l_crc_u32;
+}
+
+/**
+ * @brief Fold a byte change at one buffer position into `Tool_ShadowCrc_u32`.
+ *
+ * @details
+ * Replacing `Tool_Buffer_u8[index_u32]` by a value differing in `delta_u8`
+ * changes the CRC of the whole image by the term of `delta_u8` at that
+ * position. A change behind the cursor of the sliced self-test is folded
+ * into its swept-region CRC too, so the sweep compares the current image.
+ *
+ * @param index_u32
+ * Position written (`< TOOL_BUFFER_SIZE_U32`).
+ *
+ * @param delta_u8
+ * Old value XOR new value.
+ *
+ * @return void
+ */
+static inline void Tool_ShadowUpd(uint32_t index_u32, uint8_t delta_u8) {
+  uint32_t l_term_u32 = Tool_ShadowTerm_u32(index_u32, delta_u8);
+
+  Tool_ShadowCrc_u32 ^= l_term_u32;
+  Tool_TstCrc_u32 ^= l_term_u32 & (0U - (uint32_t)(index_u32 < Tool_TstCursor_u32));
+}
+#endif
+
+/**
+ * @brief Push one byte without any check.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Straight-line store into the ring buffer for callers that guarantee the
+ * module is initialized and `Tool_Count_u32 < TOOL_BUFFER_SIZE_U32`.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range    | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|------|----------|------|
+ * | value_u8       | X  |     | uint8_t                     |   in  |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_Buffer_u8 |    |  X  | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64  | -        | [-]  |
+ * | Tool_Head_u32  | X  |  X  | uint32_t                    |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_Count_u32 | X  |  X  | uint32_t                    |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_Seq_u32   | X  |  X  | volatile uint32_t           |   -   |   1    |   0    |   1  | -        | [-]  |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Tool_Seq_u32++ (odd);
+ * :Tool_Buffer_u8[Tool_Head_u32] = value_u8;
+ * :Tool_Head_u32 = (Tool_Head_u32 + 1) % TOOL_BUFFER_SIZE_U32;
+ * :Tool_Count_u32++;
+ * :Tool_Seq_u32++ (even);
+ * stop
+ * @enduml
+ *
+ * @param value_u8
+ * Byte value to push into the ring buffer.
+ *
+ * @return void
+ */
+static inline void Tool_PushUnchecked(uint8_t value_u8) {
+  TOOL_SEQ_WRITE_BEGIN();
+
+#if(TOOL_CFG_SHADOW != 0U)
+  Tool_ShadowUpd(Tool_Head_u32, (uint8_t)(Tool_Buffer_u8[Tool_Head_u32] ^ value_u8));
+#endif
+  Tool_Buffer_u8[Tool_Head_u32] = value_u8;
+  Tool_Head_u32 = (Tool_Head_u32 + 1U) % TOOL_BUFFER_SIZE_U32;
+  Tool_Count_u32++;
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+  if((Tool_Head_u32 % TOOL_CFG_CRC_BLOCK_U32) == 0U) {
+    Tool_BlockSeal();
+  }
+#endif
+
+  TOOL_SEQ_WRITE_END();
+}
+
+/**
+ * @brief Pop one byte without any check.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Straight-line extraction from the ring buffer for callers that guarantee the
+ * module is initialized and `Tool_Count_u32 != 0`. The slot is cleared like in
+ * `Tool_Pop_u8()`. With `TOOL_CFG_CRC_BLOCK` the block CRC is not checked,
+ * only discarded (the block is unsealed).
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range    | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|------|----------|------|
+ * | Tool_Buffer_u8 | X  |  X  | uint8_t[TOOL_BUFFER_SIZE]   |   -   |   1    |   0    |  64  | -        | [-]  |
+ * | Tool_Tail_u32  | X  |  X  | uint32_t                    |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_Count_u32 | X  |  X  | uint32_t                    |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_Seq_u32   | X  |  X  | volatile uint32_t           |   -   |   1    |   0    |   1  | -        | [-]  |
+ * | returned val   |    |  X  | uint8_t                     |  out  |   1    |   0    |   1  | -        | [-]  |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :Tool_Seq_u32++ (odd);
+ * :l_val = Tool_Buffer_u8[Tool_Tail_u32];
+ * :Tool_Buffer_u8[Tool_Tail_u32] = 0;
+ * :Tool_Tail_u32 = (Tool_Tail_u32 + 1) % TOOL_BUFFER_SIZE_U32;
+ * :Tool_Count_u32--;
+ * :Tool_Seq_u32++ (even);
+ * :return l_val;
+ * stop
+ * @enduml
+ *
+ * @return uint8_t
+ * The oldest byte of the ring buffer.
+ */
+static inline uint8_t Tool_PopUnchecked_u8(void) {
+  uint8_t l_val_u8;
+
+  TOOL_SEQ_WRITE_BEGIN();
+
+  l_val_u8 = Tool_Buffer_u8[Tool_Tail_u32];
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+  Tool_BlockSealed_b[Tool_Tail_u32 / TOOL_CFG_CRC_BLOCK_U32] = false;
+#endif
+#if(TOOL_CFG_SHADOW != 0U)
+  Tool_ShadowUpd(Tool_Tail_u32, l_val_u8);
+#endif
+  Tool_Buffer_u8[Tool_Tail_u32] = 0U;
+  Tool_Tail_u32 = (Tool_Tail_u32 + 1U) % TOOL_BUFFER_SIZE_U32;
+  Tool_Count_u32--;
+
+  TOOL_SEQ_WRITE_END();
+
+  return l_val_u8;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOL_FAST_H */
+
+/** @} */
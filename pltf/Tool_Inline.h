@@ -0,0 +1,341 @@
+/**
+ * \file Tool_Inline.h
+ * \brief Tool module hot path as inline definitions.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * The checked push, pop, status and CRC functions are defined here once as
+ * `static inline` functions. Tool.c builds its out-of-line API on top of them,
+ * so both variants always share the same code.
+ *
+ * Opt-in: a translation unit that defines `TOOL_CFG_INLINE_HOT` before
+ * including this header gets `Tool_Push_u8()`, `Tool_Pop_u8()`,
+ * `Tool_GetStatus_u32()`, `Tool_GetSnapshot_u8()`, `Tool_ComputeCrc_u32()` and
+ * `Tool_CopyCrc_u32()` mapped to the inline definitions (function-like
+ * macros, so taking the address still yields the library function). The error paths stay out of
+ * line in the library (`Tool_PushSlow_u8()`, `Tool_PopSlow_u8()`).
+ *
+ * \defgroup Tool_Inline Tool Inline Hot Path
+ * @{
+ */
+
+#ifndef TOOL_INLINE_H
+#define TOOL_INLINE_H
+
+#include "Tool.h"
+#include "Tool_Fast.h"
+#include "Tool_Trc.h"
+#include <stddef.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================[external data]==========================================*/
+
+#if(TOOL_CFG_CRC_ENGINE == TOOL_CFG_CRC_TABLE)
+extern const uint32_t Tool_CrcTbl_u32[256];
+#endif
+
+/*==================[inline functions]=======================================*/
+
+/**
+ * @brief Inline definition of `Tool_Push_u8()` (same contract).
+ *
+ * @param value_u8
+ * Byte value to push into the ring buffer.
+ *
+ * @return uint8_t
+ * See `Tool_Push_u8()`.
+ */
+static inline uint8_t Tool_PushInl_u8(uint8_t value_u8) {
+  uint8_t l_ret_u8 = 0U;
+
+  /* Hot path: initialized, no pending overflow flag, space available. */
+  if(TOOL_LIKELY(((Tool_StatusFlg_u32 & (TOOL_STATUS_INIT_U32 | TOOL_STATUS_OVF_U32)) == TOOL_STATUS_INIT_U32) && (Tool_Count_u32 < TOOL_BUFFER_SIZE_U32))) {
+    Tool_PushUnchecked(value_u8);
+    l_ret_u8 = 0U;
+  } else {
+    l_ret_u8 = Tool_PushSlow_u8(value_u8);
+  }
+
+  TOOL_TRC(Tool_trcOpPush_e, l_ret_u8, Tool_Count_u32);
+
+  return l_ret_u8;
+}
+
+/**
+ * @brief Inline definition of `Tool_Pop_u8()` (same contract).
+ *
+ * @param value_pu8
+ * Output pointer receiving the popped byte.
+ *
+ * @return uint8_t
+ * See `Tool_Pop_u8()`.
+ */
+static inline uint8_t Tool_PopInl_u8(uint8_t *value_pu8) {
+  uint8_t l_ret_u8 = 0U;
+
+  /* Hot path: valid pointer, initialized, data available. */
+  if(TOOL_LIKELY((value_pu8 != NULL) && ((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) != 0U) && (Tool_Count_u32 != 0U))) {
+#if(TOOL_CFG_CRC_BLOCK_U32 != 0U)
+    /* First read from a sealed block: check it once. */
+    if(TOOL_UNLIKELY(Tool_BlockSealed_b[Tool_Tail_u32 / TOOL_CFG_CRC_BLOCK_U32])) {
+      l_ret_u8 = Tool_BlockVerify_u8();
+    }
+    *value_pu8 = (l_ret_u8 == 0U) ? Tool_PopUnchecked_u8() : 0U;
+#else
+    *value_pu8 = Tool_PopUnchecked_u8();
+    l_ret_u8 = 0U;
+#endif
+  } else {
+    l_ret_u8 = Tool_PopSlow_u8(value_pu8);
+  }
+
+  TOOL_TRC(Tool_trcOpPop_e, l_ret_u8, Tool_Count_u32);
+
+  return l_ret_u8;
+}
+
+/**
+ * @brief Inline definition of `Tool_GetSnapshot_u8()` (same contract).
+ *
+ * @param snapshot_ps
+ * Output pointer receiving the snapshot.
+ *
+ * @return uint8_t
+ * See `Tool_GetSnapshot_u8()`.
+ */
+static inline uint8_t Tool_GetSnapshotInl_u8(Tool_snapshot_t *snapshot_ps) {
+  uint8_t l_ret_u8 = 1U;
+  uint32_t l_try_u32;
+  uint32_t l_seq0_u32;
+  uint32_t l_seq1_u32;
+
+  if(snapshot_ps == NULL) {
+    l_ret_u8 = 2U;
+  } else {
+#if(TOOL_CFG_CONCURRENCY == TOOL_CFG_CONC_SINGLE)
+    /* Single context: a plain copy is always coherent. */
+    (void)l_try_u32;
+    (void)l_seq0_u32;
+    (void)l_seq1_u32;
+
+    snapshot_ps->mode_e = Tool_Mode_e;
+    snapshot_ps->statusFlg_u32 = Tool_StatusFlg_u32;
+    snapshot_ps->count_u32 = Tool_Count_u32;
+    snapshot_ps->head_u32 = Tool_Head_u32;
+    snapshot_ps->tail_u32 = Tool_Tail_u32;
+    l_ret_u8 = 0U;
+#else
+    /* Bounded retry: the reader gives up instead of stalling behind a writer. */
+    for(l_try_u32 = 0U; (l_try_u32 < TOOL_SNAPSHOT_RETRY_U32) && (l_ret_u8 == 1U); l_try_u32++) {
+      l_seq0_u32 = Tool_Seq_u32;
+      TOOL_FENCE_ACQ();
+
+      snapshot_ps->mode_e = Tool_Mode_e;
+      snapshot_ps->statusFlg_u32 = Tool_StatusFlg_u32;
+      snapshot_ps->count_u32 = Tool_Count_u32;
+      snapshot_ps->head_u32 = Tool_Head_u32;
+      snapshot_ps->tail_u32 = Tool_Tail_u32;
+
+      TOOL_FENCE_ACQ();
+      l_seq1_u32 = Tool_Seq_u32;
+
+      if(((l_seq0_u32 & 1U) == 0U) && (l_seq0_u32 == l_seq1_u32)) {
+        l_ret_u8 = 0U;
+      }
+    }
+#endif
+  }
+
+  return l_ret_u8;
+}
+
+/**
+ * @brief Inline definition of `Tool_GetStatus_u32()` (same contract).
+ *
+ * @return uint32_t
+ * See `Tool_GetStatus_u32()`.
+ */
+static inline uint32_t Tool_GetStatusInl_u32(void) {
+  uint32_t l_status_u32;
+  Tool_snapshot_t l_snap_s;
+
+  /* Best effort on a busy writer: the last attempt is packed anyway. */
+  (void)Tool_GetSnapshotInl_u8(&l_snap_s);
+
+  l_status_u32 = l_snap_s.statusFlg_u32;
+  l_status_u32 &= ~0x3UL;                                  /* Clear bits [1:0] */
+  l_status_u32 |= ((uint32_t)l_snap_s.mode_e & 0x3UL);     /* Set bits [1:0] to Tool_Mode_e */
+  l_status_u32 &= 0x0000FFFFUL;                            /* Keep lower 16 bits */
+  l_status_u32 |= ((l_snap_s.count_u32 & 0xFFFFUL) << 16); /* Set bits [31:16] to Tool_Count_u32 lower 16 bits */
+
+  return l_status_u32;
+}
+
+/**
+ * @brief Advance a raw CRC-32 register over a byte array.
+ *
+ * @details
+ * No initial value, final XOR, NULL check or length cap is applied, so a CRC
+ * can be computed piecewise: `Tool_CrcUpdInl_u32(Tool_CrcUpdInl_u32(c, a, n), b, m)`
+ * equals one update over `a` followed by `b`.
+ *
+ * @param crc_u32
+ * Current CRC register.
+ *
+ * @param data_pcu8
+ * Pointer to the input bytes (not NULL if `length_u32 != 0`).
+ *
+ * @param length_u32
+ * Number of bytes to process.
+ *
+ * @return uint32_t
+ * Updated CRC register.
+ */
+static inline uint32_t Tool_CrcUpdInl_u32(uint32_t crc_u32, const uint8_t *data_pcu8, uint32_t length_u32) {
+  uint32_t l_crc_u32 = crc_u32;
+
+#if(TOOL_CFG_CRC_ENGINE == TOOL_CFG_CRC_TABLE)
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < length_u32; l_i_u32++) {
+    l_crc_u32 = (l_crc_u32 >> 8U) ^ Tool_CrcTbl_u32[(l_crc_u32 ^ (uint32_t)data_pcu8[l_i_u32]) & 0xFFU];
+  }
+#else
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < length_u32; l_i_u32++) {
+    uint32_t l_bit_u32 = 0U;
+
+    l_crc_u32 ^= (uint32_t)data_pcu8[l_i_u32];
+    for(l_bit_u32 = 0U; l_bit_u32 < 8U; l_bit_u32++) {
+      l_crc_u32 = (uint32_t)(((l_crc_u32 & 1U) != 0U) ? ((l_crc_u32 >> 1U) ^ TOOL_CRC_POLY_U32) : (l_crc_u32 >> 1U));
+    }
+  }
+#endif
+
+  return l_crc_u32;
+}
+
+/**
+ * @brief Copy a byte array and advance a raw CRC-32 register over it in one pass.
+ *
+ * @details
+ * Same result as `memcpy(dst_pu8, src_pcu8, length_u32)` followed by
+ * `Tool_CrcUpdInl_u32(crc_u32, dst_pu8, length_u32)`, but every byte is
+ * loaded once: 8 bytes at a time go through a local copy that feeds both
+ * the store and the CRC steps. The ranges must not overlap.
+ *
+ * @param crc_u32
+ * Current CRC register.
+ *
+ * @param dst_pu8
+ * Destination (not NULL if `length_u32 != 0`).
+ *
+ * @param src_pcu8
+ * Source (not NULL if `length_u32 != 0`).
+ *
+ * @param length_u32
+ * Number of bytes to copy and process.
+ *
+ * @return uint32_t
+ * Updated CRC register.
+ */
+static inline uint32_t Tool_CopyCrcUpdInl_u32(uint32_t crc_u32, uint8_t *dst_pu8, const uint8_t *src_pcu8, uint32_t length_u32) {
+  uint32_t l_crc_u32 = crc_u32;
+  uint32_t l_i_u32 = 0U;
+
+  for(; (length_u32 - l_i_u32) >= 8U; l_i_u32 += 8U) {
+    uint8_t l_w_au8[8];
+
+    (void)memcpy(l_w_au8, &src_pcu8[l_i_u32], sizeof(l_w_au8));
+    (void)memcpy(&dst_pu8[l_i_u32], l_w_au8, sizeof(l_w_au8));
+    l_crc_u32 = Tool_CrcUpdInl_u32(l_crc_u32, l_w_au8, 8U);
+  }
+  for(; l_i_u32 < length_u32; l_i_u32++) {
+    uint8_t l_b_u8 = src_pcu8[l_i_u32];
+
+    dst_pu8[l_i_u32] = l_b_u8;
+    l_crc_u32 = Tool_CrcUpdInl_u32(l_crc_u32, &l_b_u8, 1U);
+  }
+
+  return l_crc_u32;
+}
+
+/**
+ * @brief Inline definition of `Tool_CopyCrc_u32()` (same contract).
+ *
+ * @param dst_pu8
+ * Destination of the copy.
+ *
+ * @param src_pcu8
+ * Source of the copy.
+ *
+ * @param length_u32
+ * Number of bytes to copy (the CRC covers at most `TOOL_MAX_CRC_LEN_U32`).
+ *
+ * @return uint32_t
+ * See `Tool_CopyCrc_u32()`.
+ */
+static inline uint32_t Tool_CopyCrcInl_u32(uint8_t *dst_pu8, const uint8_t *src_pcu8, uint32_t length_u32) {
+  uint32_t l_crc_u32 = (uint32_t)TOOL_CRC_INIT_U32;
+
+  if((dst_pu8 != NULL) && (src_pcu8 != NULL) && (length_u32 != 0U)) {
+    /* Same cap as Tool_ComputeCrc_u32(); the tail is copied only. */
+    uint32_t l_len_u32 = (length_u32 > TOOL_MAX_CRC_LEN_U32) ? TOOL_MAX_CRC_LEN_U32 : length_u32;
+
+    l_crc_u32 = Tool_CopyCrcUpdInl_u32(l_crc_u32, dst_pu8, src_pcu8, l_len_u32);
+    (void)memcpy(&dst_pu8[l_len_u32], &src_pcu8[l_len_u32], length_u32 - l_len_u32);
+  }
+
+  l_crc_u32 ^= (uint32_t)0xFFFFFFFFUL;
+
+  return l_crc_u32;
+}
+
+/**
+ * @brief Inline definition of `Tool_ComputeCrc_u32()` (same contract).
+ *
+ * @param data_pcu8
+ * Pointer to the input byte array.
+ *
+ * @param length_u32
+ * Requested number of bytes to process (capped to `TOOL_MAX_CRC_LEN_U32`).
+ *
+ * @return uint32_t
+ * See `Tool_ComputeCrc_u32()`.
+ */
+static inline uint32_t Tool_ComputeCrcInl_u32(const uint8_t *data_pcu8, uint32_t length_u32) {
+  uint32_t l_crc_u32 = (uint32_t)TOOL_CRC_INIT_U32;
+
+  /* Defensive: null pointer or zero length -> return init CRC. */
+  if((data_pcu8 != NULL) && (length_u32 != 0U)) {
+    /* Bounded iteration: cap to TOOL_MAX_CRC_LEN_U32. */
+    uint32_t l_len_u32 = (length_u32 > TOOL_MAX_CRC_LEN_U32) ? TOOL_MAX_CRC_LEN_U32 : length_u32;
+
+    l_crc_u32 = Tool_CrcUpdInl_u32(l_crc_u32, data_pcu8, l_len_u32);
+  }
+
+  /* Finalize CRC. */
+  l_crc_u32 ^= (uint32_t)0xFFFFFFFFUL;
+
+  return l_crc_u32;
+}
+
+/*==================[opt-in mapping]=========================================*/
+
+#if defined(TOOL_CFG_INLINE_HOT)
+#define Tool_Push_u8(value_u8) Tool_PushInl_u8(value_u8)
+#define Tool_Pop_u8(value_pu8) Tool_PopInl_u8(value_pu8)
+#define Tool_GetSnapshot_u8(snapshot_ps) Tool_GetSnapshotInl_u8(snapshot_ps)
+#define Tool_GetStatus_u32() Tool_GetStatusInl_u32()
+#define Tool_ComputeCrc_u32(data_pcu8, length_u32) Tool_ComputeCrcInl_u32((data_pcu8), (length_u32))
+#define Tool_CopyCrc_u32(dst_pu8, src_pcu8, length_u32) Tool_CopyCrcInl_u32((dst_pu8), (src_pcu8), (length_u32))
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOL_INLINE_H */
+
+/** @} */
@@ -0,0 +1,193 @@
+/**
+ * \file Tool_Mem.c
+ * \brief Tool module huge-page / NUMA backing storage for large rings (Linux).
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * \defgroup Tool_Mem Tool Backing Storage
+ * @{
+ */
+
+#define _GNU_SOURCE
+
+#include "Tool_Mem.h"
+
+#if(TOOL_CFG_MEM != 0U)
+
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_MEM_HUGE_SIZE_U (2UL * 1024UL * 1024UL) /* Huge-page size assumed for rounding/alignment. */
+#define TOOL_MEM_MPOL_PREFERRED_S32 (1)               /* From <linux/mempolicy.h>. */
+#define TOOL_MEM_ROUND_U(x) ((((x) + TOOL_MEM_HUGE_SIZE_U) - 1UL) & ~(TOOL_MEM_HUGE_SIZE_U - 1UL))
+
+/*==================[local types]============================================*/
+
+typedef struct {
+  volatile uint8_t *base_p;
+  size_t len_u;
+  int32_t cpu_s32;
+  bool pinned_b;
+} Tool_memTouch_t;
+
+/*==================[local functions]========================================*/
+
+/* Anonymous mapping aligned to the huge-page size; NULL on failure. */
+static void *Tool_MemMapAligned_p(size_t len_u) {
+  size_t l_slack_u = len_u + TOOL_MEM_HUGE_SIZE_U;
+  uint8_t *l_raw_p = (uint8_t *)mmap(NULL, l_slack_u, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  uint8_t *l_ret_p = NULL;
+
+  if(l_raw_p != (uint8_t *)MAP_FAILED) {
+    uintptr_t l_addr_u = (uintptr_t)l_raw_p;
+    size_t l_head_u = (size_t)(((l_addr_u + TOOL_MEM_HUGE_SIZE_U) - 1UL) & ~(uintptr_t)(TOOL_MEM_HUGE_SIZE_U - 1UL)) - l_addr_u;
+
+    /* Give back the unaligned head and the unused tail. */
+    if(l_head_u != 0U) {
+      (void)munmap(l_raw_p, l_head_u);
+    }
+    if((l_slack_u - l_head_u) > len_u) {
+      (void)munmap(l_raw_p + l_head_u + len_u, (l_slack_u - l_head_u) - len_u);
+    }
+    l_ret_p = l_raw_p + l_head_u;
+  }
+
+  return l_ret_p;
+}
+
+/* Preferred-node policy for the range; false if the kernel refuses. */
+static bool Tool_MemBind_b(void *addr_p, size_t len_u, int32_t node_s32) {
+  unsigned long l_mask_u = 0UL;
+  bool l_ok_b = false;
+
+  if((node_s32 >= 0) && ((uint32_t)node_s32 < (uint32_t)(sizeof(l_mask_u) * 8U))) {
+    l_mask_u = 1UL << (uint32_t)node_s32;
+    l_ok_b = (syscall(SYS_mbind, addr_p, len_u, TOOL_MEM_MPOL_PREFERRED_S32, &l_mask_u, (unsigned long)(sizeof(l_mask_u) * 8U), 0U) == 0L);
+  }
+
+  return l_ok_b;
+}
+
+/* Prefault thread: one write per page from the consumer's CPU. */
+static void *Tool_MemTouchThread(void *arg_p) {
+  Tool_memTouch_t *l_job_ps = (Tool_memTouch_t *)arg_p;
+  size_t l_page_u = (size_t)sysconf(_SC_PAGESIZE);
+  cpu_set_t l_set_s;
+
+  CPU_ZERO(&l_set_s);
+  CPU_SET((uint32_t)l_job_ps->cpu_s32, &l_set_s);
+  l_job_ps->pinned_b = (pthread_setaffinity_np(pthread_self(), sizeof(l_set_s), &l_set_s) == 0);
+
+  for(size_t l_off_u = 0U; l_off_u < l_job_ps->len_u; l_off_u += l_page_u) {
+    l_job_ps->base_p[l_off_u] = 0U;
+  }
+
+  return NULL;
+}
+
+/*==================[global functions]=======================================*/
+
+uint8_t Tool_MemAlloc_u8(Tool_mem_t *mem_ps, size_t size_u, uint32_t flags_u32, int32_t cpu_s32) {
+  uint8_t l_ret_u8 = 0U;
+
+  if((mem_ps == NULL) || (size_u == 0U)) {
+    l_ret_u8 = 3U;
+  } else {
+    size_t l_len_u = TOOL_MEM_ROUND_U(size_u);
+    void *l_map_p = MAP_FAILED;
+
+    (void)memset(mem_ps, 0, sizeof(*mem_ps));
+    mem_ps->node_s32 = -1;
+
+    if((flags_u32 & TOOL_MEM_HUGE_U32) != 0U) {
+      l_map_p = mmap(NULL, l_len_u, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      mem_ps->kind_e = Tool_memHuge_e;
+    }
+    if(l_map_p == MAP_FAILED) {
+      l_map_p = Tool_MemMapAligned_p(l_len_u);
+      l_map_p = (l_map_p == NULL) ? MAP_FAILED : l_map_p;
+      mem_ps->kind_e = Tool_memPlain_e;
+      if((l_map_p != MAP_FAILED) && ((flags_u32 & TOOL_MEM_THP_U32) != 0U)) {
+        if(madvise(l_map_p, l_len_u, MADV_HUGEPAGE) == 0) {
+          mem_ps->kind_e = Tool_memThp_e;
+        }
+      }
+    }
+
+    if(l_map_p == MAP_FAILED) {
+      l_ret_u8 = 1U;
+    } else {
+      mem_ps->map_p = l_map_p;
+      mem_ps->mapLen_u = l_len_u;
+      mem_ps->base_p = l_map_p;
+      mem_ps->size_u = size_u;
+
+      if(cpu_s32 >= 0) {
+        Tool_memTouch_t l_job_s = {(volatile uint8_t *)l_map_p, l_len_u, cpu_s32, false};
+        pthread_t l_thr_s;
+
+        /* Policy first, so the prefault below already lands on the node. */
+        if((flags_u32 & TOOL_MEM_BIND_U32) != 0U) {
+          int32_t l_node_s32 = Tool_MemNodeOfCpu_s32(cpu_s32);
+
+          if(Tool_MemBind_b(l_map_p, l_len_u, l_node_s32)) {
+            mem_ps->node_s32 = l_node_s32;
+          }
+        }
+        if(pthread_create(&l_thr_s, NULL, Tool_MemTouchThread, &l_job_s) == 0) {
+          (void)pthread_join(l_thr_s, NULL);
+          mem_ps->touched_b = l_job_s.pinned_b;
+        }
+      }
+    }
+  }
+
+  return l_ret_u8;
+}
+
+void Tool_MemFree(Tool_mem_t *mem_ps) {
+  if((mem_ps != NULL) && (mem_ps->map_p != NULL)) {
+    (void)munmap(mem_ps->map_p, mem_ps->mapLen_u);
+    (void)memset(mem_ps, 0, sizeof(*mem_ps));
+    mem_ps->node_s32 = -1;
+  }
+}
+
+int32_t Tool_MemNodeOfCpu_s32(int32_t cpu_s32) {
+  int32_t l_node_s32 = -1;
+  char l_path_c[64];
+  DIR *l_dir_p;
+
+  if(cpu_s32 >= 0) {
+    (void)snprintf(l_path_c, sizeof(l_path_c), "/sys/devices/system/cpu/cpu%ld", (long)cpu_s32);
+    l_dir_p = opendir(l_path_c);
+    if(l_dir_p != NULL) {
+      struct dirent *l_ent_ps;
+
+      /* The CPU exists; without a nodeN link the machine has one node. */
+      l_node_s32 = 0;
+      while((l_ent_ps = readdir(l_dir_p)) != NULL) {
+        if((strncmp(l_ent_ps->d_name, "node", 4U) == 0) && (l_ent_ps->d_name[4] >= '0') && (l_ent_ps->d_name[4] <= '9')) {
+          l_node_s32 = (int32_t)strtol(&l_ent_ps->d_name[4], NULL, 10);
+          break;
+        }
+      }
+      (void)closedir(l_dir_p);
+    }
+  }
+
+  return l_node_s32;
+}
+
+#endif /* TOOL_CFG_MEM */
+
+/** @} */
@@ -0,0 +1,182 @@
+/**
+ * \file Tool_Mem.h
+ * \brief Tool module huge-page / NUMA backing storage for large rings (Linux).
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * Multi-megabyte rings built with `TOOL_DEFINE_RING()` spend a noticeable
+ * part of their bulk copies on TLB misses and, on multi-socket hosts, on
+ * remote memory. `Tool_MemAlloc_u8()` provides the storage for such a ring:
+ *
+ * - backing pages: explicit huge pages (`MAP_HUGETLB`) if requested and
+ *   reserved by the administrator, otherwise a 2 MiB aligned anonymous
+ *   mapping advised for transparent huge pages (`MADV_HUGEPAGE`), otherwise
+ *   plain pages; the kind obtained is reported in `Tool_mem_t::kind_e`,
+ * - placement: a preferred NUMA node applied with `mbind()` before the first
+ *   touch; if the kernel refuses (no NUMA support, seccomp), pages are
+ *   prefaulted from a thread pinned to the consumer's CPU, so the default
+ *   first-touch policy places them on that CPU's node.
+ *
+ * Example:
+ * @code
+ * TOOL_DEFINE_RING(Cap, uint32_t, 1UL << 22U)
+ *
+ * Tool_mem_t l_mem_s;
+ * Tool_ringCap_t *l_ring_ps;
+ *
+ * if(Tool_MemAlloc_u8(&l_mem_s, sizeof(Tool_ringCap_t), TOOL_MEM_HUGE_U32 | TOOL_MEM_THP_U32, consumerCpu) == 0U) {
+ *   l_ring_ps = (Tool_ringCap_t *)l_mem_s.base_p;
+ *   Tool_RingCapInit(l_ring_ps);
+ * }
+ * @endcode
+ *
+ * \defgroup Tool_Mem Tool Backing Storage
+ * @{
+ */
+
+#ifndef TOOL_MEM_H
+#define TOOL_MEM_H
+
+#include "Tool_Cfg.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================[macros]=================================================*/
+
+#define TOOL_MEM_HUGE_U32 (1UL << 0U) /* Try explicit huge pages (MAP_HUGETLB). */
+#define TOOL_MEM_THP_U32 (1UL << 1U)  /* Advise transparent huge pages. */
+#define TOOL_MEM_BIND_U32 (1UL << 2U) /* Prefer the consumer CPU's NUMA node (mbind). */
+#define TOOL_MEM_NO_CPU_S32 (-1)      /* No consumer CPU: no placement, no prefault. */
+
+/*==================[types]==================================================*/
+
+/**
+ * \brief Backing pages actually obtained.
+ */
+typedef enum {
+  Tool_memPlain_e = 0, /**< Base pages (all huge-page attempts failed or not requested). */
+  Tool_memThp_e = 1,   /**< Aligned mapping advised for transparent huge pages. */
+  Tool_memHuge_e = 2   /**< Explicit huge pages from the hugetlb pool. */
+} Tool_memKind_e;
+
+/**
+ * \brief One backing allocation.
+ */
+typedef struct {
+  void *base_p;          /**< Start of the usable storage (page aligned). */
+  size_t size_u;         /**< Usable size in bytes, as requested. */
+  size_t mapLen_u;       /**< Length of the mapping (internal). */
+  void *map_p;           /**< Start of the mapping (internal). */
+  Tool_memKind_e kind_e; /**< Backing pages obtained. */
+  int32_t node_s32;      /**< NUMA node bound with mbind(), -1 if none. */
+  bool touched_b;        /**< Pages prefaulted from the consumer CPU. */
+} Tool_mem_t;
+
+/*==================[function prototypes]====================================*/
+
+/**
+ * @brief Allocate ring storage with huge-page and NUMA hints.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Map `size_u` bytes of zeroed anonymous memory, trying the page kinds
+ * selected in `flags_u32` from the largest down, place it near
+ * `cpu_s32` and prefault it so the ring's hot path never takes a page fault.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range          | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|------|----------------|------|
+ * | mem_ps         |    |  X  | Tool_mem_t*                 |  out  |   1    |   0    |   1  | pointer / NULL | [-]  |
+ * | size_u         | X  |     | size_t                      |   in  |   1    |   0    |   1  | 1..            | [B]  |
+ * | flags_u32      | X  |     | uint32_t                    |   in  |   1    |   0    |   1  | TOOL_MEM_*     | [-]  |
+ * | cpu_s32        | X  |     | int32_t                     |   in  |   1    |   0    |   1  | -1..           | [-]  |
+ * | returned val   |    |  X  | uint8_t                     |  out  |   1    |   0    |   1  | {0,1,3}        | [-]  |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (mem_ps == NULL or size_u == 0) then (yes)
+ *   :return 3;
+ *   stop
+ * endif
+ * if (HUGE requested and MAP_HUGETLB succeeds) then (yes)
+ *   :kind = Huge;
+ * elseif (mmap with 2 MiB slack succeeds) then (yes)
+ *   :trim to 2 MiB alignment;
+ *   if (THP requested and madvise succeeds) then (yes)
+ *     :kind = Thp;
+ *   else (no)
+ *     :kind = Plain;
+ *   endif
+ * else (no)
+ *   :return 1;
+ *   stop
+ * endif
+ * if (cpu_s32 >= 0) then (yes)
+ *   if (BIND requested) then (yes)
+ *     :mbind(preferred node of cpu_s32);
+ *   endif
+ *   :prefault from a thread pinned to cpu_s32;
+ * endif
+ * :return 0;
+ * stop
+ * @enduml
+ *
+ * @param mem_ps
+ * Allocation descriptor to fill.
+ *
+ * @param size_u
+ * Bytes needed, e.g. `sizeof(Tool_ring<Name>_t)`.
+ *
+ * @param flags_u32
+ * Combination of `TOOL_MEM_HUGE_U32`, `TOOL_MEM_THP_U32`,
+ * `TOOL_MEM_BIND_U32`; 0 gives plain pages.
+ *
+ * @param cpu_s32
+ * CPU the consumer runs on, or `TOOL_MEM_NO_CPU_S32`.
+ *
+ * @return uint8_t
+ * - 0: Success; `mem_ps->kind_e`, `node_s32` and `touched_b` tell which
+ *   hints took effect.
+ * - 1: No mapping could be created.
+ * - 3: `mem_ps` is NULL or `size_u` is 0.
+ */
+uint8_t Tool_MemAlloc_u8(Tool_mem_t *mem_ps, size_t size_u, uint32_t flags_u32, int32_t cpu_s32);
+
+/**
+ * @brief Release storage obtained from `Tool_MemAlloc_u8()`.
+ *
+ * @param mem_ps
+ * Allocation descriptor; cleared afterwards. NULL is ignored.
+ *
+ * @return void
+ */
+void Tool_MemFree(Tool_mem_t *mem_ps);
+
+/**
+ * @brief NUMA node of a CPU.
+ *
+ * @param cpu_s32
+ * CPU number.
+ *
+ * @return int32_t
+ * Node number from sysfs, 0 on kernels without NUMA topology, -1 for an
+ * invalid CPU number.
+ */
+int32_t Tool_MemNodeOfCpu_s32(int32_t cpu_s32);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOL_MEM_H */
+
+/** @} */
@@ -0,0 +1,318 @@
+/**
+ * \file Tool_Merge.h
+ * \brief Timestamp-ordered k-way merge over per-producer rings.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * Sharded ingestion (Tool_Shard.h) gives up the global order of records.
+ * `TOOL_DEFINE_MERGE(Name, type, ts, cap, lanes)` restores it: producers push
+ * timestamped records into their own lane, the consumer pops them in
+ * timestamp order through a tournament (winner) tree over the lanes.
+ * The consumer takes records from a lane `TOOL_MERGE_BATCH_U32` at a time,
+ * and a lane that wins twice in a row is served as a run: every record that
+ * still beats the best other lane goes out before the tree is replayed. A
+ * record costs one `log2(lanes)` replay when lanes alternate (the worst
+ * case); a run costs two replays and one runner-up walk however long it is.
+ *
+ * Records carry their timestamp in the `uint64_t` member named by `ts`; any
+ * record type with such a member works, and `TOOL_DEFINE_TS_RECORD()` wraps
+ * a plain payload type for callers that have none. Every lane must be fed in
+ * non-decreasing timestamp order (one producer, one clock).
+ *
+ * Ordering needs lookahead: a record is released only when every other lane
+ * either has a staged record that is not older, or is known not to produce
+ * one. An empty lane is bounded below by the last timestamp seen on it and
+ * by the caller's `watermark` (the promise that no lane will still push a
+ * record older than it, e.g. "now minus the maximum producer delay"). With
+ * watermark 0 the merge is exact and stops at the first empty lane; a
+ * raised watermark bounds how long an idle producer can hold the others back.
+ * Like Tool_Shard.h it requires `TOOL_CFG_CONCURRENCY` SPSC.
+ *
+ * Example:
+ * @code
+ * TOOL_DEFINE_TS_RECORD(Smp, uint32_t)
+ * TOOL_DEFINE_MERGE(Smp, Tool_tsSmp_t, ts_u64, 1024U, 4U)
+ *
+ * static Tool_mergeSmp_t Smp_s;
+ *
+ * Tool_MergeSmpInit(&Smp_s);
+ * (void)Tool_ShardSmpPush_u8(&Smp_s.shard_s, producerIdx, rec);   // producer thread
+ * n = Tool_MergeSmpPopN_u32(&Smp_s, buf, 64U, now - maxDelay);    // consumer thread
+ * @endcode
+ *
+ * \defgroup Tool_Merge Tool Timestamp Merge
+ * @{
+ */
+
+#ifndef TOOL_MERGE_H
+#define TOOL_MERGE_H
+
+#include "Tool_Shard.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================[macros]=================================================*/
+
+#define TOOL_MERGE_LANES_MAX_U32 (64U)
+
+/* Records the consumer takes from a lane per ring pop. */
+#define TOOL_MERGE_BATCH_U32 (16U)
+
+/* Leaves of the tournament tree: lanes rounded up to a power of two. */
+#define TOOL_MERGE_LEAVES_U32(lanes)                                                                                      \
+  (((lanes) <= 1U) ? 1U : ((lanes) <= 2U) ? 2U : ((lanes) <= 4U) ? 4U : ((lanes) <= 8U) ? 8U : ((lanes) <= 16U) ? 16U \
+                        : ((lanes) <= 32U) ? 32U : 64U)
+
+/**
+ * @brief Define a record type `Tool_ts<Name>_t` carrying a timestamp.
+ *
+ * @param Name
+ * Identifier fragment used in the generated name.
+ *
+ * @param type
+ * Payload type, stored in member `value`.
+ */
+#define TOOL_DEFINE_TS_RECORD(Name, type) \
+  typedef struct {                        \
+    uint64_t ts_u64; /* Timestamp. */     \
+    type value;                           \
+  } Tool_ts##Name##_t;
+
+/**
+ * @brief Define a merged queue type `Tool_merge<Name>_t` and its functions.
+ *
+ * @details
+ * Expands `TOOL_DEFINE_SHARDS(Name, type, cap, lanes)` for the producer side
+ * (push with `Tool_Shard<Name>Push_u8(&merge.shard_s, lane, rec)`; the
+ * snapshot and overflow accounting of the shards apply unchanged) and adds:
+ *
+ * | Function                                                  | Context  | Returns                          |
+ * |-----------------------------------------------------------|----------|----------------------------------|
+ * | `void Tool_Merge<Name>Init(m)`                             | setup    | -                                |
+ * | `uint32_t Tool_Merge<Name>PopN_u32(m, dst, n, watermark)`  | consumer | records popped in ts order       |
+ * | `uint8_t Tool_Merge<Name>Pop_u8(m, value_p, watermark)`    | consumer | 0 ok, 1 order not known yet, 3 NULL |
+ *
+ * The consumer stages up to `TOOL_MERGE_BATCH_U32` records per lane; they
+ * have left the lane ring, so the shard snapshot no longer counts them.
+ * `batch_a[]`, `pos_a[]`, `len_a[]`, `key_a[]`, `staged_a[]` and `tree_a[]`
+ * are consumer-owned. Ties between lanes are served in lane order.
+ *
+ * @param Name
+ * Identifier fragment used in the generated names.
+ *
+ * @param type
+ * Record type.
+ *
+ * @param ts
+ * Name of the `uint64_t` timestamp member of `type`.
+ *
+ * @param cap
+ * Capacity of each lane in records (power of two).
+ *
+ * @param lanes
+ * Number of lanes (1 .. `TOOL_MERGE_LANES_MAX_U32`).
+ */
+#define TOOL_DEFINE_MERGE(Name, type, ts, cap, lanes)                                                                                               \
+  TOOL_DEFINE_SHARDS(Name, type, cap, lanes)                                                                                                        \
+                                                                                                                                                    \
+  typedef char Tool_merge##Name##NumChk_t[(((lanes) != 0U) && ((lanes) <= TOOL_MERGE_LANES_MAX_U32)) ? 1 : -1];                                     \
+                                                                                                                                                    \
+  typedef struct {                                                                                                                                  \
+    Tool_shard##Name##_t shard_s;                                            /* Producer side: one lane per producer. */                            \
+    type batch_a[TOOL_MERGE_LEAVES_U32(lanes)][TOOL_MERGE_BATCH_U32];        /* Records taken from each lane, not yet served. */                    \
+    uint32_t pos_a[TOOL_MERGE_LEAVES_U32(lanes)];                            /* Next record in batch_a[lane][]. */                                  \
+    uint32_t len_a[TOOL_MERGE_LEAVES_U32(lanes)];                            /* Records in batch_a[lane][]. */                                      \
+    uint64_t key_a[TOOL_MERGE_LEAVES_U32(lanes)];                            /* Staged timestamp, or lower bound if empty. */                       \
+    uint8_t staged_a[TOOL_MERGE_LEAVES_U32(lanes)];                          /* batch_a[lane][] holds a record. */                                  \
+    uint32_t tree_a[TOOL_MERGE_LEAVES_U32(lanes)];                           /* [0] overall winner, [n] winner below node n. */                     \
+  } Tool_merge##Name##_t;                                                                                                                           \
+                                                                                                                                                    \
+  /* true if lane a_u32 must be served before lane b_u32. */                                                                                        \
+  static inline bool Tool_Merge##Name##Less_b(const Tool_merge##Name##_t *merge_pcs, uint32_t a_u32, uint32_t b_u32) {                              \
+    bool l_less_b;                                                                                                                                  \
+                                                                                                                                                    \
+    if(merge_pcs->key_a[a_u32] != merge_pcs->key_a[b_u32]) {                                                                                        \
+      l_less_b = (merge_pcs->key_a[a_u32] < merge_pcs->key_a[b_u32]);                                                                               \
+    } else if(merge_pcs->staged_a[a_u32] != merge_pcs->staged_a[b_u32]) {                                                                           \
+      l_less_b = (merge_pcs->staged_a[a_u32] != 0U);                                                                                                \
+    } else {                                                                                                                                        \
+      l_less_b = (a_u32 < b_u32);                                                                                                                   \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_less_b;                                                                                                                                \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  /* Re-run the matches from a lane whose key changed up to the root. */                                                                            \
+  static inline void Tool_Merge##Name##Update(Tool_merge##Name##_t *merge_ps, uint32_t lane_u32) {                                                  \
+    for(uint32_t l_node_u32 = (lane_u32 + TOOL_MERGE_LEAVES_U32(lanes)) >> 1U; l_node_u32 != 0U; l_node_u32 >>= 1U) {                               \
+      uint32_t l_l_u32 = 2U * l_node_u32;                                                                                                           \
+      uint32_t l_a_u32 = (l_l_u32 >= TOOL_MERGE_LEAVES_U32(lanes)) ? (l_l_u32 - TOOL_MERGE_LEAVES_U32(lanes)) : merge_ps->tree_a[l_l_u32];          \
+      uint32_t l_b_u32 = (l_l_u32 >= TOOL_MERGE_LEAVES_U32(lanes)) ? (l_a_u32 + 1U) : merge_ps->tree_a[l_l_u32 + 1U];                               \
+                                                                                                                                                    \
+      merge_ps->tree_a[l_node_u32] = Tool_Merge##Name##Less_b(merge_ps, l_b_u32, l_a_u32) ? l_b_u32 : l_a_u32;                                      \
+    }                                                                                                                                               \
+    merge_ps->tree_a[0] = (TOOL_MERGE_LEAVES_U32(lanes) > 1U) ? merge_ps->tree_a[1] : 0U;                                                           \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  /* Best lane other than the winner lane_u32: the best of the subtrees                                                                             \
+   * beside its path to the root. Returns lane_u32 itself if there is none. */                                                                      \
+  static inline uint32_t Tool_Merge##Name##Second_u32(const Tool_merge##Name##_t *merge_pcs, uint32_t lane_u32) {                                   \
+    uint32_t l_second_u32 = lane_u32;                                                                                                               \
+                                                                                                                                                    \
+    for(uint32_t l_node_u32 = lane_u32 + TOOL_MERGE_LEAVES_U32(lanes); l_node_u32 > 1U; l_node_u32 >>= 1U) {                                        \
+      uint32_t l_sib_u32 = l_node_u32 ^ 1U;                                                                                                         \
+      uint32_t l_c_u32 = (l_sib_u32 >= TOOL_MERGE_LEAVES_U32(lanes)) ? (l_sib_u32 - TOOL_MERGE_LEAVES_U32(lanes)) : merge_pcs->tree_a[l_sib_u32];   \
+                                                                                                                                                    \
+      if((l_second_u32 == lane_u32) || Tool_Merge##Name##Less_b(merge_pcs, l_c_u32, l_second_u32)) {                                                \
+        l_second_u32 = l_c_u32;                                                                                                                     \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_second_u32;                                                                                                                            \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  /* Stage the next record of a lane, refilling its batch with one ring PopN                                                                        \
+   * when it ran empty; an empty lane keeps a lower bound. */                                                                                       \
+  static inline void Tool_Merge##Name##Stage(Tool_merge##Name##_t *merge_ps, uint32_t lane_u32, uint64_t watermark_u64) {                           \
+    if(merge_ps->pos_a[lane_u32] == merge_ps->len_a[lane_u32]) {                                                                                    \
+      merge_ps->pos_a[lane_u32] = 0U;                                                                                                               \
+      merge_ps->len_a[lane_u32] =                                                                                                                   \
+          Tool_Ring##Name##ShardPopN_u32(&merge_ps->shard_s.lane_a[lane_u32].ring_s, merge_ps->batch_a[lane_u32], TOOL_MERGE_BATCH_U32);            \
+    }                                                                                                                                               \
+    if(merge_ps->pos_a[lane_u32] != merge_ps->len_a[lane_u32]) {                                                                                    \
+      merge_ps->staged_a[lane_u32] = 1U;                                                                                                            \
+      merge_ps->key_a[lane_u32] = (uint64_t)merge_ps->batch_a[lane_u32][merge_ps->pos_a[lane_u32]].ts;                                              \
+    } else {                                                                                                                                        \
+      merge_ps->staged_a[lane_u32] = 0U;                                                                                                            \
+      if(merge_ps->key_a[lane_u32] < watermark_u64) {                                                                                               \
+        merge_ps->key_a[lane_u32] = watermark_u64;                                                                                                  \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  /* Serve the staged record of a lane and stage its next one. */                                                                                   \
+  static inline void Tool_Merge##Name##Take(Tool_merge##Name##_t *merge_ps, uint32_t lane_u32, type *dst_p, uint64_t wm_u64) {                      \
+    uint32_t l_pos_u32 = merge_ps->pos_a[lane_u32];                                                                                                 \
+                                                                                                                                                    \
+    *dst_p = merge_ps->batch_a[lane_u32][l_pos_u32];                                                                                                \
+    l_pos_u32++;                                                                                                                                    \
+    merge_ps->pos_a[lane_u32] = l_pos_u32;                                                                                                          \
+    if(l_pos_u32 != merge_ps->len_a[lane_u32]) {                                                                                                    \
+      merge_ps->key_a[lane_u32] = (uint64_t)merge_ps->batch_a[lane_u32][l_pos_u32].ts;                                                              \
+    } else {                                                                                                                                        \
+      Tool_Merge##Name##Stage(merge_ps, lane_u32, wm_u64);                                                                                          \
+    }                                                                                                                                               \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  /* Serve up to n_u32 records of a lane while they beat lane second_u32                                                                            \
+   * (lane_u32 itself: no other lane), a batch scan and one copy at a time. */                                                                      \
+  static inline uint32_t Tool_Merge##Name##Run_u32(Tool_merge##Name##_t *merge_ps, uint32_t lane_u32, uint32_t second_u32, type *dst_p,             \
+                                                   uint32_t n_u32, uint64_t wm_u64) {                                                               \
+    uint64_t l_lim_u64 = (second_u32 == lane_u32) ? UINT64_MAX : merge_ps->key_a[second_u32];                                                       \
+    bool l_tie_b = (second_u32 == lane_u32) || (merge_ps->staged_a[second_u32] == 0U) || (lane_u32 < second_u32);                                   \
+    uint32_t l_n_u32 = 0U;                                                                                                                          \
+    bool l_more_b = true;                                                                                                                           \
+                                                                                                                                                    \
+    while(l_more_b && (l_n_u32 < n_u32) && (merge_ps->staged_a[lane_u32] != 0U)) {                                                                  \
+      const type *l_batch_pc = merge_ps->batch_a[lane_u32];                                                                                         \
+      uint32_t l_pos_u32 = merge_ps->pos_a[lane_u32];                                                                                               \
+      uint32_t l_end_u32 = merge_ps->len_a[lane_u32];                                                                                               \
+      uint32_t l_i_u32 = l_pos_u32;                                                                                                                 \
+                                                                                                                                                    \
+      l_end_u32 = ((l_end_u32 - l_pos_u32) > (n_u32 - l_n_u32)) ? (l_pos_u32 + (n_u32 - l_n_u32)) : l_end_u32;                                      \
+      while((l_i_u32 < l_end_u32) &&                                                                                                                \
+            (((uint64_t)l_batch_pc[l_i_u32].ts < l_lim_u64) || (l_tie_b && ((uint64_t)l_batch_pc[l_i_u32].ts == l_lim_u64)))) {                     \
+        l_i_u32++;                                                                                                                                  \
+      }                                                                                                                                             \
+      if(l_i_u32 != l_pos_u32) {                                                                                                                    \
+        (void)memcpy(&dst_p[l_n_u32], &l_batch_pc[l_pos_u32], (size_t)(l_i_u32 - l_pos_u32) * sizeof(type));                                        \
+        l_n_u32 += l_i_u32 - l_pos_u32;                                                                                                             \
+        merge_ps->pos_a[lane_u32] = l_i_u32;                                                                                                        \
+        /* Last record served: the lower bound if the lane is now empty. */                                                                         \
+        merge_ps->key_a[lane_u32] = (uint64_t)l_batch_pc[l_i_u32 - 1U].ts;                                                                          \
+        Tool_Merge##Name##Stage(merge_ps, lane_u32, wm_u64);                                                                                        \
+      }                                                                                                                                             \
+      l_more_b = (l_i_u32 == l_end_u32);                                                                                                            \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_n_u32;                                                                                                                                 \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static inline void Tool_Merge##Name##Init(Tool_merge##Name##_t *merge_ps) {                                                                       \
+    if(merge_ps != NULL) {                                                                                                                          \
+      Tool_Shard##Name##Init(&merge_ps->shard_s);                                                                                                   \
+      for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_MERGE_LEAVES_U32(lanes); l_i_u32++) {                                                               \
+        merge_ps->pos_a[l_i_u32] = 0U;                                                                                                              \
+        merge_ps->len_a[l_i_u32] = 0U;                                                                                                              \
+        merge_ps->key_a[l_i_u32] = (l_i_u32 < (uint32_t)(lanes)) ? 0U : UINT64_MAX;                                                                 \
+        merge_ps->staged_a[l_i_u32] = 0U;                                                                                                           \
+        merge_ps->tree_a[l_i_u32] = 0U;                                                                                                             \
+      }                                                                                                                                             \
+      /* Pairs left to right: a node is final once its right-most pair ran. */                                                                      \
+      for(uint32_t l_i_u32 = 0U; l_i_u32 < TOOL_MERGE_LEAVES_U32(lanes); l_i_u32 += 2U) {                                                           \
+        Tool_Merge##Name##Update(merge_ps, l_i_u32);                                                                                                \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static inline uint32_t Tool_Merge##Name##PopN_u32(Tool_merge##Name##_t *merge_ps, type *dst_p, uint32_t n_u32, uint64_t watermark_u64) {          \
+    uint32_t l_n_u32 = 0U;                                                                                                                          \
+    uint32_t l_last_u32 = TOOL_MERGE_LEAVES_U32(lanes); /* Lane served last, none yet. */                                                           \
+                                                                                                                                                    \
+    if((merge_ps != NULL) && (dst_p != NULL)) {                                                                                                     \
+      for(uint32_t l_i_u32 = 0U; l_i_u32 < (uint32_t)(lanes); l_i_u32++) {                                                                          \
+        if(merge_ps->staged_a[l_i_u32] == 0U) {                                                                                                     \
+          Tool_Merge##Name##Stage(merge_ps, l_i_u32, watermark_u64);                                                                                \
+          Tool_Merge##Name##Update(merge_ps, l_i_u32);                                                                                              \
+        }                                                                                                                                           \
+      }                                                                                                                                             \
+      while(l_n_u32 < n_u32) {                                                                                                                      \
+        uint32_t l_win_u32 = merge_ps->tree_a[0];                                                                                                   \
+                                                                                                                                                    \
+        if(merge_ps->staged_a[l_win_u32] == 0U) {                                                                                                   \
+          /* The smallest bound belongs to an empty lane: order is not known yet. */                                                                \
+          Tool_Merge##Name##Stage(merge_ps, l_win_u32, watermark_u64);                                                                              \
+          if(merge_ps->staged_a[l_win_u32] == 0U) {                                                                                                 \
+            break;                                                                                                                                  \
+          }                                                                                                                                         \
+        } else if(l_win_u32 != l_last_u32) {                                                                                                        \
+          Tool_Merge##Name##Take(merge_ps, l_win_u32, &dst_p[l_n_u32], watermark_u64);                                                              \
+          l_n_u32++;                                                                                                                                \
+          l_last_u32 = l_win_u32;                                                                                                                   \
+        } else {                                                                                                                                    \
+          /* Same lane won twice in a row: serve its run, every record that                                                                         \
+           * still beats the runner-up, before the next replay. */                                                                                  \
+          uint32_t l_second_u32 = Tool_Merge##Name##Second_u32(merge_ps, l_win_u32);                                                                \
+                                                                                                                                                    \
+          l_n_u32 += Tool_Merge##Name##Run_u32(merge_ps, l_win_u32, l_second_u32, &dst_p[l_n_u32], n_u32 - l_n_u32, watermark_u64);                 \
+        }                                                                                                                                           \
+        Tool_Merge##Name##Update(merge_ps, l_win_u32);                                                                                              \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_n_u32;                                                                                                                                 \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static inline uint8_t Tool_Merge##Name##Pop_u8(Tool_merge##Name##_t *merge_ps, type *value_p, uint64_t watermark_u64) {                           \
+    uint8_t l_ret_u8 = 3U;                                                                                                                          \
+                                                                                                                                                    \
+    if((merge_ps != NULL) && (value_p != NULL)) {                                                                                                   \
+      l_ret_u8 = (Tool_Merge##Name##PopN_u32(merge_ps, value_p, 1U, watermark_u64) == 1U) ? 0U : 1U;                                                \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_ret_u8;                                                                                                                                \
+  }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOL_MERGE_H */
+
+/** @} */
@@ -0,0 +1,226 @@
+/**
+ * \file Tool_Pool.c
+ * \brief Tool module worker pool stepping a channel bank in parallel (Linux).
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * \defgroup Tool_Pool Tool Worker Pool
+ * @{
+ */
+
+#define _GNU_SOURCE
+
+#include "Tool_Pool.h"
+
+#if(TOOL_CFG_POOL != 0U)
+
+#include <limits.h>
+#include <linux/futex.h>
+#include <sched.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_POOL_SPIN_U32 (4096U) /* Polls before a waiter goes to sleep. */
+
+#define TOOL_POOL_LOAD(x) __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define TOOL_POOL_STORE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_SEQ_CST)
+
+#if defined(__x86_64__) || defined(__i386__)
+#define TOOL_POOL_RELAX() __builtin_ia32_pause()
+#else
+#define TOOL_POOL_RELAX() __atomic_signal_fence(__ATOMIC_SEQ_CST)
+#endif
+
+/*==================[local functions]========================================*/
+
+static void Tool_PoolFutexWait(uint32_t *word_pu32, uint32_t val_u32) {
+  (void)syscall(SYS_futex, word_pu32, FUTEX_WAIT_PRIVATE, val_u32, NULL, NULL, 0);
+}
+
+static void Tool_PoolFutexWake(uint32_t *word_pu32) {
+  (void)syscall(SYS_futex, word_pu32, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+/*
+ * Wait until *word_pu32 differs from val_u32: spin first, then sleep with
+ * *sleepers_pu32 raised so the writer knows a wake-up is needed. The
+ * sequentially consistent raise/re-read pairs with the writer's store/read.
+ */
+static void Tool_PoolAwait(uint32_t *word_pu32, uint32_t val_u32, uint32_t *sleepers_pu32) {
+  uint32_t l_spin_u32 = 0U;
+
+  while(TOOL_POOL_LOAD(*word_pu32) == val_u32) {
+    if(l_spin_u32 < TOOL_POOL_SPIN_U32) {
+      TOOL_POOL_RELAX();
+      l_spin_u32++;
+    } else {
+      (void)__atomic_add_fetch(sleepers_pu32, 1U, __ATOMIC_SEQ_CST);
+      if(__atomic_load_n(word_pu32, __ATOMIC_SEQ_CST) == val_u32) {
+        Tool_PoolFutexWait(word_pu32, val_u32);
+      }
+      (void)__atomic_sub_fetch(sleepers_pu32, 1U, __ATOMIC_SEQ_CST);
+    }
+  }
+}
+
+/* Next chunk for worker self_u32: own share first, then the others' shares. */
+static bool Tool_PoolClaim_b(Tool_pool_t *pool_ps, uint32_t self_u32, uint32_t *chunk_pu32) {
+  bool l_got_b = false;
+
+  for(uint32_t l_k_u32 = 0U; (l_k_u32 < pool_ps->workers_u32) && !l_got_b; l_k_u32++) {
+    uint32_t l_w_u32 = (self_u32 + l_k_u32) % pool_ps->workers_u32;
+    Tool_poolWorker_t *l_wk_ps = &pool_ps->worker_a[l_w_u32];
+
+    /* Cheap check first; an exhausted cursor is not bumped any further. */
+    if(TOOL_POOL_LOAD(l_wk_ps->next_u32) < l_wk_ps->end_u32) {
+      uint32_t l_c_u32 = __atomic_fetch_add(&l_wk_ps->next_u32, 1U, __ATOMIC_ACQ_REL);
+
+      if(l_c_u32 < l_wk_ps->end_u32) {
+        *chunk_pu32 = l_c_u32;
+        l_got_b = true;
+        if(l_k_u32 != 0U) {
+          pool_ps->worker_a[self_u32].steals_u32++;
+        }
+      }
+    }
+  }
+
+  return l_got_b;
+}
+
+/* One tick of worker self_u32: drain chunks, then count out. */
+static void Tool_PoolTick(Tool_pool_t *pool_ps, uint32_t self_u32) {
+  uint32_t l_blocks_u32 = ((pool_ps->batch_ps->n_u32 + TOOL_BATCH_BLOCK_U32) - 1U) / TOOL_BATCH_BLOCK_U32;
+  uint32_t l_chunk_u32;
+
+  while(Tool_PoolClaim_b(pool_ps, self_u32, &l_chunk_u32)) {
+    uint32_t l_first_u32 = l_chunk_u32 * TOOL_POOL_CHUNK_BLOCKS_U32;
+    uint32_t l_n_u32 = ((l_blocks_u32 - l_first_u32) < TOOL_POOL_CHUNK_BLOCKS_U32) ? (l_blocks_u32 - l_first_u32) : TOOL_POOL_CHUNK_BLOCKS_U32;
+
+    (void)Tool_ProcessBlocks_u8(pool_ps->batch_ps, l_first_u32, l_n_u32);
+  }
+
+  if(__atomic_sub_fetch(&pool_ps->pending_u32, 1U, __ATOMIC_SEQ_CST) == 0U) {
+    if(__atomic_load_n(&pool_ps->waiting_u32, __ATOMIC_SEQ_CST) != 0U) {
+      Tool_PoolFutexWake(&pool_ps->pending_u32);
+    }
+  }
+}
+
+static void *Tool_PoolThread(void *arg_p) {
+  Tool_poolWorker_t *l_wk_ps = (Tool_poolWorker_t *)arg_p;
+  Tool_pool_t *l_pool_ps = l_wk_ps->pool_ps;
+  uint32_t l_self_u32 = (uint32_t)(l_wk_ps - l_pool_ps->worker_a);
+  uint32_t l_seen_u32 = 0U;
+
+  if(l_wk_ps->cpu_s32 != TOOL_POOL_NO_CPU_S32) {
+    cpu_set_t l_set_s;
+
+    CPU_ZERO(&l_set_s);
+    CPU_SET((uint32_t)l_wk_ps->cpu_s32, &l_set_s);
+    l_wk_ps->pinned_b = (pthread_setaffinity_np(pthread_self(), sizeof(l_set_s), &l_set_s) == 0);
+  }
+
+  for(;;) {
+    Tool_PoolAwait(&l_pool_ps->gen_u32, l_seen_u32, &l_pool_ps->sleepers_u32);
+    if(TOOL_POOL_LOAD(l_pool_ps->stop_u32) != 0U) {
+      break;
+    }
+    l_seen_u32 = TOOL_POOL_LOAD(l_pool_ps->gen_u32);
+    Tool_PoolTick(l_pool_ps, l_self_u32);
+  }
+
+  return NULL;
+}
+
+/* Wake every worker for the new generation (stop flag already set, if any). */
+static void Tool_PoolPublish(Tool_pool_t *pool_ps) {
+  (void)__atomic_add_fetch(&pool_ps->gen_u32, 1U, __ATOMIC_SEQ_CST);
+  if(__atomic_load_n(&pool_ps->sleepers_u32, __ATOMIC_SEQ_CST) != 0U) {
+    Tool_PoolFutexWake(&pool_ps->gen_u32);
+  }
+}
+
+/*==================[global functions]=======================================*/
+
+uint8_t Tool_PoolInit_u8(Tool_pool_t *pool_ps, Tool_batch_t *batch_ps, uint32_t workers_u32, int32_t cpu0_s32) {
+  uint8_t l_ret_u8 = 0U;
+
+  if((pool_ps == NULL) || (batch_ps == NULL)) {
+    l_ret_u8 = 3U;
+  } else if((workers_u32 == 0U) || (workers_u32 > TOOL_POOL_WORKERS_MAX_U32)) {
+    l_ret_u8 = 2U;
+  } else {
+    uint32_t l_blocks_u32 = ((batch_ps->n_u32 + TOOL_BATCH_BLOCK_U32) - 1U) / TOOL_BATCH_BLOCK_U32;
+    long l_cpus_s32 = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t l_started_u32 = 1U;
+
+    (void)memset(pool_ps, 0, sizeof(*pool_ps));
+    pool_ps->batch_ps = batch_ps;
+    pool_ps->workers_u32 = workers_u32;
+    pool_ps->chunks_u32 = ((l_blocks_u32 + TOOL_POOL_CHUNK_BLOCKS_U32) - 1U) / TOOL_POOL_CHUNK_BLOCKS_U32;
+    l_cpus_s32 = (l_cpus_s32 > 0L) ? l_cpus_s32 : 1L;
+
+    for(uint32_t l_w_u32 = 0U; l_w_u32 < workers_u32; l_w_u32++) {
+      Tool_poolWorker_t *l_wk_ps = &pool_ps->worker_a[l_w_u32];
+
+      l_wk_ps->begin_u32 = (uint32_t)(((uint64_t)pool_ps->chunks_u32 * l_w_u32) / workers_u32);
+      l_wk_ps->end_u32 = (uint32_t)(((uint64_t)pool_ps->chunks_u32 * (l_w_u32 + 1U)) / workers_u32);
+      l_wk_ps->next_u32 = l_wk_ps->end_u32; /* Nothing to claim before the first tick. */
+      l_wk_ps->pool_ps = pool_ps;
+      l_wk_ps->cpu_s32 = (cpu0_s32 < 0) ? TOOL_POOL_NO_CPU_S32 : (int32_t)(((uint32_t)cpu0_s32 + l_w_u32) % (uint32_t)l_cpus_s32);
+    }
+
+    while((l_started_u32 < workers_u32) && (l_ret_u8 == 0U)) {
+      if(pthread_create(&pool_ps->worker_a[l_started_u32].thr_s, NULL, Tool_PoolThread, &pool_ps->worker_a[l_started_u32]) != 0) {
+        l_ret_u8 = 1U;
+      } else {
+        l_started_u32++;
+      }
+    }
+    if(l_ret_u8 != 0U) {
+      pool_ps->workers_u32 = l_started_u32;
+      Tool_PoolDeInit(pool_ps);
+    }
+  }
+
+  return l_ret_u8;
+}
+
+void Tool_PoolDeInit(Tool_pool_t *pool_ps) {
+  if((pool_ps != NULL) && (pool_ps->batch_ps != NULL)) {
+    TOOL_POOL_STORE(pool_ps->stop_u32, 1U);
+    Tool_PoolPublish(pool_ps);
+    for(uint32_t l_w_u32 = 1U; l_w_u32 < pool_ps->workers_u32; l_w_u32++) {
+      (void)pthread_join(pool_ps->worker_a[l_w_u32].thr_s, NULL);
+    }
+    pool_ps->batch_ps = NULL;
+    pool_ps->workers_u32 = 0U;
+  }
+}
+
+void Tool_PoolProcessAll(Tool_pool_t *pool_ps) {
+  if((pool_ps != NULL) && (pool_ps->batch_ps != NULL)) {
+    /* Workers are all counted out of the previous tick: nobody reads the
+     * cursors until the generation below is published. */
+    for(uint32_t l_w_u32 = 0U; l_w_u32 < pool_ps->workers_u32; l_w_u32++) {
+      pool_ps->worker_a[l_w_u32].next_u32 = pool_ps->worker_a[l_w_u32].begin_u32;
+    }
+    TOOL_POOL_STORE(pool_ps->pending_u32, pool_ps->workers_u32);
+    Tool_PoolPublish(pool_ps);
+
+    Tool_PoolTick(pool_ps, 0U);
+
+    for(uint32_t l_p_u32 = TOOL_POOL_LOAD(pool_ps->pending_u32); l_p_u32 != 0U; l_p_u32 = TOOL_POOL_LOAD(pool_ps->pending_u32)) {
+      Tool_PoolAwait(&pool_ps->pending_u32, l_p_u32, &pool_ps->waiting_u32);
+    }
+  }
+}
+
+#endif /* TOOL_CFG_POOL */
+
+/** @} */
@@ -0,0 +1,211 @@
+/**
+ * \file Tool_Pool.h
+ * \brief Tool module worker pool stepping a channel bank in parallel (Linux).
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * A `Tool_pool_t` spreads the channels of a `Tool_batch_t` (see
+ * Tool_Batch.h) over a set of worker threads pinned to consecutive CPUs.
+ * `Tool_PoolProcessAll()` is the parallel form of `Tool_ProcessAll()`: it
+ * returns once every channel has been stepped exactly once (subject to its
+ * cadence, `Tool_BatchSetCadence_u8()`).
+ *
+ * The bank is cut into chunks of `TOOL_POOL_CHUNK_BLOCKS_U32` blocks. Each
+ * worker owns a contiguous share of chunks and claims them through its own
+ * cursor; a worker that runs out claims chunks from the other workers'
+ * cursors, so a share holding busy channels (many rotations) is finished by
+ * whoever is idle. Claims are one atomic add; no lock is taken.
+ *
+ * A tick is published with a generation counter and completed with a
+ * pending counter. Workers never wait for each other: each one just counts
+ * itself out when no chunk is left, and the caller, which works as worker 0,
+ * returns when the count reaches zero. Idle workers spin briefly and then
+ * sleep on a futex; the caller only enters the kernel to wake sleepers.
+ *
+ * One thread at a time may call `Tool_PoolProcessAll()`; the bank must not
+ * be modified while a tick runs.
+ *
+ * \defgroup Tool_Pool Tool Worker Pool
+ * @{
+ */
+
+#ifndef TOOL_POOL_H
+#define TOOL_POOL_H
+
+#include "Tool_Batch.h"
+#include "Tool_Cfg.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================[macros]=================================================*/
+
+#define TOOL_POOL_WORKERS_MAX_U32 (64U)  /* Workers per pool, the caller included. */
+#define TOOL_POOL_CHUNK_BLOCKS_U32 (4U)  /* Blocks claimed per cursor step. */
+#define TOOL_POOL_LINE_U32 (64U)         /* Cache-line size assumed for the layout. */
+#define TOOL_POOL_ALIGNED __attribute__((aligned(TOOL_POOL_LINE_U32)))
+#define TOOL_POOL_NO_CPU_S32 (-1)        /* First CPU: do not pin the workers. */
+
+/*==================[types]==================================================*/
+
+struct Tool_pool_s;
+
+/**
+ * \brief Per-worker state, one cache line each.
+ */
+typedef struct {
+  uint32_t next_u32 TOOL_POOL_ALIGNED; /**< Next chunk of the share (claimed by atomic add). */
+  uint32_t end_u32;                    /**< End of the share (exclusive). */
+  uint32_t begin_u32;                  /**< Start of the share. */
+  uint32_t steals_u32;                 /**< Chunks taken from other shares (statistics). */
+  struct Tool_pool_s *pool_ps;         /**< Owning pool. */
+  pthread_t thr_s;                     /**< Thread (unused for worker 0, the caller). */
+  int32_t cpu_s32;                     /**< CPU to pin to, or TOOL_POOL_NO_CPU_S32. */
+  bool pinned_b;                       /**< Affinity set successfully. */
+} Tool_poolWorker_t;
+
+/**
+ * \brief Worker pool bound to one channel bank.
+ */
+typedef struct Tool_pool_s {
+  Tool_poolWorker_t worker_a[TOOL_POOL_WORKERS_MAX_U32]; /**< Worker 0 is the caller of Tool_PoolProcessAll(). */
+  Tool_batch_t *batch_ps;                                /**< Bank stepped by the pool. */
+  uint32_t workers_u32;                                  /**< Workers, the caller included. */
+  uint32_t chunks_u32;                                   /**< Chunks in the bank. */
+  uint32_t gen_u32 TOOL_POOL_ALIGNED;                    /**< Tick generation (futex word). */
+  uint32_t sleepers_u32;                                 /**< Workers asleep on gen_u32. */
+  uint32_t stop_u32;                                     /**< Non-zero: workers exit. */
+  uint32_t pending_u32 TOOL_POOL_ALIGNED;                /**< Workers still in the tick (futex word). */
+  uint32_t waiting_u32;                                  /**< Caller asleep on pending_u32. */
+} Tool_pool_t;
+
+/*==================[function prototypes]====================================*/
+
+/**
+ * @brief Start a worker pool for a channel bank.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Split the bank's chunks into `workers_u32` contiguous shares and start
+ * `workers_u32 - 1` threads. The thread calling `Tool_PoolProcessAll()` is
+ * worker 0; its affinity is not changed, `cpu0_s32` is the CPU it is
+ * expected to run on. Worker `i` is pinned to CPU
+ * `(cpu0_s32 + i) mod online CPUs`.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range              | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|------|--------------------|------|
+ * | pool_ps        |    |  X  | Tool_pool_t*                |  out  |   1    |   0    |   1  | pointer / NULL     | [-]  |
+ * | batch_ps       | X  |     | Tool_batch_t*               |   in  |   1    |   0    |   1  | pointer / NULL     | [-]  |
+ * | workers_u32    | X  |     | uint32_t                    |   in  |   1    |   0    |   1  | 1..WORKERS_MAX     | [-]  |
+ * | cpu0_s32       | X  |     | int32_t                     |   in  |   1    |   0    |   1  | -1..               | [-]  |
+ * | returned val   |    |  X  | uint8_t                     |  out  |   1    |   0    |   1  | {0,1,2,3}          | [-]  |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (pool_ps or batch_ps NULL) then (yes)
+ *   :return 3;
+ *   stop
+ * endif
+ * if (workers_u32 out of range) then (yes)
+ *   :return 2;
+ *   stop
+ * endif
+ * :chunks = ceil(blocks in use / CHUNK_BLOCKS);
+ * :share i = [chunks * i / workers, chunks * (i + 1) / workers);
+ * repeat :start worker i (1..), pinned to cpu0_s32 + i;
+ * repeat while (i < workers_u32)
+ * if (a thread failed to start) then (yes)
+ *   :stop started workers;
+ *   :return 1;
+ *   stop
+ * endif
+ * :return 0;
+ * stop
+ * @enduml
+ *
+ * @param pool_ps
+ * Pool to start.
+ *
+ * @param batch_ps
+ * Initialized channel bank; must outlive the pool.
+ *
+ * @param workers_u32
+ * Workers including the caller (1 .. `TOOL_POOL_WORKERS_MAX_U32`).
+ *
+ * @param cpu0_s32
+ * CPU of worker 0, or `TOOL_POOL_NO_CPU_S32` to leave all affinities alone.
+ *
+ * @return uint8_t
+ * - 0: Success; `worker_a[i].pinned_b` (i >= 1) tells which pins took
+ *   effect.
+ * - 1: A worker thread could not be created (nothing left running).
+ * - 2: `workers_u32` out of range.
+ * - 3: `pool_ps` or `batch_ps` is NULL.
+ */
+uint8_t Tool_PoolInit_u8(Tool_pool_t *pool_ps, Tool_batch_t *batch_ps, uint32_t workers_u32, int32_t cpu0_s32);
+
+/**
+ * @brief Stop the workers of a pool.
+ *
+ * @details
+ * Must not overlap with `Tool_PoolProcessAll()`.
+ *
+ * @param pool_ps
+ * Pool; NULL is ignored.
+ *
+ * @return void
+ */
+void Tool_PoolDeInit(Tool_pool_t *pool_ps);
+
+/**
+ * @brief Step every channel of the pool's bank once, in parallel.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Same result as `Tool_ProcessAll()` on the bank, with the work shared by
+ * all workers. Returns when the last worker has counted itself out of the
+ * tick.
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :reset every cursor to its share;
+ * :pending = workers; gen += 1;
+ * if (sleepers) then (yes)
+ *   :futex wake gen;
+ * endif
+ * repeat :claim chunk from own cursor, else from another worker's;
+ *   :Tool_ProcessBlocks_u8(chunk);
+ * repeat while (chunk claimed)
+ * :pending -= 1;
+ * while (pending != 0)
+ *   :spin, then futex wait pending;
+ * endwhile
+ * stop
+ * @enduml
+ *
+ * @param pool_ps
+ * Pool started with `Tool_PoolInit_u8()`; NULL is ignored.
+ *
+ * @return void
+ */
+void Tool_PoolProcessAll(Tool_pool_t *pool_ps);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOL_POOL_H */
+
+/** @} */
@@ -0,0 +1,251 @@
+/**
+ * \file Tool_Ring.h
+ * \brief Typed ring buffers generated per element type and capacity.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * `TOOL_DEFINE_RING(Name, type, cap)` expands to a ring type and a family of
+ * `static inline` functions specialised for `type` (any copyable C type:
+ * `uint16_t`, `uint32_t`, record structs) and a power-of-two capacity `cap`.
+ * Whole elements move in one copy, so word-sized samples no longer go through
+ * one `Tool_Push_u8()` per byte.
+ *
+ * Indices are free-running `Tool_cfgIdx_t` counters (TOOL_CFG_INDEX_WIDTH);
+ * the slot is `index & (cap - 1)`, so head and tail never need a modulo and
+ * full/empty are told apart without a separate count. With
+ * `TOOL_CFG_CONCURRENCY == TOOL_CFG_CONC_SPSC` one producer and one consumer
+ * context may use a ring concurrently: each index is published with release
+ * ordering after the element copy and read with acquire ordering.
+ *
+ * Layout: the producer-owned fields (write index, cached read index), the
+ * consumer-owned fields (read index, cached write index) and the data array
+ * each start on their own `TOOL_RING_LINE_U32`-byte line, so the two cores
+ * do not pull the same line back and forth. Each side re-reads the other
+ * side's index only when its cached copy says full (producer) or empty
+ * (consumer). Rings placed on the heap need an allocation aligned to
+ * `TOOL_RING_LINE_U32`.
+ *
+ * Example:
+ * @code
+ * TOOL_DEFINE_RING(Sample, uint32_t, 1024U)
+ *
+ * static Tool_ringSample_t Samples_s;
+ *
+ * Tool_RingSampleInit(&Samples_s);
+ * (void)Tool_RingSamplePush_u8(&Samples_s, 0x12345678UL);
+ * @endcode
+ *
+ * \defgroup Tool_Ring Tool Typed Rings
+ * @{
+ */
+
+#ifndef TOOL_RING_H
+#define TOOL_RING_H
+
+#include "Tool_Cfg.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================[macros]=================================================*/
+
+#if(TOOL_CFG_CONCURRENCY == TOOL_CFG_CONC_SPSC)
+#if defined(__GNUC__) || defined(__clang__)
+#define TOOL_RING_LOAD_ACQ(idx) __atomic_load_n(&(idx), __ATOMIC_ACQUIRE)
+#define TOOL_RING_STORE_REL(idx, val) __atomic_store_n(&(idx), (val), __ATOMIC_RELEASE)
+#else
+#error "Tool_Ring.h: provide acquire/release index accessors for this compiler"
+#endif
+#else
+#define TOOL_RING_LOAD_ACQ(idx) (idx)
+#define TOOL_RING_STORE_REL(idx, val) ((idx) = (val))
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TOOL_RING_LINE_U32 (64U) /* Cache-line size assumed for the layout. */
+#define TOOL_RING_ALIGNED __attribute__((aligned(TOOL_RING_LINE_U32)))
+#else
+#error "Tool_Ring.h: provide a member alignment attribute for this compiler"
+#endif
+
+/* Largest capacity whose fill level still fits a free-running index. */
+#define TOOL_RING_CAP_MAX_U32 ((uint32_t)((Tool_cfgIdx_t)~(Tool_cfgIdx_t)0U) / 2U + 1U)
+
+/**
+ * \brief Generate a typed ring `Tool_ring<Name>_t` and its functions.
+ *
+ * @details
+ * **Generated interface** (all `static inline`):
+ *
+ * | Function                                                    | Return                               |
+ * |-------------------------------------------------------------|--------------------------------------|
+ * | `void Tool_Ring<Name>Init(ring_ps)`                         | -                                    |
+ * | `uint32_t Tool_Ring<Name>Count_u32(ring_pcs)`               | elements queued (0 if NULL)          |
+ * | `uint8_t Tool_Ring<Name>Push_u8(ring_ps, type value)`       | 0 ok, 1 full, 2 `ring_ps == NULL`    |
+ * | `uint8_t Tool_Ring<Name>Pop_u8(ring_ps, type *value_p)`     | 0 ok, 1 empty, 3 NULL pointer        |
+ * | `uint32_t Tool_Ring<Name>PushN_u32(ring_ps, src_pc, n_u32)` | elements pushed (partial when full)  |
+ * | `uint32_t Tool_Ring<Name>PopN_u32(ring_ps, dst_p, n_u32)`   | elements popped (partial when empty) |
+ *
+ * The bulk functions copy at most two contiguous runs with `memcpy()`, which
+ * the compiler turns into vector moves for the element type at hand.
+ * `Tool_Ring<Name>Free_u32()` and `Tool_Ring<Name>Used_u32()` are the
+ * producer's and consumer's internal helpers around the cached indices.
+ *
+ * `cap` must be a power of two and not exceed `TOOL_RING_CAP_MAX_U32`;
+ * otherwise the expansion fails to compile (negative array size).
+ *
+ * @param Name
+ * Identifier fragment used in the generated names.
+ *
+ * @param type
+ * Element type.
+ *
+ * @param cap
+ * Capacity in elements (power of two).
+ */
+#define TOOL_DEFINE_RING(Name, type, cap)                                                                                                           \
+  typedef char Tool_ring##Name##CapChk_t[((((cap) & ((cap) - 1U)) == 0U) && ((cap) != 0U) && ((uint32_t)(cap) <= TOOL_RING_CAP_MAX_U32)) ? 1 : -1]; \
+                                                                                                                                                    \
+  typedef struct {                                                                                                                                  \
+    Tool_cfgIdx_t head_u TOOL_RING_ALIGNED; /* Free-running write index (producer line). */                                                         \
+    Tool_cfgIdx_t tailCache_u;              /* Producer's last view of tail_u. */                                                                   \
+    Tool_cfgIdx_t tail_u TOOL_RING_ALIGNED; /* Free-running read index (consumer line). */                                                          \
+    Tool_cfgIdx_t headCache_u;              /* Consumer's last view of head_u. */                                                                   \
+    type data_a[(cap)] TOOL_RING_ALIGNED;                                                                                                           \
+  } Tool_ring##Name##_t;                                                                                                                            \
+                                                                                                                                                    \
+  static inline void Tool_Ring##Name##Init(Tool_ring##Name##_t *ring_ps) {                                                                          \
+    if(ring_ps != NULL) {                                                                                                                           \
+      ring_ps->head_u = 0U;                                                                                                                         \
+      ring_ps->tailCache_u = 0U;                                                                                                                    \
+      ring_ps->tail_u = 0U;                                                                                                                         \
+      ring_ps->headCache_u = 0U;                                                                                                                    \
+    }                                                                                                                                               \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static inline uint32_t Tool_Ring##Name##Count_u32(const Tool_ring##Name##_t *ring_pcs) {                                                          \
+    uint32_t l_n_u32 = 0U;                                                                                                                          \
+                                                                                                                                                    \
+    if(ring_pcs != NULL) {                                                                                                                          \
+      l_n_u32 = (Tool_cfgIdx_t)(TOOL_RING_LOAD_ACQ(ring_pcs->head_u) - TOOL_RING_LOAD_ACQ(ring_pcs->tail_u));                                       \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_n_u32;                                                                                                                                 \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  /* Producer side: free slots, refreshing the cached tail only when short. */                                                                      \
+  static inline uint32_t Tool_Ring##Name##Free_u32(Tool_ring##Name##_t *ring_ps, Tool_cfgIdx_t head_u, uint32_t want_u32) {                         \
+    uint32_t l_free_u32 = (uint32_t)(cap) - (uint32_t)(Tool_cfgIdx_t)(head_u - ring_ps->tailCache_u);                                               \
+                                                                                                                                                    \
+    if(l_free_u32 < want_u32) {                                                                                                                     \
+      ring_ps->tailCache_u = TOOL_RING_LOAD_ACQ(ring_ps->tail_u);                                                                                   \
+      l_free_u32 = (uint32_t)(cap) - (uint32_t)(Tool_cfgIdx_t)(head_u - ring_ps->tailCache_u);                                                      \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_free_u32;                                                                                                                              \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  /* Consumer side: queued elements, refreshing the cached head only when short. */                                                                 \
+  static inline uint32_t Tool_Ring##Name##Used_u32(Tool_ring##Name##_t *ring_ps, Tool_cfgIdx_t tail_u, uint32_t want_u32) {                         \
+    uint32_t l_used_u32 = (uint32_t)(Tool_cfgIdx_t)(ring_ps->headCache_u - tail_u);                                                                 \
+                                                                                                                                                    \
+    if(l_used_u32 < want_u32) {                                                                                                                     \
+      ring_ps->headCache_u = TOOL_RING_LOAD_ACQ(ring_ps->head_u);                                                                                   \
+      l_used_u32 = (uint32_t)(Tool_cfgIdx_t)(ring_ps->headCache_u - tail_u);                                                                        \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_used_u32;                                                                                                                              \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static inline uint8_t Tool_Ring##Name##Push_u8(Tool_ring##Name##_t *ring_ps, type value) {                                                        \
+    uint8_t l_ret_u8 = 0U;                                                                                                                          \
+                                                                                                                                                    \
+    if(ring_ps == NULL) {                                                                                                                           \
+      l_ret_u8 = 2U;                                                                                                                                \
+    } else {                                                                                                                                        \
+      Tool_cfgIdx_t l_head_u = ring_ps->head_u;                                                                                                     \
+                                                                                                                                                    \
+      if(Tool_Ring##Name##Free_u32(ring_ps, l_head_u, 1U) == 0U) {                                                                                  \
+        l_ret_u8 = 1U;                                                                                                                              \
+      } else {                                                                                                                                      \
+        ring_ps->data_a[l_head_u & ((cap) - 1U)] = value;                                                                                           \
+        TOOL_RING_STORE_REL(ring_ps->head_u, (Tool_cfgIdx_t)(l_head_u + 1U));                                                                       \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_ret_u8;                                                                                                                                \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static inline uint8_t Tool_Ring##Name##Pop_u8(Tool_ring##Name##_t *ring_ps, type *value_p) {                                                      \
+    uint8_t l_ret_u8 = 0U;                                                                                                                          \
+                                                                                                                                                    \
+    if((ring_ps == NULL) || (value_p == NULL)) {                                                                                                    \
+      l_ret_u8 = 3U;                                                                                                                                \
+    } else {                                                                                                                                        \
+      Tool_cfgIdx_t l_tail_u = ring_ps->tail_u;                                                                                                     \
+                                                                                                                                                    \
+      if(Tool_Ring##Name##Used_u32(ring_ps, l_tail_u, 1U) == 0U) {                                                                                  \
+        l_ret_u8 = 1U;                                                                                                                              \
+      } else {                                                                                                                                      \
+        *value_p = ring_ps->data_a[l_tail_u & ((cap) - 1U)];                                                                                        \
+        TOOL_RING_STORE_REL(ring_ps->tail_u, (Tool_cfgIdx_t)(l_tail_u + 1U));                                                                       \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_ret_u8;                                                                                                                                \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static inline uint32_t Tool_Ring##Name##PushN_u32(Tool_ring##Name##_t *ring_ps, const type *src_pc, uint32_t n_u32) {                             \
+    uint32_t l_n_u32 = 0U;                                                                                                                          \
+                                                                                                                                                    \
+    if((ring_ps != NULL) && (src_pc != NULL)) {                                                                                                     \
+      Tool_cfgIdx_t l_head_u = ring_ps->head_u;                                                                                                     \
+      uint32_t l_free_u32 = Tool_Ring##Name##Free_u32(ring_ps, l_head_u, n_u32);                                                                    \
+      uint32_t l_pos_u32 = (uint32_t)(l_head_u & ((cap) - 1U));                                                                                     \
+      uint32_t l_run_u32;                                                                                                                           \
+                                                                                                                                                    \
+      l_n_u32 = (n_u32 > l_free_u32) ? l_free_u32 : n_u32;                                                                                          \
+      l_run_u32 = ((uint32_t)(cap) - l_pos_u32);                                                                                                    \
+      l_run_u32 = (l_n_u32 > l_run_u32) ? l_run_u32 : l_n_u32;                                                                                      \
+                                                                                                                                                    \
+      /* Up to the physical end of the array, then the wrapped remainder. */                                                                        \
+      (void)memcpy(&ring_ps->data_a[l_pos_u32], src_pc, (size_t)l_run_u32 * sizeof(type));                                                          \
+      (void)memcpy(&ring_ps->data_a[0], &src_pc[l_run_u32], (size_t)(l_n_u32 - l_run_u32) * sizeof(type));                                          \
+      TOOL_RING_STORE_REL(ring_ps->head_u, (Tool_cfgIdx_t)(l_head_u + l_n_u32));                                                                    \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_n_u32;                                                                                                                                 \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static inline uint32_t Tool_Ring##Name##PopN_u32(Tool_ring##Name##_t *ring_ps, type *dst_p, uint32_t n_u32) {                                     \
+    uint32_t l_n_u32 = 0U;                                                                                                                          \
+                                                                                                                                                    \
+    if((ring_ps != NULL) && (dst_p != NULL)) {                                                                                                      \
+      Tool_cfgIdx_t l_tail_u = ring_ps->tail_u;                                                                                                     \
+      uint32_t l_used_u32 = Tool_Ring##Name##Used_u32(ring_ps, l_tail_u, n_u32);                                                                    \
+      uint32_t l_pos_u32 = (uint32_t)(l_tail_u & ((cap) - 1U));                                                                                     \
+      uint32_t l_run_u32;                                                                                                                           \
+                                                                                                                                                    \
+      l_n_u32 = (n_u32 > l_used_u32) ? l_used_u32 : n_u32;                                                                                          \
+      l_run_u32 = ((uint32_t)(cap) - l_pos_u32);                                                                                                    \
+      l_run_u32 = (l_n_u32 > l_run_u32) ? l_run_u32 : l_n_u32;                                                                                      \
+                                                                                                                                                    \
+      (void)memcpy(dst_p, &ring_ps->data_a[l_pos_u32], (size_t)l_run_u32 * sizeof(type));                                                           \
+      (void)memcpy(&dst_p[l_run_u32], &ring_ps->data_a[0], (size_t)(l_n_u32 - l_run_u32) * sizeof(type));                                           \
+      TOOL_RING_STORE_REL(ring_ps->tail_u, (Tool_cfgIdx_t)(l_tail_u + l_n_u32));                                                                    \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_n_u32;                                                                                                                                 \
+  }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOL_RING_H */
+
+/** @} */
@@ -0,0 +1,344 @@
+/**
+ * \file Tool_Sched.c
+ * \brief Tool module cooperative scheduler: timer wheel plus earliest deadline first.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * \defgroup Tool_Sched Tool Scheduler
+ * @{
+ */
+
+#include "Tool_Sched.h"
+#include "Tool.h"
+#include "Tool_Batch.h"
+#include <stddef.h>
+#include <string.h>
+
+/*==================[local macros]===========================================*/
+
+#if((TOOL_SCHED_WHEEL_U32 & (TOOL_SCHED_WHEEL_U32 - 1U)) != 0U)
+#error "Tool_Sched: TOOL_SCHED_WHEEL_U32 must be a power of two"
+#endif
+
+#define TOOL_SCHED_SLOT_U32(tick) ((tick) & (TOOL_SCHED_WHEEL_U32 - 1U))
+
+/* Wrapping tick comparison: a is before or at b. */
+#define TOOL_SCHED_NOT_AFTER_B(a, b) ((int32_t)((a) - (b)) <= 0)
+
+/*==================[local functions]========================================*/
+
+static bool Tool_SchedEarlier_b(const Tool_sched_t *sched_ps, uint32_t a_u32, uint32_t b_u32) {
+  return (int32_t)(sched_ps->heap_a[a_u32]->due_u32 - sched_ps->heap_a[b_u32]->due_u32) < 0;
+}
+
+static void Tool_SchedSwap(Tool_sched_t *sched_ps, uint32_t a_u32, uint32_t b_u32) {
+  Tool_schedTask_t *l_t_ps = sched_ps->heap_a[a_u32];
+
+  sched_ps->heap_a[a_u32] = sched_ps->heap_a[b_u32];
+  sched_ps->heap_a[b_u32] = l_t_ps;
+}
+
+static void Tool_SchedHeapPush(Tool_sched_t *sched_ps, Tool_schedTask_t *task_ps) {
+  uint32_t l_i_u32 = sched_ps->ready_u32;
+
+  sched_ps->heap_a[l_i_u32] = task_ps;
+  sched_ps->ready_u32++;
+  task_ps->ready_b = true;
+  while((l_i_u32 > 0U) && Tool_SchedEarlier_b(sched_ps, l_i_u32, (l_i_u32 - 1U) / 2U)) {
+    Tool_SchedSwap(sched_ps, l_i_u32, (l_i_u32 - 1U) / 2U);
+    l_i_u32 = (l_i_u32 - 1U) / 2U;
+  }
+}
+
+/* Take entry idx_u32 out of the heap; the last entry fills the hole. */
+static Tool_schedTask_t *Tool_SchedHeapTake_ps(Tool_sched_t *sched_ps, uint32_t idx_u32) {
+  Tool_schedTask_t *l_take_ps = sched_ps->heap_a[idx_u32];
+  uint32_t l_i_u32 = idx_u32;
+
+  sched_ps->ready_u32--;
+  sched_ps->heap_a[idx_u32] = sched_ps->heap_a[sched_ps->ready_u32];
+  while((l_i_u32 > 0U) && (l_i_u32 < sched_ps->ready_u32) && Tool_SchedEarlier_b(sched_ps, l_i_u32, (l_i_u32 - 1U) / 2U)) {
+    Tool_SchedSwap(sched_ps, l_i_u32, (l_i_u32 - 1U) / 2U);
+    l_i_u32 = (l_i_u32 - 1U) / 2U;
+  }
+  for(;;) {
+    uint32_t l_min_u32 = l_i_u32;
+    uint32_t l_l_u32 = (2U * l_i_u32) + 1U;
+
+    if((l_l_u32 < sched_ps->ready_u32) && Tool_SchedEarlier_b(sched_ps, l_l_u32, l_min_u32)) {
+      l_min_u32 = l_l_u32;
+    }
+    if(((l_l_u32 + 1U) < sched_ps->ready_u32) && Tool_SchedEarlier_b(sched_ps, l_l_u32 + 1U, l_min_u32)) {
+      l_min_u32 = l_l_u32 + 1U;
+    }
+    if(l_min_u32 == l_i_u32) {
+      break;
+    }
+    Tool_SchedSwap(sched_ps, l_i_u32, l_min_u32);
+    l_i_u32 = l_min_u32;
+  }
+  l_take_ps->ready_b = false;
+
+  return l_take_ps;
+}
+
+static void Tool_SchedArm(Tool_sched_t *sched_ps, Tool_schedTask_t *task_ps) {
+  uint32_t l_slot_u32 = TOOL_SCHED_SLOT_U32(task_ps->release_u32);
+
+  task_ps->next_ps = sched_ps->slot_a[l_slot_u32];
+  task_ps->armed_b = true;
+  sched_ps->slot_a[l_slot_u32] = task_ps;
+}
+
+/* Registered: the table entry named by the task points back at it, so a
+ * stale or uninitialized reg_u32 never matches. */
+static bool Tool_SchedOwns_b(const Tool_sched_t *sched_ps, const Tool_schedTask_t *task_ps) {
+  return (task_ps->reg_u32 < sched_ps->tasks_u32) && (sched_ps->task_a[task_ps->reg_u32] == task_ps);
+}
+
+static uint8_t Tool_SchedCheck_u8(const Tool_sched_t *sched_ps, const Tool_schedTask_t *task_ps) {
+  uint8_t l_ret_u8 = 0U;
+
+  if((sched_ps == NULL) || (task_ps == NULL) || (task_ps->run_pf == NULL)) {
+    l_ret_u8 = 3U;
+  } else if((task_ps->deadline_u32 == 0U) || ((task_ps->period_u32 != 0U) && (task_ps->deadline_u32 > task_ps->period_u32))) {
+    l_ret_u8 = 2U;
+  } else if(Tool_SchedOwns_b(sched_ps, task_ps)) {
+    l_ret_u8 = 4U;
+  } else if(sched_ps->tasks_u32 >= TOOL_SCHED_TASKS_MAX_U32) {
+    l_ret_u8 = 1U;
+  } else {
+    /* Registrable. */
+  }
+
+  return l_ret_u8;
+}
+
+/* Register a checked task and arm its release offset_u32 ticks from now. */
+static void Tool_SchedEnter(Tool_sched_t *sched_ps, Tool_schedTask_t *task_ps, uint32_t offset_u32) {
+  task_ps->release_u32 = sched_ps->now_u32 + offset_u32;
+  task_ps->due_u32 = 0U;
+  task_ps->next_ps = NULL;
+  task_ps->ready_b = false;
+  task_ps->reg_u32 = sched_ps->tasks_u32;
+  sched_ps->task_a[sched_ps->tasks_u32] = task_ps;
+  sched_ps->tasks_u32++;
+  /* Offset 0: the slot of now_u32 is visited again by the next pass. */
+  Tool_SchedArm(sched_ps, task_ps);
+}
+
+/* Free the table entry of a registered task; the last entry moves into it. */
+static void Tool_SchedLeave(Tool_sched_t *sched_ps, Tool_schedTask_t *task_ps) {
+  uint32_t l_reg_u32 = task_ps->reg_u32;
+
+  sched_ps->tasks_u32--;
+  sched_ps->task_a[l_reg_u32] = sched_ps->task_a[sched_ps->tasks_u32];
+  sched_ps->task_a[l_reg_u32]->reg_u32 = l_reg_u32;
+  sched_ps->task_a[sched_ps->tasks_u32] = NULL;
+  task_ps->reg_u32 = TOOL_SCHED_TASKS_MAX_U32;
+}
+
+/* Move the due tasks of one slot into the EDF heap. */
+static void Tool_SchedExpire(Tool_sched_t *sched_ps, uint32_t slot_u32, uint32_t now_u32) {
+  Tool_schedTask_t **l_link_pps = &sched_ps->slot_a[slot_u32];
+
+  while(*l_link_pps != NULL) {
+    Tool_schedTask_t *l_t_ps = *l_link_pps;
+
+    if(TOOL_SCHED_NOT_AFTER_B(l_t_ps->release_u32, now_u32)) {
+      *l_link_pps = l_t_ps->next_ps;
+      l_t_ps->next_ps = NULL;
+      l_t_ps->armed_b = false;
+      l_t_ps->due_u32 = l_t_ps->release_u32 + l_t_ps->deadline_u32;
+      Tool_SchedHeapPush(sched_ps, l_t_ps);
+    } else {
+      l_link_pps = &l_t_ps->next_ps;
+    }
+  }
+}
+
+/* Next release of a periodic task; releases whose deadline already passed are
+ * dropped as misses. */
+static void Tool_SchedRearm(Tool_sched_t *sched_ps, Tool_schedTask_t *task_ps, uint32_t now_u32) {
+  int32_t l_over_s32;
+
+  task_ps->release_u32 += task_ps->period_u32;
+  l_over_s32 = (int32_t)(now_u32 - (task_ps->release_u32 + task_ps->deadline_u32));
+  if(l_over_s32 > 0) {
+    uint32_t l_late_u32 = (((uint32_t)l_over_s32 - 1U) / task_ps->period_u32) + 1U;
+
+    task_ps->misses_u32 += l_late_u32;
+    sched_ps->misses_u32 += l_late_u32;
+    task_ps->release_u32 += l_late_u32 * task_ps->period_u32;
+  }
+  Tool_SchedArm(sched_ps, task_ps);
+}
+
+/*==================[global functions]=======================================*/
+
+uint8_t Tool_SchedInit_u8(Tool_sched_t *sched_ps, Tool_schedClock_pf clock_pf) {
+  uint8_t l_ret_u8 = 0U;
+
+  if((sched_ps == NULL) || (clock_pf == NULL)) {
+    l_ret_u8 = 3U;
+  } else {
+    (void)memset(sched_ps, 0, sizeof(*sched_ps));
+    sched_ps->clock_pf = clock_pf;
+    sched_ps->now_u32 = clock_pf();
+  }
+
+  return l_ret_u8;
+}
+
+uint8_t Tool_SchedAdd_u8(Tool_sched_t *sched_ps, Tool_schedTask_t *task_ps, uint32_t offset_u32) {
+  uint8_t l_ret_u8 = Tool_SchedCheck_u8(sched_ps, task_ps);
+
+  if(l_ret_u8 == 0U) {
+    task_ps->runs_u32 = 0U;
+    task_ps->skips_u32 = 0U;
+    task_ps->misses_u32 = 0U;
+    task_ps->slackLast_s32 = 0;
+    task_ps->slackMin_s32 = INT32_MAX;
+    Tool_SchedEnter(sched_ps, task_ps, offset_u32);
+  }
+
+  return l_ret_u8;
+}
+
+uint8_t Tool_SchedRelease_u8(Tool_sched_t *sched_ps, Tool_schedTask_t *task_ps, uint32_t offset_u32) {
+  uint8_t l_ret_u8 = Tool_SchedCheck_u8(sched_ps, task_ps);
+
+  if((l_ret_u8 == 0U) && (task_ps->period_u32 != 0U)) {
+    l_ret_u8 = 2U;
+  } else if(l_ret_u8 == 0U) {
+    Tool_SchedEnter(sched_ps, task_ps, offset_u32);
+  } else {
+    /* Rejected, task left untouched. */
+  }
+
+  return l_ret_u8;
+}
+
+uint8_t Tool_SchedRemove_u8(Tool_sched_t *sched_ps, Tool_schedTask_t *task_ps) {
+  uint8_t l_ret_u8 = 0U;
+
+  if((sched_ps == NULL) || (task_ps == NULL)) {
+    l_ret_u8 = 3U;
+  } else if(!Tool_SchedOwns_b(sched_ps, task_ps)) {
+    l_ret_u8 = 1U;
+  } else {
+    if(task_ps->armed_b) {
+      Tool_schedTask_t **l_link_pps = &sched_ps->slot_a[TOOL_SCHED_SLOT_U32(task_ps->release_u32)];
+
+      while(*l_link_pps != task_ps) {
+        l_link_pps = &(*l_link_pps)->next_ps;
+      }
+      *l_link_pps = task_ps->next_ps;
+      task_ps->next_ps = NULL;
+      task_ps->armed_b = false;
+    } else if(task_ps->ready_b) {
+      uint32_t l_i_u32 = 0U;
+
+      while(sched_ps->heap_a[l_i_u32] != task_ps) {
+        l_i_u32++;
+      }
+      (void)Tool_SchedHeapTake_ps(sched_ps, l_i_u32);
+    } else {
+      /* Job running: only the re-arm is prevented. */
+    }
+    Tool_SchedLeave(sched_ps, task_ps);
+  }
+
+  return l_ret_u8;
+}
+
+uint32_t Tool_SchedRun_u32(Tool_sched_t *sched_ps) {
+  uint32_t l_runs_u32 = 0U;
+
+  if(sched_ps != NULL) {
+    uint32_t l_now_u32 = sched_ps->clock_pf();
+    uint32_t l_gap_u32 = l_now_u32 - sched_ps->now_u32;
+
+    /* Slots of ticks [last, now]; one full turn covers any longer gap. The
+     * slot of the last tick is revisited for releases added at that tick. */
+    l_gap_u32 = (l_gap_u32 >= TOOL_SCHED_WHEEL_U32) ? (TOOL_SCHED_WHEEL_U32 - 1U) : l_gap_u32;
+    for(uint32_t l_t_u32 = 0U; l_t_u32 <= l_gap_u32; l_t_u32++) {
+      Tool_SchedExpire(sched_ps, TOOL_SCHED_SLOT_U32(l_now_u32 - l_t_u32), l_now_u32);
+    }
+    sched_ps->now_u32 = l_now_u32;
+
+    while(sched_ps->ready_u32 != 0U) {
+      Tool_schedTask_t *l_t_ps = Tool_SchedHeapTake_ps(sched_ps, 0U);
+
+      if(l_t_ps->period_u32 == 0U) {
+        /* One job only: retire first, so the job body may release it again. */
+        Tool_SchedLeave(sched_ps, l_t_ps);
+      }
+      if((l_t_ps->idle_pf != NULL) && l_t_ps->idle_pf(l_t_ps->arg_pv)) {
+        l_t_ps->skips_u32++;
+        sched_ps->skips_u32++;
+      } else {
+        int32_t l_slack_s32;
+
+        l_t_ps->run_pf(l_t_ps->arg_pv);
+        l_slack_s32 = (int32_t)(l_t_ps->due_u32 - sched_ps->clock_pf());
+        l_t_ps->runs_u32++;
+        sched_ps->runs_u32++;
+        l_runs_u32++;
+        l_t_ps->slackLast_s32 = l_slack_s32;
+        l_t_ps->slackMin_s32 = (l_slack_s32 < l_t_ps->slackMin_s32) ? l_slack_s32 : l_t_ps->slackMin_s32;
+        if(l_slack_s32 < 0) {
+          l_t_ps->misses_u32++;
+          sched_ps->misses_u32++;
+        }
+      }
+      /* Not if the job body removed the task, or removed and added it again. */
+      if((l_t_ps->period_u32 != 0U) && Tool_SchedOwns_b(sched_ps, l_t_ps) && !l_t_ps->armed_b && !l_t_ps->ready_b) {
+        Tool_SchedRearm(sched_ps, l_t_ps, l_now_u32);
+      }
+    }
+  }
+
+  return l_runs_u32;
+}
+
+void Tool_SchedProcess(void *arg_pv) {
+  (void)arg_pv;
+  Tool_Process();
+}
+
+void Tool_SchedRunTst(void *arg_pv) {
+  (void)arg_pv;
+  (void)Tool_RunTst_u8();
+}
+
+bool Tool_SchedCoreIdle_b(const void *arg_pcv) {
+  Tool_snapshot_t l_snap_s;
+  bool l_idle_b = false;
+
+  (void)arg_pcv;
+  if(Tool_GetSnapshot_u8(&l_snap_s) == 0U) {
+    l_idle_b = (l_snap_s.mode_e == Tool_modeIdle_e) || (l_snap_s.count_u32 == 0U);
+  }
+
+  return l_idle_b;
+}
+
+void Tool_SchedBankProcess(void *arg_pv) {
+  Tool_ProcessAll((Tool_batch_t *)arg_pv);
+}
+
+bool Tool_SchedBankIdle_b(const void *arg_pcv) {
+  const Tool_batch_t *l_batch_pcs = (const Tool_batch_t *)arg_pcv;
+  uint32_t l_busy_u32 = 0U;
+
+  if(l_batch_pcs != NULL) {
+    for(uint32_t l_ch_u32 = 0U; l_ch_u32 < l_batch_pcs->n_u32; l_ch_u32++) {
+      l_busy_u32 |= ((l_batch_pcs->mode_au8[l_ch_u32] == (uint8_t)Tool_modeRun_e) && (l_batch_pcs->count_au32[l_ch_u32] != 0U)) ? 1U : 0U;
+    }
+  }
+
+  return l_busy_u32 == 0U;
+}
+
+/** @} */
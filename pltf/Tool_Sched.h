@@ -0,0 +1,308 @@
+/**
+ * \file Tool_Sched.h
+ * \brief Tool module cooperative scheduler: timer wheel plus earliest deadline first.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * Replaces the fixed-rate integrator loop that calls `Tool_Process()`,
+ * `Tool_RunTst_u8()` and friends whether or not there is anything to do.
+ * Tasks are plain function pointers with an optional idle check:
+ *
+ * - releases are kept in a timer wheel of `TOOL_SCHED_WHEEL_U32` slots
+ *   indexed by release tick, so advancing time only visits the slots that
+ *   came due, whatever the number of tasks;
+ * - released jobs wait in a heap ordered by absolute deadline and are run
+ *   earliest deadline first (EDF);
+ * - a job whose idle check returns true is skipped instead of run (counted
+ *   in `skips_u32`): the ready-made checks skip the module while it is IDLE
+ *   or `Tool_Count_u32` is 0, and a channel bank while no RUN channel holds data.
+ *
+ * A one-shot task (period 0) retires when its job is taken and frees its
+ * table entry; `Tool_SchedRelease_u8()` releases it again, from anywhere in
+ * the scheduler's thread including its own job body. `Tool_SchedRemove_u8()`
+ * takes any task out, periodic ones included.
+ *
+ * After each job the clock is read again; the signed distance to the
+ * deadline is the job's slack. Negative slack counts as a missed deadline,
+ * and so does a periodic release whose deadline passed before the
+ * scheduler got to it (the job is dropped, not run late).
+ *
+ * Time is whatever `clock_pf` returns (ticks of any unit, wrapping at 2^32);
+ * periods and deadlines are in the same unit. Everything runs in the thread
+ * that calls `Tool_SchedRun_u32()`; no locks, no allocation.
+ *
+ * Example:
+ * @code
+ * static Tool_sched_t Sched_s;
+ * static Tool_schedTask_t Proc_s = {.run_pf = Tool_SchedProcess, .idle_pf = Tool_SchedCoreIdle_b, .period_u32 = 10U, .deadline_u32 = 5U};
+ * static Tool_schedTask_t Tst_s = {.run_pf = Tool_SchedRunTst, .period_u32 = 1000U, .deadline_u32 = 1000U};
+ *
+ * (void)Tool_SchedInit_u8(&Sched_s, MyClockMs_u32);
+ * (void)Tool_SchedAdd_u8(&Sched_s, &Proc_s, 0U);
+ * (void)Tool_SchedAdd_u8(&Sched_s, &Tst_s, 500U);
+ * for(;;) {
+ *   (void)Tool_SchedRun_u32(&Sched_s);
+ *   MySleepMs(1U);
+ * }
+ * @endcode
+ *
+ * \defgroup Tool_Sched Tool Scheduler
+ * @{
+ */
+
+#ifndef TOOL_SCHED_H
+#define TOOL_SCHED_H
+
+#include "Tool_Cfg.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================[macros]=================================================*/
+
+#define TOOL_SCHED_WHEEL_U32 (64U)     /* Timer-wheel slots (power of two). */
+#define TOOL_SCHED_TASKS_MAX_U32 (32U) /* Tasks per scheduler. */
+
+/*==================[types]==================================================*/
+
+/**
+ * \brief Job body.
+ */
+typedef void (*Tool_schedRun_pf)(void *arg_pv);
+
+/**
+ * \brief Idle check: true when running the job now would do nothing.
+ */
+typedef bool (*Tool_schedIdle_pf)(const void *arg_pcv);
+
+/**
+ * \brief Time source (monotonic ticks, wrapping).
+ */
+typedef uint32_t (*Tool_schedClock_pf)(void);
+
+/**
+ * \brief One task. The first five fields are set by the caller, the rest is
+ * maintained by the scheduler.
+ */
+typedef struct Tool_schedTask_s {
+  Tool_schedRun_pf run_pf;          /**< Job body. */
+  Tool_schedIdle_pf idle_pf;        /**< Idle check, NULL: never skipped. */
+  void *arg_pv;                     /**< Argument of run_pf / idle_pf. */
+  uint32_t period_u32;              /**< Ticks between releases, 0: one job only. */
+  uint32_t deadline_u32;            /**< Relative deadline in ticks after a release. */
+  uint32_t release_u32;             /**< Absolute tick of the next release. */
+  uint32_t due_u32;                 /**< Absolute deadline of the released job. */
+  struct Tool_schedTask_s *next_ps; /**< Next task in the same wheel slot. */
+  uint32_t reg_u32;                 /**< Entry in the scheduler's task table. */
+  bool armed_b;                     /**< Waiting in a wheel slot. */
+  bool ready_b;                     /**< Released, waiting in the EDF heap. */
+  uint32_t runs_u32;                /**< Jobs run. */
+  uint32_t skips_u32;               /**< Jobs skipped by the idle check. */
+  uint32_t misses_u32;              /**< Deadlines missed (late finish or dropped release). */
+  int32_t slackLast_s32;            /**< Slack of the last job run, in ticks. */
+  int32_t slackMin_s32;             /**< Smallest slack seen. */
+} Tool_schedTask_t;
+
+/**
+ * \brief Scheduler state.
+ */
+typedef struct {
+  Tool_schedTask_t *slot_a[TOOL_SCHED_WHEEL_U32];     /**< Timer wheel: tasks by release tick. */
+  Tool_schedTask_t *heap_a[TOOL_SCHED_TASKS_MAX_U32]; /**< Released jobs, min-heap on due_u32. */
+  Tool_schedTask_t *task_a[TOOL_SCHED_TASKS_MAX_U32]; /**< Registered tasks, tasks_u32 entries. */
+  uint32_t ready_u32;                                 /**< Entries in heap_a. */
+  uint32_t tasks_u32;                                 /**< Tasks registered (added, not retired or removed). */
+  uint32_t now_u32;                                   /**< Last tick the wheel was advanced to. */
+  Tool_schedClock_pf clock_pf;                        /**< Time source. */
+  uint32_t runs_u32;                                  /**< Jobs run, all tasks. */
+  uint32_t skips_u32;                                 /**< Jobs skipped, all tasks. */
+  uint32_t misses_u32;                                /**< Deadlines missed, all tasks. */
+} Tool_sched_t;
+
+/*==================[function prototypes]====================================*/
+
+/**
+ * @brief Reset a scheduler.
+ *
+ * @param sched_ps
+ * Scheduler.
+ *
+ * @param clock_pf
+ * Time source; read once here and after each job.
+ *
+ * @return uint8_t
+ * - 0: Success.
+ * - 3: `sched_ps` or `clock_pf` is NULL.
+ */
+uint8_t Tool_SchedInit_u8(Tool_sched_t *sched_ps, Tool_schedClock_pf clock_pf);
+
+/**
+ * @brief Add a task.
+ *
+ * @details
+ * The caller fills `run_pf`, `idle_pf`, `arg_pv`, `period_u32` and
+ * `deadline_u32`; the statistics are cleared here. The first job is
+ * released `offset_u32` ticks from now, each later one `period_u32` ticks
+ * after the previous release. A periodic task stays registered until
+ * `Tool_SchedRemove_u8()`; a one-shot task retires when its job is taken.
+ *
+ * @param sched_ps
+ * Scheduler.
+ *
+ * @param task_ps
+ * Task; must stay valid while registered.
+ *
+ * @param offset_u32
+ * Ticks until the first release (0: at the next `Tool_SchedRun_u32()`).
+ *
+ * @return uint8_t
+ * - 0: Success.
+ * - 1: `TOOL_SCHED_TASKS_MAX_U32` tasks registered.
+ * - 2: `deadline_u32` is 0, or `deadline_u32` exceeds a non-zero period.
+ * - 3: `sched_ps`, `task_ps` or `task_ps->run_pf` is NULL.
+ * - 4: `task_ps` is already registered with this scheduler (left untouched).
+ */
+uint8_t Tool_SchedAdd_u8(Tool_sched_t *sched_ps, Tool_schedTask_t *task_ps, uint32_t offset_u32);
+
+/**
+ * @brief Release a retired one-shot task again.
+ *
+ * @details
+ * Like `Tool_SchedAdd_u8()`, but the statistics are kept, so a one-shot
+ * task can be re-armed by an event (or by its own job body) and its runs,
+ * skips, misses and slack accumulate.
+ *
+ * @param sched_ps
+ * Scheduler.
+ *
+ * @param task_ps
+ * One-shot task (`period_u32` 0).
+ *
+ * @param offset_u32
+ * Ticks until the release (0: at the next `Tool_SchedRun_u32()`).
+ *
+ * @return uint8_t
+ * - 0: Success.
+ * - 1: `TOOL_SCHED_TASKS_MAX_U32` tasks registered.
+ * - 2: `deadline_u32` is 0, or the task is periodic.
+ * - 3: `sched_ps`, `task_ps` or `task_ps->run_pf` is NULL.
+ * - 4: the task is still registered (release pending or job running).
+ */
+uint8_t Tool_SchedRelease_u8(Tool_sched_t *sched_ps, Tool_schedTask_t *task_ps, uint32_t offset_u32);
+
+/**
+ * @brief Take a task out of the scheduler.
+ *
+ * @details
+ * A pending release or a released job is dropped and the table entry is
+ * freed. Called from the task's own job body, it stops a periodic task
+ * from being re-armed. Statistics are kept.
+ *
+ * @param sched_ps
+ * Scheduler.
+ *
+ * @param task_ps
+ * Task.
+ *
+ * @return uint8_t
+ * - 0: Success.
+ * - 1: The task is not registered with this scheduler.
+ * - 3: `sched_ps` or `task_ps` is NULL.
+ */
+uint8_t Tool_SchedRemove_u8(Tool_sched_t *sched_ps, Tool_schedTask_t *task_ps);
+
+/**
+ * @brief Release due jobs and run every ready job, earliest deadline first.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * One cooperative scheduling pass, called from the integrator's main loop
+ * whenever it has time (at least once per shortest deadline).
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range          | Unit    |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|------|----------------|---------|
+ * | sched_ps       | X  |  X  | Tool_sched_t*               | inout |   1    |   0    |   1  | pointer / NULL | [-]     |
+ * | clock_pf()     | X  |     | uint32_t                    |   -   |   1    |   0    |   1  | wrapping       | [tick]  |
+ * | runs, skips,   |    |  X  | uint32_t (per task, total)  |   -   |   1    |   0    |   1  | -              | [-]     |
+ * | misses         |    |     |                             |       |        |        |      |                |         |
+ * | slack          |    |  X  | int32_t (per task)          |   -   |   1    |   0    |   1  | -              | [tick]  |
+ * | returned val   |    |  X  | uint32_t                    |  out  |   1    |   0    |   1  | 0..TASKS_MAX   | [-]     |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :now = clock_pf();
+ * repeat :visit wheel slots of ticks (last, now] (all slots once if the gap exceeds the wheel);
+ *   :tasks with release <= now -> EDF heap (due = release + deadline);
+ * repeat while (more slots)
+ * while (heap not empty)
+ *   :pop job with earliest due;
+ *   if (one-shot) then (yes)
+ *     :retire: free the table entry;
+ *   endif
+ *   if (idle_pf(arg) true) then (idle)
+ *     :skips++;
+ *   else (work)
+ *     :run_pf(arg); runs++;
+ *     :slack = due - clock_pf(); misses++ if slack < 0;
+ *   endif
+ *   if (periodic and still registered) then (yes)
+ *     :release += period (releases already past their deadline are counted and dropped);
+ *     :insert into wheel slot of release;
+ *   endif
+ * endwhile
+ * :return jobs run;
+ * stop
+ * @enduml
+ *
+ * @param sched_ps
+ * Scheduler; NULL runs nothing.
+ *
+ * @return uint32_t
+ * Jobs run in this pass (skipped jobs not included).
+ */
+uint32_t Tool_SchedRun_u32(Tool_sched_t *sched_ps);
+
+/**
+ * @brief Job body: `Tool_Process()` (argument unused).
+ */
+void Tool_SchedProcess(void *arg_pv);
+
+/**
+ * @brief Job body: `Tool_RunTst_u8()` (argument unused, result in the status).
+ */
+void Tool_SchedRunTst(void *arg_pv);
+
+/**
+ * @brief Idle check for the module singleton: IDLE mode or `Tool_Count_u32` 0.
+ *
+ * @details
+ * Reads a coherent `Tool_GetSnapshot_u8()`; when none is obtained the job
+ * runs (not idle).
+ */
+bool Tool_SchedCoreIdle_b(const void *arg_pcv);
+
+/**
+ * @brief Job body: `Tool_ProcessAll()` on the `Tool_batch_t` passed as argument.
+ */
+void Tool_SchedBankProcess(void *arg_pv);
+
+/**
+ * @brief Idle check for a `Tool_batch_t`: no channel is in RUN mode with data.
+ */
+bool Tool_SchedBankIdle_b(const void *arg_pcv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOL_SCHED_H */
+
+/** @} */
@@ -0,0 +1,241 @@
+/**
+ * \file Tool_Shard.h
+ * \brief Sharded front-end: one typed SPSC ring per producer, one consumer.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * A single ring serializes every producer on its write index. With
+ * `TOOL_DEFINE_SHARDS(Name, type, cap, shards)` each producer thread (core)
+ * owns one lane, a `TOOL_DEFINE_RING()` ring of its own, so producers never
+ * share a cache line and throughput grows with their number. One consumer
+ * drains the lanes:
+ *
+ * - round-robin: each pop serves the lane under the cursor and advances it,
+ *   so a busy lane cannot starve the others,
+ * - stealing: if the lane under the cursor is empty, the pop is served from
+ *   the fullest lane instead of returning empty, which drains a backlog
+ *   first and keeps bursts from overflowing.
+ *
+ * Statistics merge into the module's status surface:
+ * `Tool_Shard<Name>GetSnapshot_u8()` fills a `Tool_snapshot_t` with the total
+ * fill level, the summed lane indices and `TOOL_STATUS_OVF_U32` if any lane
+ * rejected a push since the last `Tool_Shard<Name>ClearStatus()`.
+ *
+ * The lanes rely on the acquire/release ring indices, so the header
+ * requires `TOOL_CFG_CONCURRENCY` SPSC.
+ *
+ * Example:
+ * @code
+ * TOOL_DEFINE_SHARDS(Rx, uint32_t, 1024U, 4U)
+ *
+ * static Tool_shardRx_t Rx_s;
+ *
+ * Tool_ShardRxInit(&Rx_s);
+ * (void)Tool_ShardRxPush_u8(&Rx_s, producerIdx, sample);  // producer thread
+ * n = Tool_ShardRxPopN_u32(&Rx_s, buf, 64U);              // consumer thread
+ * @endcode
+ *
+ * \defgroup Tool_Shard Tool Sharded Queues
+ * @{
+ */
+
+#ifndef TOOL_SHARD_H
+#define TOOL_SHARD_H
+
+#include "Tool.h"
+#include "Tool_Ring.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if(TOOL_CFG_CONCURRENCY != TOOL_CFG_CONC_SPSC)
+#error "Tool_Shard.h: lanes are filled and drained from different threads (use CONCURRENCY=SPSC)"
+#endif
+
+/*==================[macros]=================================================*/
+
+/**
+ * @brief Define a sharded queue type `Tool_shard<Name>_t` and its functions.
+ *
+ * @details
+ * Generated interface (`<Name>` replaced by the macro argument):
+ *
+ * | Function                                             | Context  | Returns                                   |
+ * |------------------------------------------------------|----------|-------------------------------------------|
+ * | `void Tool_Shard<Name>Init(sh)`                       | setup    | -                                         |
+ * | `uint8_t Tool_Shard<Name>Push_u8(sh, lane, value)`    | producer | 0 ok, 1 lane full, 2 NULL / bad lane      |
+ * | `uint32_t Tool_Shard<Name>PushN_u32(sh, lane, src, n)`| producer | elements pushed                           |
+ * | `uint8_t Tool_Shard<Name>Pop_u8(sh, value_p)`         | consumer | 0 ok, 1 all lanes empty, 3 NULL           |
+ * | `uint32_t Tool_Shard<Name>PopN_u32(sh, dst, n)`       | consumer | elements popped (from one lane)           |
+ * | `uint8_t Tool_Shard<Name>GetSnapshot_u8(sh, snap)`    | consumer | 0 ok, 2 NULL                              |
+ * | `void Tool_Shard<Name>ClearStatus(sh)`                | consumer | -                                         |
+ *
+ * Each lane index must be used by exactly one producer context at a time. A
+ * rejected push counts as an overflow of its lane; the producer-owned
+ * counter lives on its own line and the consumer acknowledges it in
+ * `ClearStatus`, so neither side writes the other's fields. The lanes are
+ * `Tool_ring<Name>Shard_t` rings and keep their own layout guarantees.
+ *
+ * @param Name
+ * Identifier fragment used in the generated names.
+ *
+ * @param type
+ * Element type.
+ *
+ * @param cap
+ * Capacity of each lane in elements (power of two).
+ *
+ * @param shards
+ * Number of lanes (at least 1).
+ */
+#define TOOL_DEFINE_SHARDS(Name, type, cap, shards)                                                                                                 \
+  TOOL_DEFINE_RING(Name##Shard, type, cap)                                                                                                          \
+                                                                                                                                                    \
+  typedef char Tool_shard##Name##NumChk_t[((shards) != 0U) ? 1 : -1];                                                                               \
+                                                                                                                                                    \
+  typedef struct {                                                                                                                                  \
+    Tool_ring##Name##Shard_t ring_s;                                                                                                                \
+    uint32_t ovf_u32 TOOL_RING_ALIGNED; /* Rejected pushes (producer line). */                                                                      \
+  } Tool_shard##Name##Lane_t;                                                                                                                       \
+                                                                                                                                                    \
+  typedef struct {                                                                                                                                  \
+    Tool_shard##Name##Lane_t lane_a[(shards)];                                                                                                      \
+    uint32_t next_u32 TOOL_RING_ALIGNED; /* Round-robin cursor (consumer line). */                                                                  \
+    uint32_t steal_u32;                  /* Pops served from the fullest shard. */                                                                  \
+    uint32_t ovfAck_a[(shards)];         /* Overflow counts acknowledged by ClearStatus. */                                                         \
+  } Tool_shard##Name##_t;                                                                                                                           \
+                                                                                                                                                    \
+  static inline void Tool_Shard##Name##Init(Tool_shard##Name##_t *shard_ps) {                                                                       \
+    if(shard_ps != NULL) {                                                                                                                          \
+      for(uint32_t l_i_u32 = 0U; l_i_u32 < (uint32_t)(shards); l_i_u32++) {                                                                         \
+        Tool_Ring##Name##ShardInit(&shard_ps->lane_a[l_i_u32].ring_s);                                                                              \
+        shard_ps->lane_a[l_i_u32].ovf_u32 = 0U;                                                                                                     \
+        shard_ps->ovfAck_a[l_i_u32] = 0U;                                                                                                           \
+      }                                                                                                                                             \
+      shard_ps->next_u32 = 0U;                                                                                                                      \
+      shard_ps->steal_u32 = 0U;                                                                                                                     \
+    }                                                                                                                                               \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static inline uint8_t Tool_Shard##Name##Push_u8(Tool_shard##Name##_t *shard_ps, uint32_t lane_u32, type value) {                                  \
+    uint8_t l_ret_u8 = 2U;                                                                                                                          \
+                                                                                                                                                    \
+    if((shard_ps != NULL) && (lane_u32 < (uint32_t)(shards))) {                                                                                     \
+      Tool_shard##Name##Lane_t *l_lane_ps = &shard_ps->lane_a[lane_u32];                                                                            \
+                                                                                                                                                    \
+      l_ret_u8 = Tool_Ring##Name##ShardPush_u8(&l_lane_ps->ring_s, value);                                                                          \
+      if(l_ret_u8 != 0U) {                                                                                                                          \
+        TOOL_RING_STORE_REL(l_lane_ps->ovf_u32, l_lane_ps->ovf_u32 + 1U);                                                                           \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_ret_u8;                                                                                                                                \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static inline uint32_t Tool_Shard##Name##PushN_u32(Tool_shard##Name##_t *shard_ps, uint32_t lane_u32, const type *src_pc, uint32_t n_u32) {       \
+    uint32_t l_n_u32 = 0U;                                                                                                                          \
+                                                                                                                                                    \
+    if((shard_ps != NULL) && (lane_u32 < (uint32_t)(shards))) {                                                                                     \
+      Tool_shard##Name##Lane_t *l_lane_ps = &shard_ps->lane_a[lane_u32];                                                                            \
+                                                                                                                                                    \
+      l_n_u32 = Tool_Ring##Name##ShardPushN_u32(&l_lane_ps->ring_s, src_pc, n_u32);                                                                 \
+      if((l_n_u32 < n_u32) && (src_pc != NULL)) {                                                                                                   \
+        TOOL_RING_STORE_REL(l_lane_ps->ovf_u32, l_lane_ps->ovf_u32 + 1U);                                                                           \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_n_u32;                                                                                                                                 \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  /* Consumer side: index of the fullest shard, (shards) if all are empty. */                                                                       \
+  static inline uint32_t Tool_Shard##Name##Fullest_u32(Tool_shard##Name##_t *shard_ps) {                                                            \
+    uint32_t l_best_u32 = (uint32_t)(shards);                                                                                                       \
+    uint32_t l_max_u32 = 0U;                                                                                                                        \
+                                                                                                                                                    \
+    for(uint32_t l_i_u32 = 0U; l_i_u32 < (uint32_t)(shards); l_i_u32++) {                                                                           \
+      uint32_t l_cnt_u32 = Tool_Ring##Name##ShardCount_u32(&shard_ps->lane_a[l_i_u32].ring_s);                                                      \
+                                                                                                                                                    \
+      if(l_cnt_u32 > l_max_u32) {                                                                                                                   \
+        l_max_u32 = l_cnt_u32;                                                                                                                      \
+        l_best_u32 = l_i_u32;                                                                                                                       \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_best_u32;                                                                                                                              \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static inline uint32_t Tool_Shard##Name##PopN_u32(Tool_shard##Name##_t *shard_ps, type *dst_p, uint32_t n_u32) {                                  \
+    uint32_t l_n_u32 = 0U;                                                                                                                          \
+                                                                                                                                                    \
+    if((shard_ps != NULL) && (dst_p != NULL) && (n_u32 != 0U)) {                                                                                    \
+      uint32_t l_lane_u32 = shard_ps->next_u32;                                                                                                     \
+                                                                                                                                                    \
+      shard_ps->next_u32 = ((l_lane_u32 + 1U) == (uint32_t)(shards)) ? 0U : (l_lane_u32 + 1U);                                                      \
+      l_n_u32 = Tool_Ring##Name##ShardPopN_u32(&shard_ps->lane_a[l_lane_u32].ring_s, dst_p, n_u32);                                                 \
+      if(l_n_u32 == 0U) {                                                                                                                           \
+        l_lane_u32 = Tool_Shard##Name##Fullest_u32(shard_ps);                                                                                       \
+        if(l_lane_u32 < (uint32_t)(shards)) {                                                                                                       \
+          l_n_u32 = Tool_Ring##Name##ShardPopN_u32(&shard_ps->lane_a[l_lane_u32].ring_s, dst_p, n_u32);                                             \
+          shard_ps->steal_u32 += (l_n_u32 != 0U) ? 1U : 0U;                                                                                         \
+        }                                                                                                                                           \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_n_u32;                                                                                                                                 \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static inline uint8_t Tool_Shard##Name##Pop_u8(Tool_shard##Name##_t *shard_ps, type *value_p) {                                                   \
+    uint8_t l_ret_u8 = 3U;                                                                                                                          \
+                                                                                                                                                    \
+    if((shard_ps != NULL) && (value_p != NULL)) {                                                                                                   \
+      l_ret_u8 = (Tool_Shard##Name##PopN_u32(shard_ps, value_p, 1U) == 1U) ? 0U : 1U;                                                               \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_ret_u8;                                                                                                                                \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static inline uint8_t Tool_Shard##Name##GetSnapshot_u8(Tool_shard##Name##_t *shard_ps, Tool_snapshot_t *snapshot_ps) {                            \
+    uint8_t l_ret_u8 = 2U;                                                                                                                          \
+                                                                                                                                                    \
+    if((shard_ps != NULL) && (snapshot_ps != NULL)) {                                                                                               \
+      snapshot_ps->mode_e = Tool_modeRun_e;                                                                                                         \
+      snapshot_ps->statusFlg_u32 = TOOL_STATUS_INIT_U32;                                                                                            \
+      snapshot_ps->count_u32 = 0U;                                                                                                                  \
+      snapshot_ps->head_u32 = 0U;                                                                                                                   \
+      snapshot_ps->tail_u32 = 0U;                                                                                                                   \
+      for(uint32_t l_i_u32 = 0U; l_i_u32 < (uint32_t)(shards); l_i_u32++) {                                                                         \
+        Tool_shard##Name##Lane_t *l_lane_ps = &shard_ps->lane_a[l_i_u32];                                                                           \
+        uint32_t l_tail_u32 = (uint32_t)l_lane_ps->ring_s.tail_u;                                                                                   \
+        uint32_t l_head_u32 = (uint32_t)TOOL_RING_LOAD_ACQ(l_lane_ps->ring_s.head_u);                                                               \
+                                                                                                                                                    \
+        snapshot_ps->head_u32 += l_head_u32;                                                                                                        \
+        snapshot_ps->tail_u32 += l_tail_u32;                                                                                                        \
+        snapshot_ps->count_u32 += (uint32_t)(Tool_cfgIdx_t)(l_head_u32 - l_tail_u32);                                                               \
+        if(TOOL_RING_LOAD_ACQ(l_lane_ps->ovf_u32) != shard_ps->ovfAck_a[l_i_u32]) {                                                                 \
+          snapshot_ps->statusFlg_u32 |= TOOL_STATUS_OVF_U32;                                                                                        \
+        }                                                                                                                                           \
+      }                                                                                                                                             \
+      l_ret_u8 = 0U;                                                                                                                                \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    return l_ret_u8;                                                                                                                                \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static inline void Tool_Shard##Name##ClearStatus(Tool_shard##Name##_t *shard_ps) {                                                                \
+    if(shard_ps != NULL) {                                                                                                                          \
+      for(uint32_t l_i_u32 = 0U; l_i_u32 < (uint32_t)(shards); l_i_u32++) {                                                                         \
+        shard_ps->ovfAck_a[l_i_u32] = TOOL_RING_LOAD_ACQ(shard_ps->lane_a[l_i_u32].ovf_u32);                                                        \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+  }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOL_SHARD_H */
+
+/** @} */
@@ -0,0 +1,244 @@
+/**
+ * \file Tool_Sum.c
+ * \brief Tool module byte-sum reduction with runtime-dispatched SIMD kernels.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * \defgroup Tool_Sum Tool Byte Sum
+ * @{
+ */
+
+#include "Tool_Sum.h"
+#include <stddef.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define TOOL_SUM_X86
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define TOOL_SUM_NEON
+#endif
+
+/*==================[local macros]===========================================*/
+
+/* UADALP steps before the 16-bit lanes could overflow (128 * 2 * 255 < 2^16). */
+#define TOOL_SUM_NEON_STEPS_U32 (128U)
+
+/*==================[local types]============================================*/
+
+typedef uint32_t (*Tool_sumKernel_pf)(const uint8_t *data_pcu8, uint32_t length_u32);
+
+/*==================[local data]=============================================*/
+
+static uint32_t Tool_SumResolve_u32(const uint8_t *data_pcu8, uint32_t length_u32);
+
+/* Kernel in use; the first call goes through the resolver. */
+static Tool_sumKernel_pf SumKernel_pf = Tool_SumResolve_u32;
+
+/*==================[local functions]========================================*/
+
+static uint32_t Tool_SumScalar_u32(const uint8_t *data_pcu8, uint32_t length_u32) {
+  uint32_t l_sum_u32 = 0U;
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < length_u32; l_i_u32++) {
+    l_sum_u32 += (uint32_t)data_pcu8[l_i_u32];
+  }
+
+  return l_sum_u32;
+}
+
+#if defined(TOOL_SUM_X86)
+__attribute__((target("sse2"))) static uint32_t Tool_SumSse2_u32(const uint8_t *data_pcu8, uint32_t length_u32) {
+  const __m128i l_zero_s = _mm_setzero_si128();
+  __m128i l_acc0_s = _mm_setzero_si128();
+  __m128i l_acc1_s = _mm_setzero_si128();
+  uint32_t l_i_u32 = 0U;
+
+  /* Two independent accumulators hide the PSADBW latency. */
+  for(; (length_u32 - l_i_u32) >= 32U; l_i_u32 += 32U) {
+    __m128i l_a_s = _mm_loadu_si128((const __m128i *)(const void *)&data_pcu8[l_i_u32]);
+    __m128i l_b_s = _mm_loadu_si128((const __m128i *)(const void *)&data_pcu8[l_i_u32 + 16U]);
+
+    l_acc0_s = _mm_add_epi64(l_acc0_s, _mm_sad_epu8(l_a_s, l_zero_s));
+    l_acc1_s = _mm_add_epi64(l_acc1_s, _mm_sad_epu8(l_b_s, l_zero_s));
+  }
+  if((length_u32 - l_i_u32) >= 16U) {
+    __m128i l_a_s = _mm_loadu_si128((const __m128i *)(const void *)&data_pcu8[l_i_u32]);
+
+    l_acc0_s = _mm_add_epi64(l_acc0_s, _mm_sad_epu8(l_a_s, l_zero_s));
+    l_i_u32 += 16U;
+  }
+  l_acc0_s = _mm_add_epi64(l_acc0_s, l_acc1_s);
+  l_acc0_s = _mm_add_epi64(l_acc0_s, _mm_srli_si128(l_acc0_s, 8));
+
+  return (uint32_t)_mm_cvtsi128_si32(l_acc0_s) + Tool_SumScalar_u32(&data_pcu8[l_i_u32], length_u32 - l_i_u32);
+}
+
+__attribute__((target("avx2"))) static uint32_t Tool_SumAvx2_u32(const uint8_t *data_pcu8, uint32_t length_u32) {
+  const __m256i l_zero_s = _mm256_setzero_si256();
+  __m256i l_acc0_s = _mm256_setzero_si256();
+  __m256i l_acc1_s = _mm256_setzero_si256();
+  __m128i l_acc_s;
+  uint32_t l_i_u32 = 0U;
+
+  for(; (length_u32 - l_i_u32) >= 64U; l_i_u32 += 64U) {
+    __m256i l_a_s = _mm256_loadu_si256((const __m256i *)(const void *)&data_pcu8[l_i_u32]);
+    __m256i l_b_s = _mm256_loadu_si256((const __m256i *)(const void *)&data_pcu8[l_i_u32 + 32U]);
+
+    l_acc0_s = _mm256_add_epi64(l_acc0_s, _mm256_sad_epu8(l_a_s, l_zero_s));
+    l_acc1_s = _mm256_add_epi64(l_acc1_s, _mm256_sad_epu8(l_b_s, l_zero_s));
+  }
+  l_acc0_s = _mm256_add_epi64(l_acc0_s, l_acc1_s);
+  l_acc_s = _mm_add_epi64(_mm256_castsi256_si128(l_acc0_s), _mm256_extracti128_si256(l_acc0_s, 1));
+  l_acc_s = _mm_add_epi64(l_acc_s, _mm_srli_si128(l_acc_s, 8));
+
+  /* Remainder below 64 bytes: the SSE2 kernel finishes it. */
+  return (uint32_t)_mm_cvtsi128_si32(l_acc_s) + Tool_SumSse2_u32(&data_pcu8[l_i_u32], length_u32 - l_i_u32);
+}
+#endif
+
+#if defined(TOOL_SUM_NEON)
+static uint32_t Tool_SumNeon_u32(const uint8_t *data_pcu8, uint32_t length_u32) {
+  uint32_t l_sum_u32 = 0U;
+  uint32_t l_i_u32 = 0U;
+
+  while((length_u32 - l_i_u32) >= 16U) {
+    uint32_t l_steps_u32 = (length_u32 - l_i_u32) / 16U;
+    uint16x8_t l_acc_s = vdupq_n_u16(0U);
+
+    l_steps_u32 = (l_steps_u32 > TOOL_SUM_NEON_STEPS_U32) ? TOOL_SUM_NEON_STEPS_U32 : l_steps_u32;
+    for(uint32_t l_s_u32 = 0U; l_s_u32 < l_steps_u32; l_s_u32++) {
+      l_acc_s = vpadalq_u8(l_acc_s, vld1q_u8(&data_pcu8[l_i_u32]));
+      l_i_u32 += 16U;
+    }
+    l_sum_u32 += vaddlvq_u16(l_acc_s);
+  }
+
+  return l_sum_u32 + Tool_SumScalar_u32(&data_pcu8[l_i_u32], length_u32 - l_i_u32);
+}
+#endif
+
+/* Kernel of each Tool_sumKernel_e, NULL when not compiled in. */
+static Tool_sumKernel_pf Tool_SumKernelOf_pf(Tool_sumKernel_e kernel_e) {
+  Tool_sumKernel_pf l_k_pf = NULL;
+
+  switch(kernel_e) {
+    case Tool_sumKernelScalar_e:
+      l_k_pf = Tool_SumScalar_u32;
+      break;
+#if defined(TOOL_SUM_X86)
+    case Tool_sumKernelSse2_e:
+      l_k_pf = Tool_SumSse2_u32;
+      break;
+    case Tool_sumKernelAvx2_e:
+      l_k_pf = Tool_SumAvx2_u32;
+      break;
+#endif
+#if defined(TOOL_SUM_NEON)
+    case Tool_sumKernelNeon_e:
+      l_k_pf = Tool_SumNeon_u32;
+      break;
+#endif
+    default:
+      break;
+  }
+
+  return l_k_pf;
+}
+
+static bool Tool_SumCpuHas_b(Tool_sumKernel_e kernel_e) {
+  bool l_has_b = false;
+
+  switch(kernel_e) {
+    case Tool_sumKernelScalar_e:
+      l_has_b = true;
+      break;
+#if defined(TOOL_SUM_X86)
+    case Tool_sumKernelSse2_e:
+      __builtin_cpu_init();
+      l_has_b = (__builtin_cpu_supports("sse2") != 0);
+      break;
+    case Tool_sumKernelAvx2_e:
+      __builtin_cpu_init();
+      l_has_b = (__builtin_cpu_supports("avx2") != 0);
+      break;
+#endif
+#if defined(TOOL_SUM_NEON)
+    case Tool_sumKernelNeon_e:
+      l_has_b = true; /* Advanced SIMD is mandatory on AArch64. */
+      break;
+#endif
+    default:
+      break;
+  }
+
+  return l_has_b;
+}
+
+static uint32_t Tool_SumResolve_u32(const uint8_t *data_pcu8, uint32_t length_u32) {
+  Tool_sumKernel_pf l_k_pf = Tool_SumKernelOf_pf(Tool_SumBest_e());
+
+  /* Racing first calls all store the same pointer. */
+  __atomic_store_n(&SumKernel_pf, l_k_pf, __ATOMIC_RELAXED);
+
+  return l_k_pf(data_pcu8, length_u32);
+}
+
+/*==================[global functions]=======================================*/
+
+uint32_t Tool_SumBytes_u32(const uint8_t *data_pcu8, uint32_t length_u32) {
+  uint32_t l_sum_u32 = 0U;
+
+  if((data_pcu8 != NULL) && (length_u32 != 0U)) {
+    l_sum_u32 = __atomic_load_n(&SumKernel_pf, __ATOMIC_RELAXED)(data_pcu8, length_u32);
+  }
+
+  return l_sum_u32;
+}
+
+Tool_sumKernel_e Tool_SumBest_e(void) {
+  Tool_sumKernel_e l_best_e = Tool_sumKernelScalar_e;
+
+  /* Later entries are faster on the same architecture. */
+  for(uint32_t l_k_u32 = 1U; l_k_u32 < TOOL_SUM_KERNELS_U32; l_k_u32++) {
+    if((Tool_SumKernelOf_pf((Tool_sumKernel_e)l_k_u32) != NULL) && Tool_SumCpuHas_b((Tool_sumKernel_e)l_k_u32)) {
+      l_best_e = (Tool_sumKernel_e)l_k_u32;
+    }
+  }
+
+  return l_best_e;
+}
+
+Tool_sumKernel_e Tool_SumActive_e(void) {
+  Tool_sumKernel_pf l_k_pf = __atomic_load_n(&SumKernel_pf, __ATOMIC_RELAXED);
+  Tool_sumKernel_e l_act_e = Tool_sumKernelScalar_e;
+
+  if(l_k_pf == Tool_SumResolve_u32) {
+    l_act_e = Tool_SumBest_e();
+    __atomic_store_n(&SumKernel_pf, Tool_SumKernelOf_pf(l_act_e), __ATOMIC_RELAXED);
+  } else {
+    for(uint32_t l_k_u32 = 0U; l_k_u32 < TOOL_SUM_KERNELS_U32; l_k_u32++) {
+      if(Tool_SumKernelOf_pf((Tool_sumKernel_e)l_k_u32) == l_k_pf) {
+        l_act_e = (Tool_sumKernel_e)l_k_u32;
+      }
+    }
+  }
+
+  return l_act_e;
+}
+
+uint8_t Tool_SumSelect_u8(Tool_sumKernel_e kernel_e) {
+  uint8_t l_ret_u8 = 0U;
+
+  if((uint32_t)kernel_e >= TOOL_SUM_KERNELS_U32) {
+    l_ret_u8 = 2U;
+  } else if((Tool_SumKernelOf_pf(kernel_e) == NULL) || !Tool_SumCpuHas_b(kernel_e)) {
+    l_ret_u8 = 1U;
+  } else {
+    __atomic_store_n(&SumKernel_pf, Tool_SumKernelOf_pf(kernel_e), __ATOMIC_RELAXED);
+  }
+
+  return l_ret_u8;
+}
+
+/** @} */
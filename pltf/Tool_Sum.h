@@ -0,0 +1,137 @@
+/**
+ * \file Tool_Sum.h
+ * \brief Tool module byte-sum reduction with runtime-dispatched SIMD kernels.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * `Tool_SumBytes_u32()` adds up a byte range, e.g. the ring memory checked
+ * by `Tool_RunTst_u8()`. The work is done by one of several kernels, all
+ * giving the same result:
+ *
+ * - scalar: portable C loop, always available;
+ * - SSE2 (x86): PSADBW against zero, 16 bytes into two 64-bit lanes per
+ *   instruction;
+ * - AVX2 (x86): VPSADBW on 32 bytes;
+ * - NEON (AArch64): UADALP pairwise accumulation into 16-bit lanes, folded
+ *   with one UADDLV every 2 KiB.
+ *
+ * The kernel is chosen on the first call from what the running CPU supports
+ * (`Tool_SumBest_e()`), so one binary uses AVX2 where it exists and SSE2
+ * elsewhere. `Tool_SumSelect_u8()` overrides the choice, e.g. to compare
+ * the kernels in a benchmark.
+ *
+ * \defgroup Tool_Sum Tool Byte Sum
+ * @{
+ */
+
+#ifndef TOOL_SUM_H
+#define TOOL_SUM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================[macros]=================================================*/
+
+#define TOOL_SUM_KERNELS_U32 (4U) /* Entries of Tool_sumKernel_e. */
+
+/*==================[types]==================================================*/
+
+/**
+ * \brief Byte-sum kernel.
+ */
+typedef enum {
+  Tool_sumKernelScalar_e = 0, /**< Portable C loop. */
+  Tool_sumKernelSse2_e = 1,   /**< x86 PSADBW, 16 bytes per step. */
+  Tool_sumKernelAvx2_e = 2,   /**< x86 VPSADBW, 32 bytes per step. */
+  Tool_sumKernelNeon_e = 3    /**< AArch64 UADALP + UADDLV, 16 bytes per step. */
+} Tool_sumKernel_e;
+
+/*==================[function prototypes]====================================*/
+
+/**
+ * @brief Sum of a byte range.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Return `sum(data_pcu8[i])` for `i` in `0..length_u32-1`, modulo 2^32
+ * (exact up to 16 MiB), with the kernel currently selected.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size   | Range          | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|--------|----------------|------|
+ * | data_pcu8      | X  |     | const uint8_t*              |   in  |   1    |   0    | length | pointer / NULL | [-]  |
+ * | length_u32     | X  |     | uint32_t                    |   in  |   1    |   0    |   1    | 0..2^32-1      | [B]  |
+ * | returned val   |    |  X  | uint32_t                    |  out  |   1    |   0    |   1    | mod 2^32       | [-]  |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (data_pcu8 NULL or length_u32 0) then (yes)
+ *   :return 0;
+ *   stop
+ * endif
+ * if (first call) then (yes)
+ *   :kernel = Tool_SumBest_e();
+ * endif
+ * :return kernel(data_pcu8, length_u32);
+ * stop
+ * @enduml
+ *
+ * @param data_pcu8
+ * Bytes to add; no alignment needed.
+ *
+ * @param length_u32
+ * Number of bytes.
+ *
+ * @return uint32_t
+ * Sum of the bytes, 0 for a NULL pointer or an empty range.
+ */
+uint32_t Tool_SumBytes_u32(const uint8_t *data_pcu8, uint32_t length_u32);
+
+/**
+ * @brief Fastest kernel compiled in and supported by the running CPU.
+ *
+ * @return Tool_sumKernel_e
+ * AVX2, else SSE2 on x86; NEON on AArch64; scalar otherwise.
+ */
+Tool_sumKernel_e Tool_SumBest_e(void);
+
+/**
+ * @brief Kernel used by `Tool_SumBytes_u32()` (resolved if not done yet).
+ *
+ * @return Tool_sumKernel_e
+ * Selected kernel.
+ */
+Tool_sumKernel_e Tool_SumActive_e(void);
+
+/**
+ * @brief Select the kernel used by `Tool_SumBytes_u32()`.
+ *
+ * @details
+ * Meant for tests and benchmarks; the selection is global and takes effect
+ * for calls that start afterwards.
+ *
+ * @param kernel_e
+ * Kernel to use.
+ *
+ * @return uint8_t
+ * - 0: Success.
+ * - 1: Kernel not compiled in for this target or not supported by the CPU.
+ * - 2: `kernel_e` out of range.
+ */
+uint8_t Tool_SumSelect_u8(Tool_sumKernel_e kernel_e);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOL_SUM_H */
+
+/** @} */
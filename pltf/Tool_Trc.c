@@ -0,0 +1,172 @@
+/**
+ * \file Tool_Trc.c
+ * \brief Tool binary event trace implementation.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * \defgroup Tool_Trc Tool Event Trace
+ * @{
+ */
+
+#include "Tool_Trc.h"
+#include <stddef.h>
+
+#if(TOOL_CFG_TRACE != 0U)
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_TRC_MASK_U32 (TOOL_TRC_DEPTH_U32 - 1U)
+#define TOOL_TRC_DT_MAX_U32 (0xFFFFUL)
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TOOL_TRC_FENCE_ACQ() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define TOOL_TRC_FENCE_REL() __atomic_thread_fence(__ATOMIC_RELEASE)
+#else
+#error "Tool_Trc.c: provide acquire/release fences for this compiler"
+#endif
+
+/*==================[external data]==========================================*/
+
+volatile uint8_t Tool_TrcOn_u8 = 0U;
+
+/*==================[local data]=============================================*/
+
+static Tool_trcRec_t Rec_s[TOOL_TRC_DEPTH_U32];
+static volatile uint32_t Wr_u32;
+/* Set once DEPTH records were written: Wr_u32 alone wraps after 2^32. */
+static volatile uint8_t Full_u8;
+static uint32_t LastTs_u32;
+static Tool_trcClock_pf Clock_pf;
+
+/*==================[local functions]========================================*/
+
+static uint32_t Tool_TrcNow_u32(void) {
+  uint32_t l_now_u32 = 0U;
+
+  if(Clock_pf != NULL) {
+    l_now_u32 = Clock_pf();
+  }
+
+  return l_now_u32;
+}
+
+static void Tool_TrcPut16(uint8_t *out_pu8, uint16_t value_u16) {
+  out_pu8[0] = (uint8_t)(value_u16 & 0xFFU);
+  out_pu8[1] = (uint8_t)((value_u16 >> 8U) & 0xFFU);
+}
+
+static void Tool_TrcPut32(uint8_t *out_pu8, uint32_t value_u32) {
+  Tool_TrcPut16(&out_pu8[0], (uint16_t)(value_u32 & 0xFFFFUL));
+  Tool_TrcPut16(&out_pu8[2], (uint16_t)((value_u32 >> 16U) & 0xFFFFUL));
+}
+
+/*==================[global functions]=======================================*/
+
+void Tool_TrcEnable(bool enable_b) {
+  if(enable_b) {
+    LastTs_u32 = Tool_TrcNow_u32();
+    Tool_TrcOn_u8 = 1U;
+  } else {
+    Tool_TrcOn_u8 = 0U;
+  }
+}
+
+void Tool_TrcSetClock(Tool_trcClock_pf clock_pf) {
+  Clock_pf = clock_pf;
+  LastTs_u32 = Tool_TrcNow_u32();
+}
+
+void Tool_TrcLog(uint8_t op_u8, uint8_t ret_u8, uint32_t count_u32) {
+  uint32_t l_now_u32 = Tool_TrcNow_u32();
+  uint32_t l_dt_u32 = l_now_u32 - LastTs_u32;
+  uint32_t l_wr_u32 = Wr_u32;
+  Tool_trcRec_t *l_rec_ps = &Rec_s[l_wr_u32 & TOOL_TRC_MASK_U32];
+
+  LastTs_u32 = l_now_u32;
+
+  l_rec_ps->op_u8 = op_u8;
+  l_rec_ps->ret_u8 = ret_u8;
+  l_rec_ps->count_u16 = (uint16_t)(count_u32 & 0xFFFFUL);
+  l_rec_ps->dt_u16 = (uint16_t)((l_dt_u32 > TOOL_TRC_DT_MAX_U32) ? TOOL_TRC_DT_MAX_U32 : l_dt_u32);
+
+  if(l_wr_u32 >= TOOL_TRC_MASK_U32) {
+    Full_u8 = 1U;
+  }
+
+  /* Publish the record (and Full_u8) before the index that makes it visible. */
+  TOOL_TRC_FENCE_REL();
+  Wr_u32 = l_wr_u32 + 1U;
+}
+
+void Tool_TrcReset(void) {
+  Wr_u32 = 0U;
+  Full_u8 = 0U;
+  LastTs_u32 = Tool_TrcNow_u32();
+}
+
+uint32_t Tool_TrcDump_u32(uint8_t *out_pu8, uint32_t size_u32) {
+  uint32_t l_len_u32 = 0U;
+
+  if((out_pu8 != NULL) && (size_u32 >= TOOL_TRC_HDR_SIZE_U32)) {
+    uint32_t l_room_u32 = (size_u32 - TOOL_TRC_HDR_SIZE_U32) / TOOL_TRC_REC_SIZE_U32;
+    uint32_t l_wr0_u32;
+    uint32_t l_wr1_u32;
+    uint32_t l_n_u32;
+    uint32_t l_first_u32;
+    uint32_t l_drop_u32 = 0U;
+    uint32_t l_i_u32;
+    uint8_t *l_dst_pu8 = &out_pu8[TOOL_TRC_HDR_SIZE_U32];
+
+    l_wr0_u32 = Wr_u32;
+    TOOL_TRC_FENCE_ACQ();
+
+    /* Newest records that fit, at most one ring's worth. */
+    l_n_u32 = ((Full_u8 != 0U) || (l_wr0_u32 > TOOL_TRC_DEPTH_U32)) ? TOOL_TRC_DEPTH_U32 : l_wr0_u32;
+    l_n_u32 = (l_n_u32 > l_room_u32) ? l_room_u32 : l_n_u32;
+    l_first_u32 = l_wr0_u32 - l_n_u32;
+
+    for(l_i_u32 = 0U; l_i_u32 < l_n_u32; l_i_u32++) {
+      const Tool_trcRec_t *l_rec_pcs = &Rec_s[(l_first_u32 + l_i_u32) & TOOL_TRC_MASK_U32];
+      uint8_t *l_out_pu8 = &l_dst_pu8[l_i_u32 * TOOL_TRC_REC_SIZE_U32];
+
+      l_out_pu8[0] = l_rec_pcs->op_u8;
+      l_out_pu8[1] = l_rec_pcs->ret_u8;
+      Tool_TrcPut16(&l_out_pu8[2], l_rec_pcs->count_u16);
+      Tool_TrcPut16(&l_out_pu8[4], l_rec_pcs->dt_u16);
+    }
+
+    TOOL_TRC_FENCE_ACQ();
+    l_wr1_u32 = Wr_u32;
+
+    /* The writer may have lapped the oldest copied slots: drop them. Record
+     * l_wr1_u32 may be half written, and it shares its slot with l_wr1 - DEPTH. */
+    if((l_wr1_u32 - l_first_u32) >= TOOL_TRC_DEPTH_U32) {
+      l_drop_u32 = ((l_wr1_u32 - l_first_u32) - TOOL_TRC_DEPTH_U32) + 1U;
+      l_drop_u32 = (l_drop_u32 > l_n_u32) ? l_n_u32 : l_drop_u32;
+    }
+
+    for(l_i_u32 = 0U; l_i_u32 < ((l_n_u32 - l_drop_u32) * TOOL_TRC_REC_SIZE_U32); l_i_u32++) {
+      l_dst_pu8[l_i_u32] = l_dst_pu8[l_i_u32 + (l_drop_u32 * TOOL_TRC_REC_SIZE_U32)];
+    }
+    l_n_u32 -= l_drop_u32;
+    l_first_u32 += l_drop_u32;
+
+    out_pu8[0] = (uint8_t)'T';
+    out_pu8[1] = (uint8_t)'T';
+    out_pu8[2] = (uint8_t)'R';
+    out_pu8[3] = (uint8_t)'C';
+    out_pu8[4] = TOOL_TRC_VERSION_U8;
+    out_pu8[5] = (uint8_t)TOOL_TRC_REC_SIZE_U32;
+    Tool_TrcPut16(&out_pu8[6], 0U);
+    Tool_TrcPut32(&out_pu8[8], l_n_u32);
+    Tool_TrcPut32(&out_pu8[12], l_first_u32);
+
+    l_len_u32 = TOOL_TRC_HDR_SIZE_U32 + (l_n_u32 * TOOL_TRC_REC_SIZE_U32);
+  }
+
+  return l_len_u32;
+}
+
+#endif /* TOOL_CFG_TRACE */
+
+/** @} */
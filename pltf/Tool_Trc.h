@@ -0,0 +1,291 @@
+/**
+ * \file Tool_Trc.h
+ * \brief Tool binary event trace interface.
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * \defgroup Tool_Trc Tool Event Trace
+ * @{
+ */
+
+#ifndef TOOL_TRC_H
+#define TOOL_TRC_H
+
+#include "Tool_Cfg.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================[macros]=================================================*/
+
+#define TOOL_TRC_DEPTH_U32 (256U) /* Records kept, power of two. */
+#define TOOL_TRC_REC_SIZE_U32 (6U)
+#define TOOL_TRC_HDR_SIZE_U32 (16U)
+#define TOOL_TRC_VERSION_U8 (1U)
+
+#if((TOOL_TRC_DEPTH_U32 & (TOOL_TRC_DEPTH_U32 - 1U)) != 0U)
+#error "TOOL_TRC_DEPTH_U32 must be a power of two"
+#endif
+
+/**
+ * \brief Log one API call when tracing is enabled.
+ *
+ * When tracing is off at runtime this is a single load and a branch that is
+ * predicted not taken; the record is built out of line. With TOOL_CFG_TRACE
+ * set to 0 the hook expands to nothing.
+ */
+#if(TOOL_CFG_TRACE == 0U)
+#define TOOL_TRC(op, ret, count) \
+  do {                           \
+  } while(0)
+#elif defined(__GNUC__) || defined(__clang__)
+#define TOOL_TRC(op, ret, count)                                 \
+  do {                                                           \
+    if(__builtin_expect((int)(Tool_TrcOn_u8 != 0U), 0) != 0) {   \
+      Tool_TrcLog((uint8_t)(op), (uint8_t)(ret), (count));       \
+    }                                                            \
+  } while(0)
+#else
+#define TOOL_TRC(op, ret, count)                                 \
+  do {                                                           \
+    if(Tool_TrcOn_u8 != 0U) {                                    \
+      Tool_TrcLog((uint8_t)(op), (uint8_t)(ret), (count));       \
+    }                                                            \
+  } while(0)
+#endif
+
+/*==================[types]==================================================*/
+
+/**
+ * \brief Traced operation codes.
+ */
+typedef enum {
+  Tool_trcOpNone_e = 0,
+  Tool_trcOpInit_e = 1,
+  Tool_trcOpDeInit_e = 2,
+  Tool_trcOpSetMode_e = 3,
+  Tool_trcOpPush_e = 4,
+  Tool_trcOpPop_e = 5,
+  Tool_trcOpClear_e = 6,
+  Tool_trcOpRunTst_e = 7,
+  Tool_trcOpProcess_e = 8,
+  Tool_trcOpPushBlock_e = 9,
+  Tool_trcOpPopBlock_e = 10
+} Tool_trcOp_e;
+
+/**
+ * \brief One trace record (6 bytes, no padding).
+ */
+typedef struct {
+  uint8_t op_u8;     /**< Tool_trcOp_e of the call. */
+  uint8_t ret_u8;    /**< Return code of the call (0 for void functions). */
+  uint16_t count_u16; /**< Tool_Count_u32 after the call (lower 16 bits). */
+  uint16_t dt_u16;   /**< Clock ticks since the previous record (saturated). */
+} Tool_trcRec_t;
+
+/**
+ * \brief Time source for the trace, free-running ticks.
+ */
+typedef uint32_t (*Tool_trcClock_pf)(void);
+
+/*==================[external data]==========================================*/
+
+/* Runtime switch read by TOOL_TRC(); written only through Tool_TrcEnable(). */
+extern volatile uint8_t Tool_TrcOn_u8;
+
+/*==================[function prototypes]====================================*/
+
+/**
+ * @brief Enable or disable event tracing at runtime.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Switch the trace on or off without rebuilding. Records already in the ring
+ * are kept. On enabling, the time base is re-read so the first record does not
+ * carry the idle period as its delta.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range    | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|------|----------|------|
+ * | enable_b       | X  |     | bool                        |   in  |   1    |   0    |   1  | -        | [-]  |
+ * | Tool_TrcOn_u8  |    |  X  | volatile uint8_t (global)   |   -   |   1    |   0    |   1  | [0,1]    | [-]  |
+ * | LastTs_u32     |    |  X  | uint32_t (static)           |   -   |   1    |   0    |   1  | -        | [tick] |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (enable_b) then (on)
+ *   :LastTs_u32 = Clock_pf() (0 if no clock);
+ *   :Tool_TrcOn_u8 = 1;
+ * else (off)
+ *   :Tool_TrcOn_u8 = 0;
+ * endif
+ * stop
+ * @enduml
+ *
+ * @param enable_b
+ * true to record API calls, false to stop recording.
+ *
+ * @return void
+ */
+void Tool_TrcEnable(bool enable_b);
+
+/**
+ * @brief Install the tick source used for record deltas.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Let the integrator provide the time base (e.g. a free-running hardware
+ * timer). Without a clock all deltas are recorded as 0.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range       | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|------|-------------|------|
+ * | clock_pf       | X  |     | Tool_trcClock_pf            |   in  |   1    |   0    |   1  | fn / NULL   | [-]  |
+ * | Clock_pf       |    |  X  | Tool_trcClock_pf (static)   |   -   |   1    |   0    |   1  | -           | [-]  |
+ *
+ * @param clock_pf
+ * Tick source, or NULL to disable timestamps.
+ *
+ * @return void
+ */
+void Tool_TrcSetClock(Tool_trcClock_pf clock_pf);
+
+/**
+ * @brief Append one record to the trace ring.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Store a compact record of an API call. Called through `TOOL_TRC()` from the
+ * data-path context only (single writer). The ring overwrites its oldest
+ * record when full; the write index is published with release ordering so a
+ * concurrent `Tool_TrcDump_u32()` never blocks the writer.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature                  | Param | Factor | Offset | Size               | Range | Unit |
+ * |----------------|----|-----|-----------------------------------|-------|--------|--------|--------------------|-------|------|
+ * | op_u8          | X  |     | uint8_t                           |   in  |   1    |   0    |   1                | -     | [-]  |
+ * | ret_u8         | X  |     | uint8_t                           |   in  |   1    |   0    |   1                | -     | [-]  |
+ * | count_u32      | X  |     | uint32_t                          |   in  |   1    |   0    |   1                | -     | [-]  |
+ * | Rec_s          |    |  X  | Tool_trcRec_t[TOOL_TRC_DEPTH_U32] |   -   |   1    |   0    | TOOL_TRC_DEPTH_U32 | -     | [-]  |
+ * | Wr_u32         | X  |  X  | volatile uint32_t (static)        |   -   |   1    |   0    |   1                | -     | [-]  |
+ * | Full_u8        |    |  X  | volatile uint8_t (static)         |   -   |   1    |   0    |   1                | 0..1  | [-]  |
+ * | LastTs_u32     | X  |  X  | uint32_t (static)                 |   -   |   1    |   0    |   1                | -     | [tick] |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * :l_now = Clock_pf() (0 if no clock);
+ * :l_dt = min(l_now - LastTs_u32, 0xFFFF);
+ * :LastTs_u32 = l_now;
+ * :Rec_s[Wr_u32 & (DEPTH-1)] = {op, ret, count, l_dt};
+ * :Full_u8 = 1 once DEPTH records were written;
+ * :release fence;
+ * :Wr_u32++;
+ * stop
+ * @enduml
+ *
+ * @param op_u8
+ * Operation code (`Tool_trcOp_e`).
+ *
+ * @param ret_u8
+ * Return code of the traced call.
+ *
+ * @param count_u32
+ * Ring fill level after the call; the lower 16 bits are stored.
+ *
+ * @return void
+ */
+void Tool_TrcLog(uint8_t op_u8, uint8_t ret_u8, uint32_t count_u32);
+
+/**
+ * @brief Forget all records.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Empty the trace ring, e.g. after a dump has been transferred. Must be called
+ * from the writing context (or while tracing is off).
+ *
+ * @return void
+ */
+void Tool_TrcReset(void);
+
+/**
+ * @brief Serialize the trace ring into a binary dump.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Produce a self-describing little-endian image of the recorded calls, oldest
+ * first, for the host-side decoder (`tools/Tool_TrcDecode.c`). Lock-free with
+ * respect to the writer: records that may have been overwritten while copying
+ * are dropped and accounted as lost. The oldest slot of a full ring is never
+ * trusted, since a write in progress (not yet published in `Wr_u32`) may be
+ * overwriting it, so a full ring dumps at most `TOOL_TRC_DEPTH_U32 - 1` records.
+ *
+ * Dump layout:
+ * - Header (`TOOL_TRC_HDR_SIZE_U32` bytes): magic "TTRC", version (u8),
+ *   record size (u8), reserved (u16), record count (u32), lost records (u32).
+ * - Records (`TOOL_TRC_REC_SIZE_U32` bytes each): op (u8), ret (u8),
+ *   count (u16), dt (u16).
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature                  | Param | Factor | Offset | Size               | Range          | Unit |
+ * |----------------|----|-----|-----------------------------------|-------|--------|--------|--------------------|----------------|------|
+ * | out_pu8        |    |  X  | uint8_t*                          |  out  |   1    |   0    | size_u32           | pointer / NULL | [-]  |
+ * | size_u32       | X  |     | uint32_t                          |   in  |   1    |   0    |   1                | -              | [byte] |
+ * | Rec_s          | X  |     | Tool_trcRec_t[TOOL_TRC_DEPTH_U32] |   -   |   1    |   0    | TOOL_TRC_DEPTH_U32 | -              | [-]  |
+ * | Wr_u32         | X  |     | volatile uint32_t (static)        |   -   |   1    |   0    |   1                | -              | [-]  |
+ * | Full_u8        | X  |     | volatile uint8_t (static)         |   -   |   1    |   0    |   1                | 0..1           | [-]  |
+ * | returned val   |    |  X  | uint32_t                          |  out  |   1    |   0    |   1                | -              | [byte] |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * if (out_pu8 == NULL or size_u32 < header) then (invalid)
+ *   :return 0;
+ * else (valid)
+ *   :l_wr0 = Wr_u32; acquire fence;
+ *   :l_first = Full_u8 ? l_wr0 - DEPTH (mod 2^32) : max(l_wr0 - DEPTH, 0);
+ *   :l_n = min(l_wr0 - l_first, room in out_pu8);
+ *   :copy records [l_first .. l_first + l_n - 1];
+ *   :acquire fence; l_wr1 = Wr_u32;
+ *   :drop records with index <= l_wr1 - DEPTH (slot of the record in progress);
+ *   :write header (count, lost);
+ *   :return header + count * record size;
+ * endif
+ * stop
+ * @enduml
+ *
+ * @param out_pu8
+ * Destination buffer.
+ *
+ * @param size_u32
+ * Size of the destination buffer in bytes.
+ *
+ * @return uint32_t
+ * Number of bytes written (0 if the buffer cannot hold the header).
+ */
+uint32_t Tool_TrcDump_u32(uint8_t *out_pu8, uint32_t size_u32);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOL_TRC_H */
+
+/** @} */
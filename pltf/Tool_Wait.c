@@ -0,0 +1,269 @@
+/**
+ * \file Tool_Wait.c
+ * \brief Tool module blocking push/pop with timeouts (Linux, eventfd).
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * \defgroup Tool_Wait Tool Blocking Wait
+ * @{
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Tool_Wait.h"
+
+#if(TOOL_CFG_WAIT != 0U)
+
+#include "Tool.h"
+#include "Tool_Fast.h"
+#include <poll.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <sys/eventfd.h>
+#include <time.h>
+#include <unistd.h>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_WAIT_BIT_U32(dir) (1UL << (uint32_t)(dir))
+#define TOOL_WAIT_PENDING_U8 (0xFFU) /* Internal: result not decided yet. */
+
+/*==================[local data]=============================================*/
+
+static pthread_mutex_t Mtx_s = PTHREAD_MUTEX_INITIALIZER;
+static int Fd_s32[2] = {-1, -1};
+static uint32_t Armed_u32;   /* Per direction: somebody waits for the fd. */
+static uint32_t Pending_u32; /* Per direction: fd counter not yet read back. */
+
+/*==================[local functions]========================================*/
+
+static uint64_t Tool_WaitNowMs_u64(void) {
+  struct timespec l_ts_s;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &l_ts_s);
+
+  return ((uint64_t)l_ts_s.tv_sec * 1000ULL) + ((uint64_t)l_ts_s.tv_nsec / 1000000ULL);
+}
+
+/* Milliseconds left for poll(): -1 forever, 0 expired. */
+static int Tool_WaitRemain_s32(uint64_t start_u64, uint32_t timeout_ms_u32) {
+  int l_remain_s32 = -1;
+
+  if(timeout_ms_u32 != TOOL_WAIT_FOREVER_U32) {
+    uint64_t l_elapsed_u64 = Tool_WaitNowMs_u64() - start_u64;
+
+    l_remain_s32 = (l_elapsed_u64 >= timeout_ms_u32) ? 0 : (int)(timeout_ms_u32 - (uint32_t)l_elapsed_u64);
+    l_remain_s32 = (l_remain_s32 < 0) ? 0x7FFFFFFF : l_remain_s32;
+  }
+
+  return l_remain_s32;
+}
+
+/* Wake the waiter of dir_e, if any. Called with Mtx_s held. */
+static void Tool_WaitSignal(Tool_waitDir_e dir_e) {
+  uint32_t l_bit_u32 = TOOL_WAIT_BIT_U32(dir_e);
+
+  if((Armed_u32 & l_bit_u32) != 0U) {
+    Armed_u32 &= ~l_bit_u32;
+    if((Pending_u32 & l_bit_u32) == 0U) {
+      uint64_t l_one_u64 = 1U;
+
+      (void)write(Fd_s32[dir_e], &l_one_u64, sizeof(l_one_u64));
+      Pending_u32 |= l_bit_u32;
+    }
+  }
+}
+
+/* Reset the eventfd of dir_e after a wake-up. Called with Mtx_s held. */
+static void Tool_WaitDrain(Tool_waitDir_e dir_e) {
+  uint32_t l_bit_u32 = TOOL_WAIT_BIT_U32(dir_e);
+
+  if((Pending_u32 & l_bit_u32) != 0U) {
+    uint64_t l_val_u64;
+
+    (void)read(Fd_s32[dir_e], &l_val_u64, sizeof(l_val_u64));
+    Pending_u32 &= ~l_bit_u32;
+  }
+}
+
+/* Decide under the lock whether to wait; returns TOOL_WAIT_PENDING_U8 if armed. */
+static uint8_t Tool_WaitPrepare_u8(Tool_waitDir_e dir_e, int remain_s32) {
+  uint8_t l_ret_u8 = TOOL_WAIT_PENDING_U8;
+
+  if(Fd_s32[dir_e] < 0) {
+    l_ret_u8 = 4U;
+  } else if(remain_s32 == 0) {
+    Armed_u32 &= ~TOOL_WAIT_BIT_U32(dir_e);
+    l_ret_u8 = 1U;
+  } else {
+    Armed_u32 |= TOOL_WAIT_BIT_U32(dir_e);
+  }
+
+  return l_ret_u8;
+}
+
+static void Tool_WaitSleep(Tool_waitDir_e dir_e, int remain_s32) {
+  struct pollfd l_pfd_s;
+
+  l_pfd_s.fd = Fd_s32[dir_e];
+  l_pfd_s.events = POLLIN;
+  l_pfd_s.revents = 0;
+
+  (void)poll(&l_pfd_s, 1U, remain_s32);
+}
+
+/*==================[global functions]=======================================*/
+
+uint8_t Tool_WaitInit_u8(void) {
+  uint8_t l_ret_u8 = 0U;
+
+  (void)pthread_mutex_lock(&Mtx_s);
+
+  if(Fd_s32[Tool_waitData_e] < 0) {
+    Fd_s32[Tool_waitData_e] = eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+    Fd_s32[Tool_waitSpace_e] = eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+    Armed_u32 = 0U;
+    Pending_u32 = 0U;
+
+    if((Fd_s32[Tool_waitData_e] < 0) || (Fd_s32[Tool_waitSpace_e] < 0)) {
+      for(uint32_t l_i_u32 = 0U; l_i_u32 < 2U; l_i_u32++) {
+        if(Fd_s32[l_i_u32] >= 0) {
+          (void)close(Fd_s32[l_i_u32]);
+        }
+        Fd_s32[l_i_u32] = -1;
+      }
+      l_ret_u8 = 1U;
+    }
+  }
+
+  (void)pthread_mutex_unlock(&Mtx_s);
+
+  return l_ret_u8;
+}
+
+void Tool_WaitDeInit(void) {
+  (void)pthread_mutex_lock(&Mtx_s);
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < 2U; l_i_u32++) {
+    if(Fd_s32[l_i_u32] >= 0) {
+      (void)close(Fd_s32[l_i_u32]);
+    }
+    Fd_s32[l_i_u32] = -1;
+  }
+  Armed_u32 = 0U;
+  Pending_u32 = 0U;
+
+  (void)pthread_mutex_unlock(&Mtx_s);
+}
+
+uint8_t Tool_PushWait_u8(uint8_t value_u8, uint32_t timeout_ms_u32) {
+  uint8_t l_ret_u8 = TOOL_WAIT_PENDING_U8;
+  uint64_t l_start_u64 = Tool_WaitNowMs_u64();
+
+  while(l_ret_u8 == TOOL_WAIT_PENDING_U8) {
+    int l_remain_s32 = Tool_WaitRemain_s32(l_start_u64, timeout_ms_u32);
+
+    (void)pthread_mutex_lock(&Mtx_s);
+
+    if(Fd_s32[Tool_waitSpace_e] >= 0) {
+      Tool_WaitDrain(Tool_waitSpace_e);
+    }
+
+    /* Everything except "full" is decided by the non-blocking call. */
+    if(((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0U) || (Tool_Count_u32 < TOOL_BUFFER_SIZE_U32)) {
+      l_ret_u8 = Tool_Push_u8(value_u8);
+      if(l_ret_u8 == 0U) {
+        Tool_WaitSignal(Tool_waitData_e);
+      }
+    } else {
+      l_ret_u8 = Tool_WaitPrepare_u8(Tool_waitSpace_e, l_remain_s32);
+    }
+
+    (void)pthread_mutex_unlock(&Mtx_s);
+
+    if(l_ret_u8 == TOOL_WAIT_PENDING_U8) {
+      Tool_WaitSleep(Tool_waitSpace_e, l_remain_s32);
+    }
+  }
+
+  return l_ret_u8;
+}
+
+uint8_t Tool_PopWait_u8(uint8_t *value_pu8, uint32_t timeout_ms_u32) {
+  uint8_t l_ret_u8 = TOOL_WAIT_PENDING_U8;
+  uint64_t l_start_u64 = Tool_WaitNowMs_u64();
+
+  while(l_ret_u8 == TOOL_WAIT_PENDING_U8) {
+    int l_remain_s32 = Tool_WaitRemain_s32(l_start_u64, timeout_ms_u32);
+
+    (void)pthread_mutex_lock(&Mtx_s);
+
+    if(Fd_s32[Tool_waitData_e] >= 0) {
+      Tool_WaitDrain(Tool_waitData_e);
+    }
+
+    /* Everything except "empty" is decided by the non-blocking call. */
+    if((value_pu8 == NULL) || ((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0U) || (Tool_Count_u32 != 0U)) {
+      l_ret_u8 = Tool_Pop_u8(value_pu8);
+      if(l_ret_u8 == 4U) {
+        /* Corrupted block dropped: space was freed, report it apart from 4. */
+        l_ret_u8 = 5U;
+      }
+      if((l_ret_u8 == 0U) || (l_ret_u8 == 5U)) {
+        Tool_WaitSignal(Tool_waitSpace_e);
+      }
+    } else {
+      l_ret_u8 = Tool_WaitPrepare_u8(Tool_waitData_e, l_remain_s32);
+    }
+
+    (void)pthread_mutex_unlock(&Mtx_s);
+
+    if(l_ret_u8 == TOOL_WAIT_PENDING_U8) {
+      Tool_WaitSleep(Tool_waitData_e, l_remain_s32);
+    }
+  }
+
+  return l_ret_u8;
+}
+
+int32_t Tool_WaitGetFd_s32(Tool_waitDir_e dir_e) {
+  int32_t l_fd_s32 = -1;
+
+  if((dir_e == Tool_waitData_e) || (dir_e == Tool_waitSpace_e)) {
+    l_fd_s32 = (int32_t)Fd_s32[dir_e];
+  }
+
+  return l_fd_s32;
+}
+
+uint8_t Tool_WaitArm_u8(Tool_waitDir_e dir_e) {
+  uint8_t l_ret_u8 = 0U;
+
+  if((dir_e != Tool_waitData_e) && (dir_e != Tool_waitSpace_e)) {
+    l_ret_u8 = 4U;
+  } else {
+    (void)pthread_mutex_lock(&Mtx_s);
+
+    if(Fd_s32[dir_e] < 0) {
+      l_ret_u8 = 4U;
+    } else {
+      bool l_ready_b = ((Tool_StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0U) ||
+                       ((dir_e == Tool_waitData_e) ? (Tool_Count_u32 != 0U) : (Tool_Count_u32 < TOOL_BUFFER_SIZE_U32));
+
+      Tool_WaitDrain(dir_e);
+      if(l_ready_b) {
+        l_ret_u8 = 1U;
+      } else {
+        Armed_u32 |= TOOL_WAIT_BIT_U32(dir_e);
+      }
+    }
+
+    (void)pthread_mutex_unlock(&Mtx_s);
+  }
+
+  return l_ret_u8;
+}
+
+#endif /* TOOL_CFG_WAIT */
+
+/** @} */
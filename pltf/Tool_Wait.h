@@ -0,0 +1,216 @@
+/**
+ * \file Tool_Wait.h
+ * \brief Tool module blocking push/pop with timeouts (Linux, eventfd).
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * Blocking variants of `Tool_Push_u8()` / `Tool_Pop_u8()` for a producer and
+ * a consumer running in different threads. Calls made through this header are
+ * serialized by a mutex (futex based, no syscall when uncontended), which
+ * keeps the module's single-writer contract. A caller that finds the ring
+ * empty (full) sleeps on an eventfd; the other side writes that eventfd only
+ * when somebody is actually waiting, i.e. on the empty-to-non-empty
+ * (full-to-not-full) transition the waiter is blocked on. A steady stream
+ * that never waits costs no syscall per byte.
+ *
+ * For event loops, `Tool_WaitGetFd_s32()` exposes both eventfds and
+ * `Tool_WaitArm_u8()` requests a notification, so the ring can be watched
+ * with epoll/poll/select next to sockets.
+ *
+ * Only calls made through this header notify waiters; producers and
+ * consumers sharing the module with a blocking peer must use them too.
+ *
+ * \defgroup Tool_Wait Tool Blocking Wait
+ * @{
+ */
+
+#ifndef TOOL_WAIT_H
+#define TOOL_WAIT_H
+
+#include "Tool_Cfg.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================[macros]=================================================*/
+
+#define TOOL_WAIT_FOREVER_U32 (0xFFFFFFFFUL) /* Timeout: never give up. */
+
+/*==================[types]==================================================*/
+
+/**
+ * \brief Condition a caller waits for.
+ */
+typedef enum {
+  Tool_waitData_e = 0,  /**< Ring non-empty (consumer side). */
+  Tool_waitSpace_e = 1  /**< Ring not full (producer side). */
+} Tool_waitDir_e;
+
+/*==================[function prototypes]====================================*/
+
+/**
+ * @brief Create the wait objects.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Create the two eventfds (non-blocking, close-on-exec) used to put waiting
+ * callers to sleep. Independent of `Tool_Init()`; may be called before or
+ * after it.
+ *
+ * @return uint8_t
+ * - 0: Success.
+ * - 1: eventfd creation failed (blocking calls return 4).
+ */
+uint8_t Tool_WaitInit_u8(void);
+
+/**
+ * @brief Release the wait objects.
+ *
+ * @details
+ * Must only be called when no thread is inside a blocking call or watching
+ * the file descriptors.
+ *
+ * @return void
+ */
+void Tool_WaitDeInit(void);
+
+/**
+ * @brief Push one byte, sleeping while the ring is full.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Same result as `Tool_Push_u8()`, except that a full ring is waited out for
+ * up to `timeout_ms_u32` milliseconds instead of raising the overflow flag.
+ * A successful push that turns the ring non-empty wakes a waiting consumer.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range          | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|------|----------------|------|
+ * | value_u8       | X  |     | uint8_t                     |   in  |   1    |   0    |   1  | -              | [-]  |
+ * | timeout_ms_u32 | X  |     | uint32_t                    |   in  |   1    |   0    |   1  | 0..FOREVER     | [ms] |
+ * | Tool_Count_u32 | X  |  X  | uint32_t                    |   -   |   1    |   0    |   1  | -              | [-]  |
+ * | returned val   |    |  X  | uint8_t                     |  out  |   1    |   0    |   1  | {0,1,2,4}      | [-]  |
+ *
+ * @par Activity diagram (PlantUML)
+ *
+ * @startuml
+ * start
+ * repeat
+ *   :lock;
+ *   if (not initialized) then (yes)
+ *     :unlock; return 2;
+ *     stop
+ *   endif
+ *   if (Tool_Count_u32 < TOOL_BUFFER_SIZE_U32) then (space)
+ *     :Tool_Push_u8(value_u8);
+ *     if (consumer waiting) then (yes)
+ *       :signal data eventfd;
+ *     endif
+ *     :unlock; return 0;
+ *     stop
+ *   endif
+ *   if (timeout elapsed) then (yes)
+ *     :unlock; return 1;
+ *     stop
+ *   endif
+ *   :mark producer waiting; unlock;
+ *   :poll(space eventfd, remaining time);
+ * repeat while (retry)
+ * @enduml
+ *
+ * @param value_u8
+ * Byte value to push.
+ *
+ * @param timeout_ms_u32
+ * Maximum wait in milliseconds; 0 tries once, `TOOL_WAIT_FOREVER_U32` never
+ * times out.
+ *
+ * @return uint8_t
+ * - 0: Byte pushed.
+ * - 1: Timeout, ring still full (overflow flag not set).
+ * - 2: Module not initialized.
+ * - 4: Wait objects not available (`Tool_WaitInit_u8()` missing or failed).
+ */
+uint8_t Tool_PushWait_u8(uint8_t value_u8, uint32_t timeout_ms_u32);
+
+/**
+ * @brief Pop one byte, sleeping while the ring is empty.
+ *
+ * @details
+ * **Goal of the function**
+ *
+ * Same result as `Tool_Pop_u8()`, except that an empty ring is waited out for
+ * up to `timeout_ms_u32` milliseconds. A pop that turns a full ring not-full
+ * wakes a waiting producer.
+ *
+ * @par Interface summary
+ *
+ * | Interface      | In | Out | Type / Signature            | Param | Factor | Offset | Size | Range          | Unit |
+ * |----------------|----|-----|-----------------------------|-------|--------|--------|------|----------------|------|
+ * | value_pu8      |    |  X  | uint8_t*                    |  out  |   1    |   0    |   1  | pointer / NULL | [-]  |
+ * | timeout_ms_u32 | X  |     | uint32_t                    |   in  |   1    |   0    |   1  | 0..FOREVER     | [ms] |
+ * | Tool_Count_u32 | X  |  X  | uint32_t                    |   -   |   1    |   0    |   1  | -              | [-]  |
+ * | returned val   |    |  X  | uint8_t                     |  out  |   1    |   0    |   1  | {0,1,2,3,4,5}  | [-]  |
+ *
+ * @param value_pu8
+ * Output pointer receiving the popped byte.
+ *
+ * @param timeout_ms_u32
+ * Maximum wait in milliseconds; 0 tries once, `TOOL_WAIT_FOREVER_U32` never
+ * times out.
+ *
+ * @return uint8_t
+ * - 0: Byte popped.
+ * - 1: Timeout, ring still empty.
+ * - 2: Module not initialized.
+ * - 3: `value_pu8` is NULL.
+ * - 4: Wait objects not available.
+ * - 5: Corrupted block dropped (`Tool_Pop_u8()` returned 4).
+ */
+uint8_t Tool_PopWait_u8(uint8_t *value_pu8, uint32_t timeout_ms_u32);
+
+/**
+ * @brief File descriptor that becomes readable when `dir_e` may be satisfied.
+ *
+ * @details
+ * Register it with epoll (EPOLLIN) after `Tool_WaitArm_u8()`. When it fires,
+ * call the matching blocking function with timeout 0 until it returns 1; that
+ * also resets the descriptor.
+ *
+ * @param dir_e
+ * Condition of interest.
+ *
+ * @return int32_t
+ * eventfd, or -1 if the wait objects are not available.
+ */
+int32_t Tool_WaitGetFd_s32(Tool_waitDir_e dir_e);
+
+/**
+ * @brief Ask for a notification on `Tool_WaitGetFd_s32(dir_e)`.
+ *
+ * @details
+ * One-shot, like the internal wait: the descriptor is signalled on the next
+ * transition that satisfies `dir_e`.
+ *
+ * @param dir_e
+ * Condition of interest.
+ *
+ * @return uint8_t
+ * - 0: Armed; wait for the descriptor.
+ * - 1: Condition already true; not armed, proceed without waiting.
+ * - 4: Wait objects not available.
+ */
+uint8_t Tool_WaitArm_u8(Tool_waitDir_e dir_e);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOL_WAIT_H */
+
+/** @} */
@@ -0,0 +1,131 @@
+/**
+ * \file Tool_TrcDecode.c
+ * \brief Host-side decoder for Tool trace dumps (see Tool_TrcDump_u32()).
+ * \author ChatGPT
+ * \date 2026-10-19
+ *
+ * Usage: tool_trc_decode [-f csv|chrome] [-t ticks_per_us] dump.bin
+ *
+ * - csv:    one line per record with absolute tick time.
+ * - chrome: Chrome trace event JSON (chrome://tracing, Perfetto), one instant
+ *           event per call plus a "Count" counter track.
+ */
+
+#include "Tool_Trc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*==================[local macros]===========================================*/
+
+#define TOOL_TRC_DEC_MAX_U32 (1UL << 24U)
+
+/*==================[local data]=============================================*/
+
+static const char *const OpName_pc[] = {"None", "Init", "DeInit", "SetMode", "Push", "Pop", "Clear", "RunTst", "Process", "PushBlock", "PopBlock"};
+
+/*==================[local functions]========================================*/
+
+static uint32_t Tool_TrcDecGet16_u32(const uint8_t *in_pcu8) { return (uint32_t)in_pcu8[0] | ((uint32_t)in_pcu8[1] << 8U); }
+
+static uint32_t Tool_TrcDecGet32_u32(const uint8_t *in_pcu8) { return Tool_TrcDecGet16_u32(&in_pcu8[0]) | (Tool_TrcDecGet16_u32(&in_pcu8[2]) << 16U); }
+
+static const char *Tool_TrcDecOpName_pc(uint8_t op_u8) {
+  return (op_u8 < (uint8_t)(sizeof(OpName_pc) / sizeof(OpName_pc[0]))) ? OpName_pc[op_u8] : "Unknown";
+}
+
+static int Tool_TrcDecUsage(const char *prog_pc) {
+  (void)fprintf(stderr, "usage: %s [-f csv|chrome] [-t ticks_per_us] dump.bin\n", prog_pc);
+  return 2;
+}
+
+/*==================[global functions]=======================================*/
+
+int main(int argc, char **argv) {
+  const char *l_fmt_pc = "csv";
+  const char *l_path_pc = NULL;
+  double l_tpu_d = 1.0;
+  FILE *l_in_ps;
+  uint8_t *l_buf_pu8;
+  size_t l_len_sz;
+  uint32_t l_n_u32;
+  uint32_t l_lost_u32;
+  uint32_t l_recSz_u32;
+  uint64_t l_t_u64 = 0U;
+  int l_i_s32;
+
+  for(l_i_s32 = 1; l_i_s32 < argc; l_i_s32++) {
+    if((strcmp(argv[l_i_s32], "-f") == 0) && ((l_i_s32 + 1) < argc)) {
+      l_fmt_pc = argv[++l_i_s32];
+    } else if((strcmp(argv[l_i_s32], "-t") == 0) && ((l_i_s32 + 1) < argc)) {
+      l_tpu_d = strtod(argv[++l_i_s32], NULL);
+    } else if(l_path_pc == NULL) {
+      l_path_pc = argv[l_i_s32];
+    } else {
+      return Tool_TrcDecUsage(argv[0]);
+    }
+  }
+  if((l_path_pc == NULL) || (l_tpu_d <= 0.0) || ((strcmp(l_fmt_pc, "csv") != 0) && (strcmp(l_fmt_pc, "chrome") != 0))) {
+    return Tool_TrcDecUsage(argv[0]);
+  }
+
+  l_in_ps = fopen(l_path_pc, "rb");
+  if(l_in_ps == NULL) {
+    perror(l_path_pc);
+    return 1;
+  }
+  l_buf_pu8 = (uint8_t *)malloc(TOOL_TRC_DEC_MAX_U32);
+  if(l_buf_pu8 == NULL) {
+    (void)fclose(l_in_ps);
+    return 1;
+  }
+  l_len_sz = fread(l_buf_pu8, 1U, TOOL_TRC_DEC_MAX_U32, l_in_ps);
+  (void)fclose(l_in_ps);
+
+  if((l_len_sz < TOOL_TRC_HDR_SIZE_U32) || (memcmp(l_buf_pu8, "TTRC", 4U) != 0) || (l_buf_pu8[4] != TOOL_TRC_VERSION_U8)) {
+    (void)fprintf(stderr, "%s: not a Tool trace dump (version %u expected)\n", l_path_pc, (unsigned)TOOL_TRC_VERSION_U8);
+    free(l_buf_pu8);
+    return 1;
+  }
+  l_recSz_u32 = l_buf_pu8[5];
+  l_n_u32 = Tool_TrcDecGet32_u32(&l_buf_pu8[8]);
+  l_lost_u32 = Tool_TrcDecGet32_u32(&l_buf_pu8[12]);
+  if((l_recSz_u32 < TOOL_TRC_REC_SIZE_U32) || (((size_t)l_n_u32 * l_recSz_u32) > (l_len_sz - TOOL_TRC_HDR_SIZE_U32))) {
+    (void)fprintf(stderr, "%s: truncated dump\n", l_path_pc);
+    free(l_buf_pu8);
+    return 1;
+  }
+
+  if(strcmp(l_fmt_pc, "csv") == 0) {
+    (void)printf("index,tick,dt,op,ret,count\n");
+  } else {
+    (void)printf("{\"displayTimeUnit\":\"ns\",\"otherData\":{\"lost\":%lu},\"traceEvents\":[\n", (unsigned long)l_lost_u32);
+  }
+
+  for(uint32_t l_r_u32 = 0U; l_r_u32 < l_n_u32; l_r_u32++) {
+    const uint8_t *l_rec_pcu8 = &l_buf_pu8[TOOL_TRC_HDR_SIZE_U32 + (l_r_u32 * l_recSz_u32)];
+    uint8_t l_op_u8 = l_rec_pcu8[0];
+    uint8_t l_ret_u8 = l_rec_pcu8[1];
+    uint32_t l_count_u32 = Tool_TrcDecGet16_u32(&l_rec_pcu8[2]);
+    uint32_t l_dt_u32 = Tool_TrcDecGet16_u32(&l_rec_pcu8[4]);
+
+    l_t_u64 += l_dt_u32;
+    if(strcmp(l_fmt_pc, "csv") == 0) {
+      (void)printf("%lu,%llu,%lu,%s,%u,%lu\n", (unsigned long)(l_lost_u32 + l_r_u32), (unsigned long long)l_t_u64, (unsigned long)l_dt_u32, Tool_TrcDecOpName_pc(l_op_u8), (unsigned)l_ret_u8,
+                   (unsigned long)l_count_u32);
+    } else {
+      double l_us_d = (double)l_t_u64 / l_tpu_d;
+
+      (void)printf("{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":1,\"args\":{\"ret\":%u,\"count\":%lu}},\n", Tool_TrcDecOpName_pc(l_op_u8), l_us_d,
+                   (unsigned)l_ret_u8, (unsigned long)l_count_u32);
+      (void)printf("{\"name\":\"Count\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"args\":{\"Count\":%lu}}%s\n", l_us_d, (unsigned long)l_count_u32, ((l_r_u32 + 1U) < l_n_u32) ? "," : "");
+    }
+  }
+
+  if(strcmp(l_fmt_pc, "chrome") == 0) {
+    (void)printf("]}\n");
+  }
+
+  free(l_buf_pu8);
+  return 0;
+}
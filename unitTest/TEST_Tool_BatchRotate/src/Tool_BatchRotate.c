@@ -0,0 +1,28 @@
+
+#include "Tool_BatchRotate.h"
+
+/* FUNCTION TO TEST */
+
+
+void Tool_BatchRotate(uint8_t *row_pu8, uint32_t tail_u32, uint32_t count_u32, uint8_t x_u8) {
+  uint32_t l_rot_u32 = TOOL_BUFFER_SIZE_U32 % count_u32;
+  uint8_t l_even_u8 = (((TOOL_BUFFER_SIZE_U32 / count_u32) & 1U) != 0U) ? x_u8 : 0U; /* Visited N/c times. */
+  uint8_t l_odd_u8 = (uint8_t)(l_even_u8 ^ x_u8);                                     /* Visited N/c + 1 times. */
+  uint8_t l_lin_u8[TOOL_BUFFER_SIZE_U32];
+  uint32_t l_pos_u32 = tail_u32;
+
+  for(uint32_t l_m_u32 = 0U; l_m_u32 < count_u32; l_m_u32++) {
+    l_lin_u8[l_m_u32] = row_pu8[l_pos_u32];
+    l_pos_u32 = ((l_pos_u32 + 1U) == TOOL_BUFFER_SIZE_U32) ? 0U : (l_pos_u32 + 1U);
+  }
+
+  /* New element m is old element j = (m + rot) mod c; j < rot got one more visit. */
+  l_pos_u32 = tail_u32;
+  for(uint32_t l_m_u32 = 0U; l_m_u32 < count_u32; l_m_u32++) {
+    uint32_t l_j_u32 = l_m_u32 + l_rot_u32;
+
+    l_j_u32 = (l_j_u32 >= count_u32) ? (l_j_u32 - count_u32) : l_j_u32;
+    row_pu8[l_pos_u32] = (uint8_t)(l_lin_u8[l_j_u32] ^ ((l_j_u32 < l_rot_u32) ? l_odd_u8 : l_even_u8));
+    l_pos_u32 = ((l_pos_u32 + 1U) == TOOL_BUFFER_SIZE_U32) ? 0U : (l_pos_u32 + 1U);
+  }
+}
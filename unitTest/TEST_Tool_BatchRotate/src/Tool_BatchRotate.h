@@ -0,0 +1,3 @@
+#include "Tool.h"
+
+void Tool_BatchRotate(uint8_t *row_pu8, uint32_t tail_u32, uint32_t count_u32, uint8_t x_u8);
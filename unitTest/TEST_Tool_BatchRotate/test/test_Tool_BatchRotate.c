@@ -0,0 +1,125 @@
+#include "Tool.h"
+#include "Tool_BatchRotate.h"
+#include "mock_Tool.h"
+#include "unity.h"
+#include <stdint.h>
+#include <string.h>
+
+/*==================[test helper functions]==================================*/
+
+/* Reference: the singleton ring of Tool_Process(), replayed on a local row. */
+static uint8_t Ref_au8[TOOL_BUFFER_SIZE_U32];
+static uint32_t RefHead_u32;
+static uint32_t RefTail_u32;
+static uint32_t RefCount_u32;
+
+/* Row under test, same initial content as the reference. */
+static uint8_t Row_au8[TOOL_BUFFER_SIZE_U32];
+
+static void RefPop(uint8_t *value_pu8) {
+  *value_pu8 = Ref_au8[RefTail_u32];
+  Ref_au8[RefTail_u32] = 0U;
+  RefTail_u32 = (RefTail_u32 + 1U) % TOOL_BUFFER_SIZE_U32;
+  RefCount_u32--;
+}
+
+static void RefPush(uint8_t value_u8) {
+  Ref_au8[RefHead_u32] = value_u8;
+  RefHead_u32 = (RefHead_u32 + 1U) % TOOL_BUFFER_SIZE_U32;
+  RefCount_u32++;
+}
+
+/* One Tool_Process() step in RUN mode with XOR byte x_u8. */
+static void RefProcess(uint8_t x_u8) {
+  for(uint32_t i = 0U; i < TOOL_BUFFER_SIZE_U32; i++) {
+    if(RefCount_u32 != 0U) {
+      uint8_t l_val_u8;
+
+      RefPop(&l_val_u8);
+      RefPush((uint8_t)(l_val_u8 ^ x_u8));
+    }
+  }
+}
+
+/* Queue count_u32 distinct bytes from ring index tail_u32 in both rows; free slots stay 0 (batch invariant). */
+static void Fill(uint32_t tail_u32, uint32_t count_u32) {
+  (void)memset(Ref_au8, 0, sizeof(Ref_au8));
+  for(uint32_t i = 0U; i < count_u32; i++) {
+    Ref_au8[(tail_u32 + i) % TOOL_BUFFER_SIZE_U32] = (uint8_t)((i * 37U) + 11U);
+  }
+  RefTail_u32 = tail_u32;
+  RefCount_u32 = count_u32;
+  RefHead_u32 = (tail_u32 + count_u32) % TOOL_BUFFER_SIZE_U32;
+  (void)memcpy(Row_au8, Ref_au8, sizeof(Row_au8));
+}
+
+void setUp(void) {
+  Fill(0U, 0U);
+}
+
+void tearDown(void) { /* nothing */ }
+
+/*==================[test cases]=============================================*/
+
+void test_Tool_BatchRotate_MatchesProcessReplayAtEveryFillLevel(void) {
+  for(uint32_t l_c_u32 = 1U; l_c_u32 <= TOOL_BUFFER_SIZE_U32; l_c_u32++) {
+    for(uint32_t l_t_u32 = 0U; l_t_u32 < TOOL_BUFFER_SIZE_U32; l_t_u32++) {
+      /* Arrange */
+      Fill(l_t_u32, l_c_u32);
+
+      /* Act */
+      RefProcess(0x5AU);
+      Tool_BatchRotate(Row_au8, l_t_u32, l_c_u32, 0x5AU);
+
+      /* Assert: same bytes in the same slots, bookkeeping back where it was */
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(Ref_au8, Row_au8, TOOL_BUFFER_SIZE_U32);
+      TEST_ASSERT_EQUAL_UINT32(l_t_u32, RefTail_u32);
+      TEST_ASSERT_EQUAL_UINT32(l_c_u32, RefCount_u32);
+    }
+  }
+}
+
+void test_Tool_BatchRotate_MatchesProcessReplayOverSeveralCycles(void) {
+  for(uint32_t l_c_u32 = 1U; l_c_u32 <= TOOL_BUFFER_SIZE_U32; l_c_u32++) {
+    /* Arrange: queue wraps around the end of the row */
+    Fill(TOOL_BUFFER_SIZE_U32 - 3U, l_c_u32);
+
+    /* Act: cycle counters 1..5, as Tool_Process() would use them */
+    for(uint8_t l_x_u8 = 1U; l_x_u8 <= 5U; l_x_u8++) {
+      RefProcess(l_x_u8);
+      Tool_BatchRotate(Row_au8, TOOL_BUFFER_SIZE_U32 - 3U, l_c_u32, l_x_u8);
+    }
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(Ref_au8, Row_au8, TOOL_BUFFER_SIZE_U32);
+  }
+}
+
+void test_Tool_BatchRotate_ZeroXorIsPureRotation(void) {
+  /* Arrange: 5 bytes, 64 mod 5 = 4 */
+  Fill(10U, 5U);
+
+  /* Act */
+  Tool_BatchRotate(Row_au8, 10U, 5U, 0U);
+
+  /* Assert: new element m is old element (m + 4) mod 5 */
+  for(uint32_t i = 0U; i < 5U; i++) {
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)((((i + 4U) % 5U) * 37U) + 11U), Row_au8[10U + i]);
+  }
+}
+
+void test_Tool_BatchRotate_LeavesFreeSlotsUntouched(void) {
+  /* Arrange: 7 queued bytes from index 60 (wrapping), free slots marked */
+  Fill(60U, 7U);
+  for(uint32_t i = 3U; i < 60U; i++) {
+    Row_au8[i] = 0xEEU;
+  }
+
+  /* Act */
+  Tool_BatchRotate(Row_au8, 60U, 7U, 0x33U);
+
+  /* Assert */
+  for(uint32_t i = 3U; i < 60U; i++) {
+    TEST_ASSERT_EQUAL_UINT8(0xEEU, Row_au8[i]);
+  }
+}
@@ -27,6 +27,21 @@
 #define TOOL_CRC_INIT_U32 (0xFFFFFFFFUL)
 #define TOOL_CRC_POLY_U32 (0xEDB88320UL)
 
+#define TOOL_FENCE_ACQ() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define TOOL_FENCE_REL() __atomic_thread_fence(__ATOMIC_RELEASE)
+
+#define TOOL_SEQ_WRITE_BEGIN()  \
+  do {                          \
+    Seq_u32 = Seq_u32 + 1U;     \
+    TOOL_FENCE_REL();           \
+  } while(0)
+
+#define TOOL_SEQ_WRITE_END()    \
+  do {                          \
+    TOOL_FENCE_REL();           \
+    Seq_u32 = Seq_u32 + 1U;     \
+  } while(0)
+
 /*==================[local data]=============================================*/
 
 /* File-static variables: no prefix and PascalCasing (per naming convention). */
@@ -37,6 +52,10 @@ extern uint32_t Count_u32;
 
 extern uint32_t StatusFlg_u32;
 
+extern volatile uint32_t Seq_u32;
+
+extern uint32_t ProcCrc_u32;
+
 /*==================[types]==================================================*/
 
 /**
@@ -9,12 +9,18 @@ uint32_t Count_u32 = 0;
 
 uint32_t StatusFlg_u32 = 0;
 Tool_mode_e Mode_e = Tool_modeIdle_e;
+
+volatile uint32_t Seq_u32 = 0;
+
+uint32_t ProcCrc_u32 = TOOL_CRC_INIT_U32;
 /* FUNCTION TO TEST */
 
 
 void Tool_Clear(void) {
   uint32_t l_index_u32;
 
+  TOOL_SEQ_WRITE_BEGIN();
+
   Head_u32 = 0U;
   Tail_u32 = 0U;
   Count_u32 = 0U;
@@ -25,4 +31,8 @@ void Tool_Clear(void) {
 
   StatusFlg_u32 &= ~TOOL_STATUS_ERR_U32;
   StatusFlg_u32 &= ~TOOL_STATUS_OVF_U32;
+
+  TOOL_SEQ_WRITE_END();
+
+  ProcCrc_u32 = TOOL_CRC_INIT_U32;
 }
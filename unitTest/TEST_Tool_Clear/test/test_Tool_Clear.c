@@ -17,6 +17,9 @@ void setUp(void) {
 
   StatusFlg_u32 = 0U;
   Mode_e = Tool_modeIdle_e;
+
+  Seq_u32 = 0U;
+  ProcCrc_u32 = TOOL_CRC_INIT_U32;
 }
 
 void tearDown(void) { /* nothing */ }
@@ -108,3 +111,25 @@ void test_Tool_Clear_ClearsOnlyErrorAndOverflowFlags(void) {
   TEST_ASSERT_FALSE((StatusFlg_u32 & TOOL_STATUS_OVF_U32) != 0U);
   TEST_ASSERT_TRUE((StatusFlg_u32 & TOOL_STATUS_UDF_U32) != 0U);
 }
+
+void test_Tool_Clear_AdvancesSequenceCounterByOneWrite(void) {
+  /* Arrange */
+  Seq_u32 = 4U;
+
+  /* Act */
+  Tool_Clear();
+
+  /* Assert: one begin/end pair, counter even again */
+  TEST_ASSERT_EQUAL_UINT32(6U, Seq_u32);
+}
+
+void test_Tool_Clear_RestartsProcessCrc(void) {
+  /* Arrange: bytes already folded into the emitted-stream CRC */
+  ProcCrc_u32 = 0x12345678UL;
+
+  /* Act */
+  Tool_Clear();
+
+  /* Assert: the stream starts over, Tool_GetProcessCrc_u32() reads 0 */
+  TEST_ASSERT_EQUAL_HEX32(TOOL_CRC_INIT_U32, ProcCrc_u32);
+}
@@ -0,0 +1,159 @@
+#include "Tool_ComputeCrcN.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Bitwise engine of Tool_CrcUpdInl_u32() (Tool_Inline.h). */
+static uint32_t Tool_CrcUpdInl_u32(uint32_t crc_u32, const uint8_t *data_pcu8, uint32_t length_u32) {
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < length_u32; l_i_u32++) {
+    crc_u32 ^= (uint32_t)data_pcu8[l_i_u32];
+    for(uint32_t l_b_u32 = 0U; l_b_u32 < 8U; l_b_u32++) {
+      crc_u32 = (crc_u32 >> 1U) ^ ((uint32_t)TOOL_CRC_POLY_U32 & (0U - (crc_u32 & 1U)));
+    }
+  }
+
+  return crc_u32;
+}
+
+/* Reference: Tool_ComputeCrcInl_u32() (Tool_Inline.h). */
+uint32_t Tool_ComputeCrc_u32(const uint8_t *data_pcu8, uint32_t length_u32) {
+  uint32_t l_crc_u32 = (uint32_t)TOOL_CRC_INIT_U32;
+
+  if((data_pcu8 != NULL) && (length_u32 != 0U)) {
+    uint32_t l_len_u32 = (length_u32 > TOOL_MAX_CRC_LEN_U32) ? TOOL_MAX_CRC_LEN_U32 : length_u32;
+
+    l_crc_u32 = Tool_CrcUpdInl_u32(l_crc_u32, data_pcu8, l_len_u32);
+  }
+  l_crc_u32 ^= (uint32_t)0xFFFFFFFFUL;
+
+  return l_crc_u32;
+}
+
+/*==================[local types]============================================*/
+
+/* One lane: the buffer in flight and its running register. */
+typedef struct {
+  const uint8_t *p_pcu8; /* Next byte. */
+  uint32_t left_u32;     /* Bytes still to process. */
+  uint32_t crc_u32;      /* Raw CRC register. */
+  uint32_t buf_u32;      /* Index of the buffer in the batch. */
+  bool busy_b;           /* Holds a buffer. */
+} Tool_crcNLane_t;
+
+/*==================[local functions]========================================*/
+
+/* Next 4 bytes of a lane as one word. The CRC is reflected, so the bytes
+ * enter least significant first and can be XORed into the register at once. */
+static inline uint32_t Tool_CrcNWord_u32(const uint8_t *data_pcu8) {
+  return (uint32_t)data_pcu8[0] | ((uint32_t)data_pcu8[1] << 8U) | ((uint32_t)data_pcu8[2] << 16U) | ((uint32_t)data_pcu8[3] << 24U);
+}
+
+/* Bit-serial engine: one register per vector lane, so each shift/mask/XOR
+ * step advances all lanes (SSE2 / NEON through the GCC vector extension). */
+typedef uint32_t Tool_crcNVec_t __attribute__((vector_size(TOOL_CRCN_LANES_U32 * 4U)));
+
+static inline void Tool_CrcNStep4(uint32_t crc_au32[TOOL_CRCN_LANES_U32], const uint8_t *const p_apcu8[TOOL_CRCN_LANES_U32], uint32_t at_u32) {
+  Tool_crcNVec_t l_crc_v;
+  Tool_crcNVec_t l_w_v;
+
+  for(uint32_t l_l_u32 = 0U; l_l_u32 < TOOL_CRCN_LANES_U32; l_l_u32++) {
+    l_crc_v[l_l_u32] = crc_au32[l_l_u32];
+    l_w_v[l_l_u32] = Tool_CrcNWord_u32(&p_apcu8[l_l_u32][at_u32]);
+  }
+  l_crc_v ^= l_w_v;
+  for(uint32_t l_k_u32 = 0U; l_k_u32 < 32U; l_k_u32++) {
+    l_crc_v = (l_crc_v >> 1U) ^ ((uint32_t)TOOL_CRC_POLY_U32 & (0U - (l_crc_v & 1U)));
+  }
+  for(uint32_t l_l_u32 = 0U; l_l_u32 < TOOL_CRCN_LANES_U32; l_l_u32++) {
+    crc_au32[l_l_u32] = l_crc_v[l_l_u32];
+  }
+}
+
+/* Load the next non-empty buffer into a lane; empty and NULL buffers met on
+ * the way get the CRC of nothing (0). */
+static void Tool_CrcNLoad(Tool_crcNLane_t *lane_ps, const uint8_t *const data_apcu8[], const uint32_t length_au32[], uint32_t crc_au32[], uint32_t n_u32,
+                          uint32_t *next_pu32) {
+  lane_ps->busy_b = false;
+  while((*next_pu32 < n_u32) && !lane_ps->busy_b) {
+    uint32_t l_i_u32 = *next_pu32;
+
+    (*next_pu32)++;
+    if((data_apcu8[l_i_u32] == NULL) || (length_au32[l_i_u32] == 0U)) {
+      crc_au32[l_i_u32] = (uint32_t)TOOL_CRC_INIT_U32 ^ (uint32_t)0xFFFFFFFFUL;
+    } else {
+      lane_ps->p_pcu8 = data_apcu8[l_i_u32];
+      lane_ps->left_u32 = (length_au32[l_i_u32] > TOOL_MAX_CRC_LEN_U32) ? TOOL_MAX_CRC_LEN_U32 : length_au32[l_i_u32];
+      lane_ps->crc_u32 = (uint32_t)TOOL_CRC_INIT_U32;
+      lane_ps->buf_u32 = l_i_u32;
+      lane_ps->busy_b = true;
+    }
+  }
+}
+
+/* FUNCTION TO TEST */
+
+uint8_t Tool_ComputeCrcN_u8(const uint8_t *const data_apcu8[], const uint32_t length_au32[], uint32_t crc_au32[], uint32_t n_u32) {
+  Tool_crcNLane_t l_lane_as[TOOL_CRCN_LANES_U32];
+  uint32_t l_next_u32 = 0U;
+  uint8_t l_ret_u8 = 0U;
+
+  if(((data_apcu8 == NULL) || (length_au32 == NULL) || (crc_au32 == NULL)) && (n_u32 != 0U)) {
+    l_ret_u8 = 3U;
+  } else {
+    bool l_busy_b = false;
+
+    for(uint32_t l_l_u32 = 0U; l_l_u32 < TOOL_CRCN_LANES_U32; l_l_u32++) {
+      Tool_CrcNLoad(&l_lane_as[l_l_u32], data_apcu8, length_au32, crc_au32, n_u32, &l_next_u32);
+      l_busy_b = l_busy_b || l_lane_as[l_l_u32].busy_b;
+    }
+
+    while(l_busy_b) {
+      const uint8_t *l_p_apcu8[TOOL_CRCN_LANES_U32];
+      uint32_t l_crc_au32[TOOL_CRCN_LANES_U32];
+      const uint8_t *l_any_pcu8 = NULL;
+      uint32_t l_m_u32 = UINT32_MAX;
+
+      /* Run length: until the first active lane finishes. */
+      for(uint32_t l_l_u32 = 0U; l_l_u32 < TOOL_CRCN_LANES_U32; l_l_u32++) {
+        if(l_lane_as[l_l_u32].busy_b) {
+          l_m_u32 = (l_lane_as[l_l_u32].left_u32 < l_m_u32) ? l_lane_as[l_l_u32].left_u32 : l_m_u32;
+          l_any_pcu8 = l_lane_as[l_l_u32].p_pcu8;
+        }
+      }
+      /* Idle lanes shadow an active one: no branch in the inner loop, and
+       * their registers are thrown away. */
+      for(uint32_t l_l_u32 = 0U; l_l_u32 < TOOL_CRCN_LANES_U32; l_l_u32++) {
+        l_p_apcu8[l_l_u32] = l_lane_as[l_l_u32].busy_b ? l_lane_as[l_l_u32].p_pcu8 : l_any_pcu8;
+        l_crc_au32[l_l_u32] = l_lane_as[l_l_u32].crc_u32;
+      }
+
+      uint32_t l_j_u32 = 0U;
+
+      for(; (l_m_u32 - l_j_u32) >= 4U; l_j_u32 += 4U) {
+        Tool_CrcNStep4(l_crc_au32, l_p_apcu8, l_j_u32);
+      }
+      for(; l_j_u32 < l_m_u32; l_j_u32++) {
+        for(uint32_t l_l_u32 = 0U; l_l_u32 < TOOL_CRCN_LANES_U32; l_l_u32++) {
+          l_crc_au32[l_l_u32] = Tool_CrcUpdInl_u32(l_crc_au32[l_l_u32], &l_p_apcu8[l_l_u32][l_j_u32], 1U);
+        }
+      }
+
+      l_busy_b = false;
+      for(uint32_t l_l_u32 = 0U; l_l_u32 < TOOL_CRCN_LANES_U32; l_l_u32++) {
+        Tool_crcNLane_t *l_ln_ps = &l_lane_as[l_l_u32];
+
+        if(l_ln_ps->busy_b) {
+          l_ln_ps->p_pcu8 = &l_ln_ps->p_pcu8[l_m_u32];
+          l_ln_ps->left_u32 -= l_m_u32;
+          l_ln_ps->crc_u32 = l_crc_au32[l_l_u32];
+          if(l_ln_ps->left_u32 == 0U) {
+            crc_au32[l_ln_ps->buf_u32] = l_ln_ps->crc_u32 ^ (uint32_t)0xFFFFFFFFUL;
+            Tool_CrcNLoad(l_ln_ps, data_apcu8, length_au32, crc_au32, n_u32, &l_next_u32);
+          }
+        }
+        l_busy_b = l_busy_b || l_ln_ps->busy_b;
+      }
+    }
+  }
+
+  return l_ret_u8;
+}
@@ -0,0 +1,6 @@
+#include "Tool.h"
+
+#define TOOL_CRCN_LANES_U32 (4U)
+
+uint32_t Tool_ComputeCrc_u32(const uint8_t *data_pcu8, uint32_t length_u32);
+uint8_t Tool_ComputeCrcN_u8(const uint8_t *const data_apcu8[], const uint32_t length_au32[], uint32_t crc_au32[], uint32_t n_u32);
@@ -0,0 +1,148 @@
+#include "Tool.h"
+#include "Tool_ComputeCrcN.h"
+#include "mock_Tool.h"
+#include "unity.h"
+#include <stdint.h>
+#include <string.h>
+
+/* CRC-32 check value: CRC of the ASCII string "123456789". */
+#define CHECK_CRC_U32 (0xCBF43926UL)
+
+/* Enough buffers to refill every lane several times. */
+#define BUFS_U32 (23U)
+#define DATA_LEN_U32 (2048U)
+
+static const uint8_t Check_au8[9] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+static uint8_t Data_au8[DATA_LEN_U32];
+static const uint8_t *Ptr_apcu8[BUFS_U32];
+static uint32_t Len_au32[BUFS_U32];
+static uint32_t Crc_au32[BUFS_U32];
+
+/*==================[test helper functions]==================================*/
+
+static void FillPattern(void) {
+  uint32_t l_x_u32 = 0xC0FFEE01UL;
+
+  for(uint32_t i = 0U; i < DATA_LEN_U32; i++) {
+    l_x_u32 = (l_x_u32 * 1103515245UL) + 12345UL;
+    Data_au8[i] = (uint8_t)(l_x_u32 >> 23U);
+  }
+}
+
+/* Every result must equal the single-buffer CRC of the same buffer. */
+static void AssertMatchesSingle(uint32_t n_u32) {
+  for(uint32_t i = 0U; i < n_u32; i++) {
+    TEST_ASSERT_EQUAL_HEX32(Tool_ComputeCrc_u32(Ptr_apcu8[i], Len_au32[i]), Crc_au32[i]);
+  }
+}
+
+void setUp(void) {
+  FillPattern();
+  (void)memset(Crc_au32, 0xA5, sizeof(Crc_au32));
+  for(uint32_t i = 0U; i < BUFS_U32; i++) {
+    Ptr_apcu8[i] = Data_au8;
+    Len_au32[i] = 0U;
+  }
+}
+
+void tearDown(void) { /* nothing */ }
+
+/*==================[test cases]=============================================*/
+
+void test_Tool_ComputeCrcN_NullArraysReturn3(void) {
+  TEST_ASSERT_EQUAL_UINT8(3U, Tool_ComputeCrcN_u8(NULL, Len_au32, Crc_au32, 1U));
+  TEST_ASSERT_EQUAL_UINT8(3U, Tool_ComputeCrcN_u8(Ptr_apcu8, NULL, Crc_au32, 1U));
+  TEST_ASSERT_EQUAL_UINT8(3U, Tool_ComputeCrcN_u8(Ptr_apcu8, Len_au32, NULL, 1U));
+  /* An empty batch needs no arrays. */
+  TEST_ASSERT_EQUAL_UINT8(0U, Tool_ComputeCrcN_u8(NULL, NULL, NULL, 0U));
+}
+
+void test_Tool_ComputeCrcN_CheckValue(void) {
+  /* Arrange */
+  Ptr_apcu8[0] = Check_au8;
+  Len_au32[0] = 9U;
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_ComputeCrcN_u8(Ptr_apcu8, Len_au32, Crc_au32, 1U);
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(0U, l_ret_u8);
+  TEST_ASSERT_EQUAL_HEX32(CHECK_CRC_U32, Crc_au32[0]);
+  TEST_ASSERT_EQUAL_HEX32(Tool_ComputeCrc_u32(Check_au8, 9U), Crc_au32[0]);
+}
+
+void test_Tool_ComputeCrcN_NullAndEmptyBuffersMatchSingle(void) {
+  /* Arrange: NULL and empty entries between real ones, lanes get refilled past them */
+  for(uint32_t i = 0U; i < BUFS_U32; i++) {
+    Ptr_apcu8[i] = ((i % 3U) == 0U) ? NULL : &Data_au8[i];
+    Len_au32[i] = ((i % 4U) == 1U) ? 0U : (i + 5U);
+  }
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_ComputeCrcN_u8(Ptr_apcu8, Len_au32, Crc_au32, BUFS_U32);
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(0U, l_ret_u8);
+  AssertMatchesSingle(BUFS_U32);
+  TEST_ASSERT_EQUAL_HEX32(0U, Crc_au32[0]);
+}
+
+void test_Tool_ComputeCrcN_CappedLengthsMatchSingle(void) {
+  /* Arrange: at, just past and far past TOOL_MAX_CRC_LEN_U32 */
+  static const uint32_t Cap_au32[] = {TOOL_MAX_CRC_LEN_U32 - 1U, TOOL_MAX_CRC_LEN_U32, TOOL_MAX_CRC_LEN_U32 + 1U, TOOL_MAX_CRC_LEN_U32 + 3U, DATA_LEN_U32 - 7U};
+  uint32_t l_n_u32 = (uint32_t)(sizeof(Cap_au32) / sizeof(Cap_au32[0]));
+
+  for(uint32_t i = 0U; i < l_n_u32; i++) {
+    Ptr_apcu8[i] = &Data_au8[i];
+    Len_au32[i] = Cap_au32[i];
+  }
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_ComputeCrcN_u8(Ptr_apcu8, Len_au32, Crc_au32, l_n_u32);
+
+  /* Assert: everything past the cap is ignored */
+  TEST_ASSERT_EQUAL_UINT8(0U, l_ret_u8);
+  AssertMatchesSingle(l_n_u32);
+  TEST_ASSERT_EQUAL_HEX32(Tool_ComputeCrc_u32(&Data_au8[2], TOOL_MAX_CRC_LEN_U32), Crc_au32[2]);
+}
+
+void test_Tool_ComputeCrcN_MixedLengthsMatchSingleForEveryBatchSize(void) {
+  for(uint32_t l_n_u32 = 1U; l_n_u32 <= BUFS_U32; l_n_u32++) {
+    for(uint32_t l_s_u32 = 0U; l_s_u32 < 8U; l_s_u32++) {
+      /* Arrange: odd offsets, lengths 1..300 that rarely line up on words */
+      for(uint32_t i = 0U; i < l_n_u32; i++) {
+        Ptr_apcu8[i] = &Data_au8[((i * 97U) + l_s_u32) % 512U];
+        Len_au32[i] = 1U + (((i * 131U) + (l_s_u32 * 29U)) % 300U);
+      }
+      (void)memset(Crc_au32, 0xA5, sizeof(Crc_au32));
+
+      /* Act */
+      uint8_t l_ret_u8 = Tool_ComputeCrcN_u8(Ptr_apcu8, Len_au32, Crc_au32, l_n_u32);
+
+      /* Assert: no entry past the batch is written */
+      TEST_ASSERT_EQUAL_UINT8(0U, l_ret_u8);
+      AssertMatchesSingle(l_n_u32);
+      if(l_n_u32 < BUFS_U32) {
+        TEST_ASSERT_EQUAL_HEX32(0xA5A5A5A5UL, Crc_au32[l_n_u32]);
+      }
+    }
+  }
+}
+
+void test_Tool_ComputeCrcN_EveryShortLengthMatchesSingle(void) {
+  /* Arrange: lengths 1..TOOL_CRCN_LANES_U32*4+3 in one batch, every word tail */
+  uint32_t l_n_u32 = (TOOL_CRCN_LANES_U32 * 4U) + 3U;
+
+  for(uint32_t i = 0U; i < l_n_u32; i++) {
+    Ptr_apcu8[i] = &Data_au8[i * 3U];
+    Len_au32[i] = l_n_u32 - i;
+  }
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_ComputeCrcN_u8(Ptr_apcu8, Len_au32, Crc_au32, l_n_u32);
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(0U, l_ret_u8);
+  AssertMatchesSingle(l_n_u32);
+}
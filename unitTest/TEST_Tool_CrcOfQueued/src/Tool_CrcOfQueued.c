@@ -0,0 +1,78 @@
+
+#include "Tool_CrcOfQueued.h"
+#include <stddef.h>
+
+uint8_t Buffer_u8[TOOL_BUFFER_SIZE_U32] = {0};
+uint32_t Head_u32 = 0;
+uint32_t Tail_u32 = 0;
+uint32_t Count_u32 = 0;
+
+uint32_t StatusFlg_u32 = 0;
+Tool_mode_e Mode_e = Tool_modeIdle_e;
+
+volatile uint32_t Seq_u32 = 0;
+
+/* Bitwise engine of Tool_CrcUpdInl_u32() (Tool_Inline.h). */
+static uint32_t Tool_CrcUpdInl_u32(uint32_t crc_u32, const uint8_t *data_pcu8, uint32_t length_u32) {
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < length_u32; l_i_u32++) {
+    crc_u32 ^= (uint32_t)data_pcu8[l_i_u32];
+    for(uint32_t l_b_u32 = 0U; l_b_u32 < 8U; l_b_u32++) {
+      crc_u32 = (crc_u32 >> 1U) ^ ((uint32_t)TOOL_CRC_POLY_U32 & (0U - (crc_u32 & 1U)));
+    }
+  }
+
+  return crc_u32;
+}
+
+static uint8_t Tool_QueuedCrc_u8(uint32_t offset_u32, uint32_t length_u32, uint32_t *crc_pu32) {
+  uint32_t l_count_u32 = Count_u32;
+  uint8_t l_ret_u8 = 0U;
+
+  if((StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0U) {
+    l_ret_u8 = 2U;
+  } else if((length_u32 > l_count_u32) || (offset_u32 > (l_count_u32 - length_u32))) {
+    l_ret_u8 = 1U;
+  } else {
+    uint32_t l_from_u32 = Tail_u32 + offset_u32;
+    uint32_t l_len_u32 = (length_u32 > TOOL_MAX_CRC_LEN_U32) ? TOOL_MAX_CRC_LEN_U32 : length_u32;
+    uint32_t l_run_u32;
+    uint32_t l_crc_u32;
+
+    l_from_u32 = (l_from_u32 >= TOOL_BUFFER_SIZE_U32) ? (l_from_u32 - TOOL_BUFFER_SIZE_U32) : l_from_u32;
+    l_run_u32 = ((TOOL_BUFFER_SIZE_U32 - l_from_u32) < l_len_u32) ? (TOOL_BUFFER_SIZE_U32 - l_from_u32) : l_len_u32;
+    l_crc_u32 = Tool_CrcUpdInl_u32((uint32_t)TOOL_CRC_INIT_U32, &Buffer_u8[l_from_u32], l_run_u32);
+    l_crc_u32 = Tool_CrcUpdInl_u32(l_crc_u32, Buffer_u8, l_len_u32 - l_run_u32);
+    *crc_pu32 = l_crc_u32 ^ (uint32_t)0xFFFFFFFFUL;
+  }
+
+  return l_ret_u8;
+}
+
+/* FUNCTION TO TEST */
+
+
+uint8_t Tool_CrcOfQueued_u8(uint32_t offset_u32, uint32_t length_u32, uint32_t *crc_pu32) {
+  uint32_t l_crc_u32 = 0U;
+  uint8_t l_ret_u8;
+
+  if(crc_pu32 == NULL) {
+    l_ret_u8 = 3U;
+  } else {
+    /* Read-only: retried like Tool_GetSnapshot_u8() if the writer moved. */
+    l_ret_u8 = 4U;
+    for(uint32_t l_try_u32 = 0U; (l_try_u32 < TOOL_SNAPSHOT_RETRY_U32) && (l_ret_u8 == 4U); l_try_u32++) {
+      uint32_t l_seq0_u32 = Seq_u32;
+
+      TOOL_FENCE_ACQ();
+      l_ret_u8 = Tool_QueuedCrc_u8(offset_u32, length_u32, &l_crc_u32);
+      TOOL_FENCE_ACQ();
+
+      if(((l_seq0_u32 & 1U) != 0U) || (l_seq0_u32 != Seq_u32)) {
+        l_ret_u8 = 4U;
+      }
+    }
+    *crc_pu32 = (l_ret_u8 == 0U) ? l_crc_u32 : 0U;
+  }
+
+  return l_ret_u8;
+}
@@ -0,0 +1,3 @@
+#include "Tool.h"
+
+uint8_t Tool_CrcOfQueued_u8(uint32_t offset_u32, uint32_t length_u32, uint32_t *crc_pu32);
\ No newline at end of file
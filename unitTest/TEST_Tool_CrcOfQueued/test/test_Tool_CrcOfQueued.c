@@ -0,0 +1,148 @@
+#include "Tool.h"
+#include "Tool_CrcOfQueued.h"
+#include "mock_Tool.h"
+#include "unity.h"
+#include <stdint.h>
+#include <string.h>
+
+/* CRC-32 check value: CRC of the ASCII string "123456789". */
+#define CHECK_CRC_U32 (0xCBF43926UL)
+
+static const uint8_t Check_au8[9] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+/*==================[test helper functions]==================================*/
+
+/* Queue the check string starting at ring index tail_u32, wrapping if needed. */
+static void QueueCheck(uint32_t tail_u32, uint32_t offset_u32) {
+  Tail_u32 = tail_u32;
+  Count_u32 = offset_u32 + 9U;
+  Head_u32 = (tail_u32 + Count_u32) % TOOL_BUFFER_SIZE_U32;
+  for(uint32_t i = 0U; i < 9U; i++) {
+    Buffer_u8[(tail_u32 + offset_u32 + i) % TOOL_BUFFER_SIZE_U32] = Check_au8[i];
+  }
+}
+
+void setUp(void) {
+  /* Reset Tool internal globals to a known state */
+  (void)memset(Buffer_u8, 0, TOOL_BUFFER_SIZE_U32);
+
+  Head_u32 = 0U;
+  Tail_u32 = 0U;
+  Count_u32 = 0U;
+
+  StatusFlg_u32 = TOOL_STATUS_INIT_U32;
+  Mode_e = Tool_modeIdle_e;
+
+  Seq_u32 = 0U;
+}
+
+void tearDown(void) { /* nothing */ }
+
+/*==================[test cases]=============================================*/
+
+void test_Tool_CrcOfQueued_NullPointerReturns3(void) {
+  /* Act + Assert */
+  TEST_ASSERT_EQUAL_UINT8(3U, Tool_CrcOfQueued_u8(0U, 0U, NULL));
+}
+
+void test_Tool_CrcOfQueued_NotInitializedReturns2(void) {
+  uint32_t l_crc_u32 = 0xA5A5A5A5UL;
+
+  /* Arrange */
+  QueueCheck(0U, 0U);
+  StatusFlg_u32 = 0U;
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_CrcOfQueued_u8(0U, 9U, &l_crc_u32);
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(2U, l_ret_u8);
+  TEST_ASSERT_EQUAL_UINT32(0U, l_crc_u32);
+}
+
+void test_Tool_CrcOfQueued_RegionBeyondQueuedReturns1(void) {
+  uint32_t l_crc_u32 = 0xA5A5A5A5UL;
+
+  /* Arrange */
+  QueueCheck(0U, 0U);
+
+  /* Act + Assert */
+  TEST_ASSERT_EQUAL_UINT8(1U, Tool_CrcOfQueued_u8(0U, 10U, &l_crc_u32));
+  TEST_ASSERT_EQUAL_UINT32(0U, l_crc_u32);
+  TEST_ASSERT_EQUAL_UINT8(1U, Tool_CrcOfQueued_u8(1U, 9U, &l_crc_u32));
+  TEST_ASSERT_EQUAL_UINT8(1U, Tool_CrcOfQueued_u8(UINT32_MAX, 1U, &l_crc_u32));
+}
+
+void test_Tool_CrcOfQueued_ContiguousRegionGivesCheckValue(void) {
+  uint32_t l_crc_u32 = 0U;
+
+  /* Arrange */
+  QueueCheck(5U, 0U);
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_CrcOfQueued_u8(0U, 9U, &l_crc_u32);
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(0U, l_ret_u8);
+  TEST_ASSERT_EQUAL_HEX32(CHECK_CRC_U32, l_crc_u32);
+}
+
+void test_Tool_CrcOfQueued_WrappedRegionGivesCheckValue(void) {
+  uint32_t l_crc_u32 = 0U;
+
+  /* Arrange: "1234" at the end of the ring, "56789" at its start. */
+  QueueCheck(TOOL_BUFFER_SIZE_U32 - 7U, 3U);
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_CrcOfQueued_u8(3U, 9U, &l_crc_u32);
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(0U, l_ret_u8);
+  TEST_ASSERT_EQUAL_HEX32(CHECK_CRC_U32, l_crc_u32);
+}
+
+void test_Tool_CrcOfQueued_ZeroLengthGivesZero(void) {
+  uint32_t l_crc_u32 = 0xA5A5A5A5UL;
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_CrcOfQueued_u8(0U, 0U, &l_crc_u32);
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(0U, l_ret_u8);
+  TEST_ASSERT_EQUAL_UINT32(0U, l_crc_u32);
+}
+
+void test_Tool_CrcOfQueued_LeavesBookkeepingUntouched(void) {
+  uint32_t l_crc_u32 = 0U;
+
+  /* Arrange */
+  QueueCheck(TOOL_BUFFER_SIZE_U32 - 4U, 0U);
+  Seq_u32 = 6U;
+
+  /* Act */
+  (void)Tool_CrcOfQueued_u8(0U, 9U, &l_crc_u32);
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT32(TOOL_BUFFER_SIZE_U32 - 4U, Tail_u32);
+  TEST_ASSERT_EQUAL_UINT32(5U, Head_u32);
+  TEST_ASSERT_EQUAL_UINT32(9U, Count_u32);
+  TEST_ASSERT_EQUAL_UINT32(TOOL_STATUS_INIT_U32, StatusFlg_u32);
+  TEST_ASSERT_EQUAL_UINT32(6U, Seq_u32);
+  TEST_ASSERT_EQUAL_UINT8('1', Buffer_u8[TOOL_BUFFER_SIZE_U32 - 4U]);
+}
+
+void test_Tool_CrcOfQueued_WriterInProgressReturns4(void) {
+  uint32_t l_crc_u32 = 0xA5A5A5A5UL;
+
+  /* Arrange: odd counter means an update never completes during the read */
+  QueueCheck(0U, 0U);
+  Seq_u32 = 11U;
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_CrcOfQueued_u8(0U, 9U, &l_crc_u32);
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(4U, l_ret_u8);
+  TEST_ASSERT_EQUAL_UINT32(0U, l_crc_u32);
+  TEST_ASSERT_EQUAL_UINT32(11U, Seq_u32);
+}
@@ -0,0 +1,48 @@
+
+#include "Tool_GetSnapshot.h"
+#include <stddef.h>
+
+uint8_t Buffer_u8[TOOL_BUFFER_SIZE_U32] = {0};
+uint32_t Head_u32 = 0;
+uint32_t Tail_u32 = 0;
+uint32_t Count_u32 = 0;
+
+uint32_t StatusFlg_u32 = 0;
+Tool_mode_e Mode_e = Tool_modeIdle_e;
+
+volatile uint32_t Seq_u32 = 0;
+
+/* FUNCTION TO TEST */
+
+
+uint8_t Tool_GetSnapshot_u8(Tool_snapshot_t *snapshot_ps) {
+  uint8_t l_ret_u8 = 1U;
+  uint32_t l_try_u32;
+  uint32_t l_seq0_u32;
+  uint32_t l_seq1_u32;
+
+  if(snapshot_ps == NULL) {
+    l_ret_u8 = 2U;
+  } else {
+    /* Bounded retry: the reader gives up instead of stalling behind a writer. */
+    for(l_try_u32 = 0U; (l_try_u32 < TOOL_SNAPSHOT_RETRY_U32) && (l_ret_u8 == 1U); l_try_u32++) {
+      l_seq0_u32 = Seq_u32;
+      TOOL_FENCE_ACQ();
+
+      snapshot_ps->mode_e = Mode_e;
+      snapshot_ps->statusFlg_u32 = StatusFlg_u32;
+      snapshot_ps->count_u32 = Count_u32;
+      snapshot_ps->head_u32 = Head_u32;
+      snapshot_ps->tail_u32 = Tail_u32;
+
+      TOOL_FENCE_ACQ();
+      l_seq1_u32 = Seq_u32;
+
+      if(((l_seq0_u32 & 1U) == 0U) && (l_seq0_u32 == l_seq1_u32)) {
+        l_ret_u8 = 0U;
+      }
+    }
+  }
+
+  return l_ret_u8;
+}
@@ -0,0 +1,3 @@
+#include "Tool.h"
+
+uint8_t Tool_GetSnapshot_u8(Tool_snapshot_t *snapshot_ps);
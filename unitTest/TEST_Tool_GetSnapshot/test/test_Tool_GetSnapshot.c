@@ -0,0 +1,70 @@
+#include "Tool.h"
+#include "Tool_GetSnapshot.h"
+#include "mock_Tool.h"
+#include "unity.h"
+#include <stdint.h>
+#include <string.h>
+
+/*==================[test helper functions]==================================*/
+
+void setUp(void) {
+  /* Reset Tool internal globals to a known state */
+  (void)memset(Buffer_u8, 0, TOOL_BUFFER_SIZE_U32);
+
+  Head_u32 = 0U;
+  Tail_u32 = 0U;
+  Count_u32 = 0U;
+
+  StatusFlg_u32 = 0U;
+  Mode_e = Tool_modeIdle_e;
+
+  Seq_u32 = 0U;
+}
+
+void tearDown(void) { /* nothing */ }
+
+/*==================[test cases]=============================================*/
+
+void test_Tool_GetSnapshot_NullPointerReturns2(void) {
+  /* Act + Assert */
+  TEST_ASSERT_EQUAL_UINT8(2U, Tool_GetSnapshot_u8(NULL));
+}
+
+void test_Tool_GetSnapshot_CopiesAllFieldsWhenIdleWriter(void) {
+  Tool_snapshot_t l_snap_s;
+
+  /* Arrange */
+  Mode_e = Tool_modeRun_e;
+  StatusFlg_u32 = (TOOL_STATUS_INIT_U32 | TOOL_STATUS_OVF_U32);
+  Count_u32 = 5U;
+  Head_u32 = 12U;
+  Tail_u32 = 7U;
+  Seq_u32 = 10U;
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_GetSnapshot_u8(&l_snap_s);
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(0U, l_ret_u8);
+  TEST_ASSERT_EQUAL_UINT32(Tool_modeRun_e, l_snap_s.mode_e);
+  TEST_ASSERT_EQUAL_UINT32((TOOL_STATUS_INIT_U32 | TOOL_STATUS_OVF_U32), l_snap_s.statusFlg_u32);
+  TEST_ASSERT_EQUAL_UINT32(5U, l_snap_s.count_u32);
+  TEST_ASSERT_EQUAL_UINT32(12U, l_snap_s.head_u32);
+  TEST_ASSERT_EQUAL_UINT32(7U, l_snap_s.tail_u32);
+}
+
+void test_Tool_GetSnapshot_WriterInProgressReturns1(void) {
+  Tool_snapshot_t l_snap_s;
+
+  /* Arrange: odd counter means an update never completes during the read */
+  Count_u32 = 3U;
+  Seq_u32 = 11U;
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_GetSnapshot_u8(&l_snap_s);
+
+  /* Assert: reader gave up, counter untouched */
+  TEST_ASSERT_EQUAL_UINT8(1U, l_ret_u8);
+  TEST_ASSERT_EQUAL_UINT32(11U, Seq_u32);
+  TEST_ASSERT_EQUAL_UINT32(3U, l_snap_s.count_u32);
+}
@@ -0,0 +1,269 @@
+#include "Tool_PopBlock.h"
+#include <stddef.h>
+#include <string.h>
+
+uint8_t Buffer_u8[TOOL_BUFFER_SIZE_U32] = {0};
+uint32_t Head_u32 = 0;
+uint32_t Tail_u32 = 0;
+uint32_t Count_u32 = 0;
+
+uint32_t StatusFlg_u32 = 0;
+Tool_mode_e Mode_e = Tool_modeIdle_e;
+
+volatile uint32_t Seq_u32 = 0;
+
+bool BlockSealed_b[TOOL_CRC_BLOCKS_U32] = {false};
+uint32_t BlockCrc_u32[TOOL_CRC_BLOCKS_U32] = {0};
+uint32_t BlockFrom_u32[TOOL_CRC_BLOCKS_U32] = {0};
+
+uint32_t ShadowCrc_u32 = 0;
+uint32_t ShadowPow_u32[TOOL_BUFFER_SIZE_U32] = {0};
+uint32_t TstCrc_u32 = 0;
+uint32_t TstCursor_u32 = 0;
+uint32_t TstSum_u32 = 0;
+
+/* Bitwise engine of Tool_CrcUpdInl_u32() (Tool_Inline.h). */
+static uint32_t Tool_CrcUpdInl_u32(uint32_t crc_u32, const uint8_t *data_pcu8, uint32_t length_u32) {
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < length_u32; l_i_u32++) {
+    crc_u32 ^= (uint32_t)data_pcu8[l_i_u32];
+    for(uint32_t l_b_u32 = 0U; l_b_u32 < 8U; l_b_u32++) {
+      crc_u32 = (crc_u32 >> 1U) ^ ((uint32_t)TOOL_CRC_POLY_U32 & (0U - (crc_u32 & 1U)));
+    }
+  }
+
+  return crc_u32;
+}
+
+/* Tool_CopyCrcUpdInl_u32() (Tool_Inline.h), same result without the fusion. */
+static uint32_t Tool_CopyCrcUpdInl_u32(uint32_t crc_u32, uint8_t *dst_pu8, const uint8_t *src_pcu8, uint32_t length_u32) {
+  (void)memcpy(dst_pu8, src_pcu8, length_u32);
+
+  return Tool_CrcUpdInl_u32(crc_u32, dst_pu8, length_u32);
+}
+
+/* Tool_ComputeCrcInl_u32() (Tool_Inline.h). */
+static uint32_t Tool_ComputeCrcInl_u32(const uint8_t *data_pcu8, uint32_t length_u32) {
+  uint32_t l_crc_u32 = (uint32_t)TOOL_CRC_INIT_U32;
+
+  if((data_pcu8 != NULL) && (length_u32 != 0U)) {
+    uint32_t l_len_u32 = (length_u32 > TOOL_MAX_CRC_LEN_U32) ? TOOL_MAX_CRC_LEN_U32 : length_u32;
+
+    l_crc_u32 = Tool_CrcUpdInl_u32(l_crc_u32, data_pcu8, l_len_u32);
+  }
+  l_crc_u32 ^= (uint32_t)0xFFFFFFFFUL;
+
+  return l_crc_u32;
+}
+
+/* Multiply a reflected CRC-32 polynomial by x^n modulo P. */
+static uint32_t Tool_ShadowMulX_u32(uint32_t val_u32, uint32_t n_u32) {
+  uint32_t l_val_u32 = val_u32;
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < n_u32; l_i_u32++) {
+    l_val_u32 = ((l_val_u32 & 1U) != 0U) ? ((l_val_u32 >> 1U) ^ TOOL_CRC_POLY_U32) : (l_val_u32 >> 1U);
+  }
+
+  return l_val_u32;
+}
+
+/* Multipliers of Tool_ShadowUpd(); the image is all zeros, so is its CRC. */
+void Tool_ShadowInit(void) {
+  uint32_t l_pow_u32 = Tool_ShadowMulX_u32(0x80000000UL, 32U); /* x^32 */
+
+  for(uint32_t l_i_u32 = TOOL_BUFFER_SIZE_U32; l_i_u32 > 0U; l_i_u32--) {
+    ShadowPow_u32[l_i_u32 - 1U] = l_pow_u32;
+    l_pow_u32 = Tool_ShadowMulX_u32(l_pow_u32, 8U);
+  }
+  ShadowCrc_u32 = 0U;
+}
+
+static uint32_t Tool_ShadowTerm_u32(uint32_t index_u32, uint8_t value_u8) {
+  uint32_t l_pow_u32 = ShadowPow_u32[index_u32];
+  uint32_t l_crc_u32 = 0U;
+
+  for(uint32_t l_bit_u32 = 0U; l_bit_u32 < 8U; l_bit_u32++) {
+    l_crc_u32 ^= l_pow_u32 & (0U - (((uint32_t)value_u8 >> (7U - l_bit_u32)) & 1U));
+    l_pow_u32 = (l_pow_u32 >> 1U) ^ ((uint32_t)TOOL_CRC_POLY_U32 & (0U - (l_pow_u32 & 1U)));
+  }
+
+  return l_crc_u32;
+}
+
+static void Tool_ShadowUpd(uint32_t index_u32, uint8_t delta_u8) {
+  uint32_t l_term_u32 = Tool_ShadowTerm_u32(index_u32, delta_u8);
+
+  ShadowCrc_u32 ^= l_term_u32;
+  TstCrc_u32 ^= l_term_u32 & (0U - (uint32_t)(index_u32 < TstCursor_u32));
+}
+
+/* Next Tool_RunTstStep_u8() starts a new sweep. */
+static void Tool_TstRestart(void) {
+  TstCursor_u32 = 0U;
+  TstSum_u32 = 0U;
+  TstCrc_u32 = 0U;
+}
+
+/* Recompute the shadow CRC from the image. Needed after corrupted bytes were
+ * dropped: they no longer hold the values the shadow had folded in, so an
+ * incremental update would keep it out of step. Restarts a sliced sweep. */
+static void Tool_ShadowRebuild(void) {
+  ShadowCrc_u32 = Tool_CrcUpdInl_u32(0U, Buffer_u8, TOOL_BUFFER_SIZE_U32);
+  Tool_TstRestart();
+}
+
+/* Longest contiguous run of at most want_u32 bytes from index_u32: up to the
+ * end of Buffer_u8 or, with block CRCs, of the block (blocks divide it). */
+static uint32_t Tool_RunLen_u32(uint32_t index_u32, uint32_t want_u32) {
+  uint32_t l_run_u32 = TOOL_CRC_BLOCK_U32 - (index_u32 % TOOL_CRC_BLOCK_U32);
+
+  return (want_u32 < l_run_u32) ? want_u32 : l_run_u32;
+}
+
+/* Fused copy of one run of a block; only the first *crcLeft_pu32 bytes still
+ * feed the CRC (cap of Tool_ComputeCrc_u32()). */
+static uint32_t Tool_CopyRun_u32(uint32_t crc_u32, uint8_t *dst_pu8, const uint8_t *src_pcu8, uint32_t run_u32, uint32_t *crcLeft_pu32) {
+  uint32_t l_n_u32 = (run_u32 < *crcLeft_pu32) ? run_u32 : *crcLeft_pu32;
+  uint32_t l_crc_u32 = Tool_CopyCrcUpdInl_u32(crc_u32, dst_pu8, src_pcu8, l_n_u32);
+
+  (void)memcpy(&dst_pu8[l_n_u32], &src_pcu8[l_n_u32], run_u32 - l_n_u32);
+  *crcLeft_pu32 -= l_n_u32;
+
+  return l_crc_u32;
+}
+
+/* Seal block b_u32 over its bytes from offset from_u32 to its end. */
+static void Tool_BlockSealAt(uint32_t b_u32, uint32_t from_u32) {
+  uint32_t l_start_u32 = b_u32 * TOOL_CRC_BLOCK_U32;
+
+  BlockFrom_u32[b_u32] = from_u32;
+  BlockCrc_u32[b_u32] = Tool_ComputeCrcInl_u32(&Buffer_u8[l_start_u32 + from_u32], TOOL_CRC_BLOCK_U32 - from_u32);
+  BlockSealed_b[b_u32] = true;
+}
+
+/* First corrupted sealed block met within the next length_u32 queued bytes:
+ * *prefix_pu32 intact queued bytes lie before it, *bad_pu32 bytes are covered
+ * by it (up to the end of the block). Returns false if there is none. */
+static bool Tool_BlockScan_b(uint32_t length_u32, uint32_t *prefix_pu32, uint32_t *bad_pu32) {
+  uint32_t l_idx_u32 = Tail_u32;
+  uint32_t l_done_u32 = 0U;
+  bool l_bad_b = false;
+
+  while((l_done_u32 < length_u32) && !l_bad_b) {
+    uint32_t l_b_u32 = l_idx_u32 / TOOL_CRC_BLOCK_U32;
+    uint32_t l_start_u32 = l_b_u32 * TOOL_CRC_BLOCK_U32;
+    uint32_t l_from_u32 = BlockFrom_u32[l_b_u32];
+
+    if(BlockSealed_b[l_b_u32] && (Tool_ComputeCrcInl_u32(&Buffer_u8[l_start_u32 + l_from_u32], TOOL_CRC_BLOCK_U32 - l_from_u32) != BlockCrc_u32[l_b_u32])) {
+      /* A sealed block holds Tail_u32 at l_from_u32 or lies wholly after it. */
+      *prefix_pu32 = l_done_u32 + ((l_start_u32 + l_from_u32) - l_idx_u32);
+      *bad_pu32 = TOOL_CRC_BLOCK_U32 - l_from_u32;
+      l_bad_b = true;
+    }
+    l_done_u32 += TOOL_CRC_BLOCK_U32 - (l_idx_u32 - l_start_u32);
+    l_idx_u32 = (l_start_u32 + TOOL_CRC_BLOCK_U32) % TOOL_BUFFER_SIZE_U32;
+  }
+
+  return l_bad_b;
+}
+
+/* Drop the bad_u32 queued bytes that follow the prefix_u32 oldest ones
+ * (inside the writer's sequence bracket). The prefix moves up to close the
+ * gap, so it stays queued in order, and the blocks it now fills are resealed
+ * over it. The gap ends on a block boundary, so every block is whole again.
+ * The shadow CRC is rebuilt afterwards (see Tool_ShadowRebuild()). */
+static void Tool_BlockDrop(uint32_t prefix_u32, uint32_t bad_u32) {
+  uint32_t l_idx_u32;
+  uint32_t l_left_u32;
+
+  /* Last byte first: source and destination may overlap. */
+  for(uint32_t l_i_u32 = prefix_u32; l_i_u32 > 0U; l_i_u32--) {
+    uint32_t l_src_u32 = (Tail_u32 + l_i_u32 - 1U) % TOOL_BUFFER_SIZE_U32;
+
+    Buffer_u8[(l_src_u32 + bad_u32) % TOOL_BUFFER_SIZE_U32] = Buffer_u8[l_src_u32];
+  }
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < bad_u32; l_i_u32++) {
+    BlockSealed_b[Tail_u32 / TOOL_CRC_BLOCK_U32] = false;
+    Buffer_u8[Tail_u32] = 0U;
+    Tail_u32 = (Tail_u32 + 1U) % TOOL_BUFFER_SIZE_U32;
+  }
+  Count_u32 -= bad_u32;
+
+  l_idx_u32 = Tail_u32;
+  l_left_u32 = prefix_u32;
+  while(l_left_u32 != 0U) {
+    uint32_t l_from_u32 = l_idx_u32 % TOOL_CRC_BLOCK_U32;
+
+    Tool_BlockSealAt(l_idx_u32 / TOOL_CRC_BLOCK_U32, l_from_u32);
+    l_left_u32 -= TOOL_CRC_BLOCK_U32 - l_from_u32;
+    l_idx_u32 = ((l_idx_u32 - l_from_u32) + TOOL_CRC_BLOCK_U32) % TOOL_BUFFER_SIZE_U32;
+  }
+  Tool_ShadowRebuild();
+}
+
+void Tool_BlockSeal(void) {
+  uint32_t l_b_u32 = (((Head_u32 + TOOL_BUFFER_SIZE_U32) - 1U) % TOOL_BUFFER_SIZE_U32) / TOOL_CRC_BLOCK_U32;
+  uint32_t l_start_u32 = l_b_u32 * TOOL_CRC_BLOCK_U32;
+  uint32_t l_from_u32 = 0U;
+
+  /* Bytes of the block before Tail_u32 are already consumed (or stale). */
+  if((Tail_u32 - l_start_u32) < TOOL_CRC_BLOCK_U32) {
+    l_from_u32 = Tail_u32 - l_start_u32;
+  }
+  Tool_BlockSealAt(l_b_u32, l_from_u32);
+}
+
+/* FUNCTION TO TEST */
+
+uint8_t Tool_PopBlock_u8(uint8_t *dst_pu8, uint32_t length_u32, uint32_t *crc_pu32) {
+  uint32_t l_crc_u32 = (uint32_t)TOOL_CRC_INIT_U32;
+  uint8_t l_ret_u8 = 0U;
+
+  TOOL_SEQ_WRITE_BEGIN();
+
+  if((dst_pu8 == NULL) && (length_u32 != 0U)) {
+    StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+    l_ret_u8 = 3U;
+  } else if((StatusFlg_u32 & TOOL_STATUS_INIT_U32) == 0U) {
+    StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+    l_ret_u8 = 2U;
+  } else if(length_u32 > Count_u32) {
+    l_ret_u8 = 1U;
+  } else {
+    /* Check every sealed block before the first byte leaves the ring. */
+    uint32_t l_prefix_u32 = 0U;
+    uint32_t l_bad_u32 = 0U;
+
+    if(Tool_BlockScan_b(length_u32, &l_prefix_u32, &l_bad_u32)) {
+      Tool_BlockDrop(l_prefix_u32, l_bad_u32);
+      StatusFlg_u32 |= TOOL_STATUS_CRC_U32;
+      l_ret_u8 = 4U;
+    }
+    if(l_ret_u8 == 0U) {
+      uint32_t l_crcLeft_u32 = TOOL_MAX_CRC_LEN_U32;
+      uint32_t l_done_u32 = 0U;
+
+      while(l_done_u32 < length_u32) {
+        uint32_t l_run_u32 = Tool_RunLen_u32(Tail_u32, length_u32 - l_done_u32);
+
+        BlockSealed_b[Tail_u32 / TOOL_CRC_BLOCK_U32] = false;
+        for(uint32_t l_i_u32 = 0U; l_i_u32 < l_run_u32; l_i_u32++) {
+          Tool_ShadowUpd(Tail_u32 + l_i_u32, Buffer_u8[Tail_u32 + l_i_u32]);
+        }
+        l_crc_u32 = Tool_CopyRun_u32(l_crc_u32, &dst_pu8[l_done_u32], &Buffer_u8[Tail_u32], l_run_u32, &l_crcLeft_u32);
+        (void)memset(&Buffer_u8[Tail_u32], 0, l_run_u32);
+        Tail_u32 = (Tail_u32 + l_run_u32) % TOOL_BUFFER_SIZE_U32;
+        Count_u32 -= l_run_u32;
+        l_done_u32 += l_run_u32;
+      }
+    }
+  }
+
+  TOOL_SEQ_WRITE_END();
+
+  if(crc_pu32 != NULL) {
+    *crc_pu32 = (l_ret_u8 == 0U) ? (l_crc_u32 ^ (uint32_t)0xFFFFFFFFUL) : 0U;
+  }
+
+
+  return l_ret_u8;
+}
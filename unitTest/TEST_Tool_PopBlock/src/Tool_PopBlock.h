@@ -0,0 +1,18 @@
+#include "Tool.h"
+#include <stdbool.h>
+
+#define TOOL_CRC_BLOCK_U32 (16U)
+#define TOOL_CRC_BLOCKS_U32 (TOOL_BUFFER_SIZE_U32 / TOOL_CRC_BLOCK_U32)
+
+extern bool BlockSealed_b[TOOL_CRC_BLOCKS_U32];
+extern uint32_t BlockCrc_u32[TOOL_CRC_BLOCKS_U32];
+extern uint32_t BlockFrom_u32[TOOL_CRC_BLOCKS_U32];
+
+extern uint32_t ShadowCrc_u32;
+extern uint32_t TstCrc_u32;
+extern uint32_t TstCursor_u32;
+extern uint32_t TstSum_u32;
+
+void Tool_ShadowInit(void);
+void Tool_BlockSeal(void);
+uint8_t Tool_PopBlock_u8(uint8_t *dst_pu8, uint32_t length_u32, uint32_t *crc_pu32);
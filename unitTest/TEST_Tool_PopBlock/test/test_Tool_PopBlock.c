@@ -0,0 +1,239 @@
+#include "Tool.h"
+#include "Tool_PopBlock.h"
+#include "mock_Tool.h"
+#include "unity.h"
+#include <stdint.h>
+#include <string.h>
+
+/*==================[test helper functions]==================================*/
+
+/* Value of the n-th byte ever pushed. */
+static uint8_t Val_u8(uint32_t n_u32) {
+  return (uint8_t)((n_u32 * 7U) + 3U);
+}
+
+/* Raw CRC (init 0, no final XOR) of the whole image: what Tool_RunTst_u8() compares with ShadowCrc_u32. */
+static uint32_t ImageCrc_u32(void) {
+  uint32_t l_crc_u32 = 0U;
+
+  for(uint32_t i = 0U; i < TOOL_BUFFER_SIZE_U32; i++) {
+    l_crc_u32 ^= (uint32_t)Buffer_u8[i];
+    for(uint32_t b = 0U; b < 8U; b++) {
+      l_crc_u32 = ((l_crc_u32 & 1U) != 0U) ? ((l_crc_u32 >> 1U) ^ (uint32_t)TOOL_CRC_POLY_U32) : (l_crc_u32 >> 1U);
+    }
+  }
+
+  return l_crc_u32;
+}
+
+/* Push n_u32 bytes numbered from first_u32, sealing full blocks and keeping
+ * the shadow CRC like Tool_Push_u8(). */
+static void Push(uint32_t first_u32, uint32_t n_u32) {
+  for(uint32_t i = 0U; i < n_u32; i++) {
+    Buffer_u8[Head_u32] = Val_u8(first_u32 + i);
+    Head_u32 = (Head_u32 + 1U) % TOOL_BUFFER_SIZE_U32;
+    Count_u32++;
+    if((Head_u32 % TOOL_CRC_BLOCK_U32) == 0U) {
+      Tool_BlockSeal();
+    }
+  }
+  ShadowCrc_u32 = ImageCrc_u32();
+}
+
+/* Reference CRC-32 (Tool_ComputeCrc_u32() semantics, no cap needed here). */
+static uint32_t RefCrc_u32(const uint8_t *data_pcu8, uint32_t length_u32) {
+  uint32_t l_crc_u32 = (uint32_t)TOOL_CRC_INIT_U32;
+
+  for(uint32_t i = 0U; i < length_u32; i++) {
+    l_crc_u32 ^= (uint32_t)data_pcu8[i];
+    for(uint32_t b = 0U; b < 8U; b++) {
+      l_crc_u32 = ((l_crc_u32 & 1U) != 0U) ? ((l_crc_u32 >> 1U) ^ (uint32_t)TOOL_CRC_POLY_U32) : (l_crc_u32 >> 1U);
+    }
+  }
+
+  return l_crc_u32 ^ (uint32_t)0xFFFFFFFFUL;
+}
+
+/* Empty ring with head and tail at index_u32. */
+static void StartAt(uint32_t index_u32) {
+  Head_u32 = index_u32;
+  Tail_u32 = index_u32;
+  Count_u32 = 0U;
+}
+
+void setUp(void) {
+  (void)memset(Buffer_u8, 0, TOOL_BUFFER_SIZE_U32);
+  (void)memset(BlockSealed_b, 0, sizeof(BlockSealed_b));
+  Tool_ShadowInit();
+  TstCursor_u32 = 0U;
+  TstCrc_u32 = 0U;
+  TstSum_u32 = 0U;
+
+  StartAt(0U);
+
+  StatusFlg_u32 = TOOL_STATUS_INIT_U32;
+  Mode_e = Tool_modeRun_e;
+
+  Seq_u32 = 0U;
+}
+
+void tearDown(void) { /* nothing */ }
+
+/*==================[test cases]=============================================*/
+
+void test_Tool_PopBlock_IntactBlocksPopWithCrc(void) {
+  uint8_t l_dst_au8[40];
+  uint8_t l_ref_au8[40];
+  uint32_t l_crc_u32 = 0U;
+
+  /* Arrange */
+  Push(0U, 48U);
+  for(uint32_t i = 0U; i < 40U; i++) {
+    l_ref_au8[i] = Val_u8(i);
+  }
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_PopBlock_u8(l_dst_au8, 40U, &l_crc_u32);
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(0U, l_ret_u8);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(l_ref_au8, l_dst_au8, 40U);
+  TEST_ASSERT_EQUAL_UINT32(8U, Count_u32);
+  TEST_ASSERT_EQUAL_UINT32(40U, Tail_u32);
+  TEST_ASSERT_EQUAL_UINT32(0U, StatusFlg_u32 & TOOL_STATUS_CRC_U32);
+}
+
+void test_Tool_PopBlock_CorruptTailBlockDropsOnlyThatBlock(void) {
+  uint8_t l_dst_au8[40];
+  uint32_t l_crc_u32 = 1U;
+
+  /* Arrange: three sealed blocks, one flipped bit in the first */
+  Push(0U, 48U);
+  Buffer_u8[5] ^= 0x20U;
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_PopBlock_u8(l_dst_au8, 40U, &l_crc_u32);
+
+  /* Assert: the block is gone, the rest still queued */
+  TEST_ASSERT_EQUAL_UINT8(4U, l_ret_u8);
+  TEST_ASSERT_NOT_EQUAL(0U, StatusFlg_u32 & TOOL_STATUS_CRC_U32);
+  TEST_ASSERT_EQUAL_UINT32(0U, l_crc_u32);
+  TEST_ASSERT_EQUAL_UINT32(32U, Count_u32);
+  TEST_ASSERT_EQUAL_UINT32(16U, Tail_u32);
+  TEST_ASSERT_EQUAL_UINT8(Val_u8(16U), Buffer_u8[Tail_u32]);
+}
+
+void test_Tool_PopBlock_CorruptLaterBlockKeepsIntactPrefixQueued(void) {
+  uint8_t l_dst_au8[64];
+  uint8_t l_ref_au8[64];
+  uint32_t l_crc_u32 = 0U;
+  uint32_t l_n_u32 = 0U;
+
+  /* Arrange: tail 4 bytes into block 0, bit flip in block 2 (bytes 32..47) */
+  Push(0U, 60U);
+  (void)Tool_PopBlock_u8(l_dst_au8, 4U, NULL);
+  Buffer_u8[40] ^= 0x01U;
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_PopBlock_u8(l_dst_au8, 50U, &l_crc_u32);
+
+  /* Assert: only the 16 bytes of block 2 are dropped */
+  TEST_ASSERT_EQUAL_UINT8(4U, l_ret_u8);
+  TEST_ASSERT_NOT_EQUAL(0U, StatusFlg_u32 & TOOL_STATUS_CRC_U32);
+  TEST_ASSERT_EQUAL_UINT32(40U, Count_u32);
+  TEST_ASSERT_EQUAL_UINT32(20U, Tail_u32);
+
+  /* Assert: a retry delivers bytes 4..31 and 48..59, in order, with a good CRC */
+  for(uint32_t i = 4U; i < 60U; i++) {
+    if((i < 32U) || (i >= 48U)) {
+      l_ref_au8[l_n_u32] = Val_u8(i);
+      l_n_u32++;
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT8(0U, Tool_PopBlock_u8(l_dst_au8, 40U, &l_crc_u32));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(l_ref_au8, l_dst_au8, 40U);
+  TEST_ASSERT_EQUAL_HEX32(RefCrc_u32(l_ref_au8, 40U), l_crc_u32);
+  TEST_ASSERT_EQUAL_UINT32(0U, Count_u32);
+}
+
+void test_Tool_PopBlock_MovedPrefixIsResealed(void) {
+  uint8_t l_dst_au8[64];
+
+  /* Arrange: prefix in blocks 0..1, corrupt block 2, then drop it */
+  Push(0U, 64U);
+  Buffer_u8[33] ^= 0x80U;
+  TEST_ASSERT_EQUAL_UINT8(4U, Tool_PopBlock_u8(l_dst_au8, 48U, NULL));
+  StatusFlg_u32 &= ~TOOL_STATUS_CRC_U32;
+
+  /* Act: corrupt a moved prefix byte */
+  Buffer_u8[Tail_u32 + 3U] ^= 0x02U;
+  uint8_t l_ret_u8 = Tool_PopBlock_u8(l_dst_au8, 10U, NULL);
+
+  /* Assert: still protected, its new block is dropped */
+  TEST_ASSERT_EQUAL_UINT8(4U, l_ret_u8);
+  TEST_ASSERT_NOT_EQUAL(0U, StatusFlg_u32 & TOOL_STATUS_CRC_U32);
+  TEST_ASSERT_EQUAL_UINT32(32U, Count_u32);
+  TEST_ASSERT_EQUAL_UINT32(32U, Tail_u32);
+}
+
+void test_Tool_PopBlock_PrefixWrapsAroundTheRing(void) {
+  uint8_t l_dst_au8[64];
+  uint8_t l_ref_au8[64];
+
+  /* Arrange: queue from index 40 across the wrap, corrupt block 1 (16..31) */
+  StartAt(40U);
+  Push(0U, 56U);
+  Buffer_u8[20] ^= 0x10U;
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_PopBlock_u8(l_dst_au8, 56U, NULL);
+
+  /* Assert: bytes 0..39 (indices 40..63, 0..15) stay queued and pop in order */
+  TEST_ASSERT_EQUAL_UINT8(4U, l_ret_u8);
+  TEST_ASSERT_EQUAL_UINT32(40U, Count_u32);
+  TEST_ASSERT_EQUAL_UINT32(56U, Tail_u32);
+  for(uint32_t i = 0U; i < 40U; i++) {
+    l_ref_au8[i] = Val_u8(i);
+  }
+  TEST_ASSERT_EQUAL_UINT8(0U, Tool_PopBlock_u8(l_dst_au8, 40U, NULL));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(l_ref_au8, l_dst_au8, 40U);
+}
+
+void test_Tool_PopBlock_CorruptBlockBeyondRangeIsNotChecked(void) {
+  uint8_t l_dst_au8[16];
+
+  /* Arrange: bit flip in block 2, pop stays inside block 0 */
+  Push(0U, 48U);
+  Buffer_u8[36] ^= 0x04U;
+
+  /* Act + Assert */
+  TEST_ASSERT_EQUAL_UINT8(0U, Tool_PopBlock_u8(l_dst_au8, 16U, NULL));
+  TEST_ASSERT_EQUAL_UINT32(32U, Count_u32);
+  TEST_ASSERT_EQUAL_UINT32(0U, StatusFlg_u32 & TOOL_STATUS_CRC_U32);
+}
+
+void test_Tool_PopBlock_DropKeepsShadowInStepForSelfTest(void) {
+  uint8_t l_dst_au8[64];
+
+  /* Arrange: a clean pop keeps the shadow in step, then a real bit flip */
+  Push(0U, 60U);
+  TEST_ASSERT_EQUAL_UINT8(0U, Tool_PopBlock_u8(l_dst_au8, 4U, NULL));
+  TEST_ASSERT_EQUAL_HEX32(ImageCrc_u32(), ShadowCrc_u32);
+  TstCursor_u32 = 32U;
+  Buffer_u8[40] ^= 0x01U;
+  TEST_ASSERT_NOT_EQUAL(ImageCrc_u32(), ShadowCrc_u32);
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_PopBlock_u8(l_dst_au8, 50U, NULL);
+
+  /* Assert: the self-test matches again, the sliced sweep starts over */
+  TEST_ASSERT_EQUAL_UINT8(4U, l_ret_u8);
+  TEST_ASSERT_EQUAL_HEX32(ImageCrc_u32(), ShadowCrc_u32);
+  TEST_ASSERT_EQUAL_UINT32(0U, TstCursor_u32);
+  TEST_ASSERT_EQUAL_UINT8(0U, Tool_PopBlock_u8(l_dst_au8, 40U, NULL));
+  TEST_ASSERT_EQUAL_HEX32(ImageCrc_u32(), ShadowCrc_u32);
+
+  /* Assert: later corruption is still seen */
+  Buffer_u8[7] ^= 0x10U;
+  TEST_ASSERT_NOT_EQUAL(ImageCrc_u32(), ShadowCrc_u32);
+}
@@ -0,0 +1,114 @@
+#include "Tool_RunTstStep.h"
+
+uint8_t Buffer_u8[TOOL_BUFFER_SIZE_U32] = {0};
+uint32_t Head_u32 = 0;
+uint32_t Tail_u32 = 0;
+uint32_t Count_u32 = 0;
+
+uint32_t StatusFlg_u32 = 0;
+Tool_mode_e Mode_e = Tool_modeIdle_e;
+
+volatile uint32_t Seq_u32 = 0;
+
+uint32_t ShadowCrc_u32 = 0;
+uint32_t ShadowPow_u32[TOOL_BUFFER_SIZE_U32] = {0};
+uint32_t TstCrc_u32 = 0;
+uint32_t TstCursor_u32 = 0;
+uint32_t TstSum_u32 = 0;
+
+/* Multiply a reflected CRC-32 polynomial by x^n modulo P. */
+static uint32_t Tool_ShadowMulX_u32(uint32_t val_u32, uint32_t n_u32) {
+  uint32_t l_val_u32 = val_u32;
+
+  for(uint32_t l_i_u32 = 0U; l_i_u32 < n_u32; l_i_u32++) {
+    l_val_u32 = ((l_val_u32 & 1U) != 0U) ? ((l_val_u32 >> 1U) ^ TOOL_CRC_POLY_U32) : (l_val_u32 >> 1U);
+  }
+
+  return l_val_u32;
+}
+
+/* Multipliers of Tool_ShadowUpd(); the image is all zeros, so is its CRC. */
+void Tool_ShadowInit(void) {
+  uint32_t l_pow_u32 = Tool_ShadowMulX_u32(0x80000000UL, 32U); /* x^32 */
+
+  for(uint32_t l_i_u32 = TOOL_BUFFER_SIZE_U32; l_i_u32 > 0U; l_i_u32--) {
+    ShadowPow_u32[l_i_u32 - 1U] = l_pow_u32;
+    l_pow_u32 = Tool_ShadowMulX_u32(l_pow_u32, 8U);
+  }
+  ShadowCrc_u32 = 0U;
+}
+
+static uint32_t Tool_ShadowTerm_u32(uint32_t index_u32, uint8_t value_u8) {
+  uint32_t l_pow_u32 = ShadowPow_u32[index_u32];
+  uint32_t l_crc_u32 = 0U;
+
+  for(uint32_t l_bit_u32 = 0U; l_bit_u32 < 8U; l_bit_u32++) {
+    l_crc_u32 ^= l_pow_u32 & (0U - (((uint32_t)value_u8 >> (7U - l_bit_u32)) & 1U));
+    l_pow_u32 = (l_pow_u32 >> 1U) ^ ((uint32_t)TOOL_CRC_POLY_U32 & (0U - (l_pow_u32 & 1U)));
+  }
+
+  return l_crc_u32;
+}
+
+void Tool_ShadowUpd(uint32_t index_u32, uint8_t delta_u8) {
+  uint32_t l_term_u32 = Tool_ShadowTerm_u32(index_u32, delta_u8);
+
+  ShadowCrc_u32 ^= l_term_u32;
+  TstCrc_u32 ^= l_term_u32 & (0U - (uint32_t)(index_u32 < TstCursor_u32));
+}
+
+/* Next Tool_RunTstStep_u8() starts a new sweep. */
+static void Tool_TstRestart(void) {
+  TstCursor_u32 = 0U;
+  TstSum_u32 = 0U;
+  TstCrc_u32 = 0U;
+}
+
+/* FUNCTION TO TEST */
+
+
+uint8_t Tool_RunTstStep_u8(void) {
+  uint8_t l_ret_u8 = 3U;
+
+  TOOL_SEQ_WRITE_BEGIN();
+
+  /* Invariant first, on every slice: a violation aborts the sweep. */
+  if(Count_u32 > TOOL_BUFFER_SIZE_U32) {
+    StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+    Tool_TstRestart();
+    l_ret_u8 = 1U;
+  } else {
+    uint32_t l_end_u32 = ((TOOL_BUFFER_SIZE_U32 - TstCursor_u32) > TOOL_TST_SLICE_U32) ? (TstCursor_u32 + TOOL_TST_SLICE_U32) : TOOL_BUFFER_SIZE_U32;
+    uint32_t l_sum_u32 = TstSum_u32;
+
+    for(uint32_t l_i_u32 = TstCursor_u32; l_i_u32 < l_end_u32; l_i_u32++) {
+      l_sum_u32 += (uint32_t)Buffer_u8[l_i_u32];
+      TstCrc_u32 ^= Tool_ShadowTerm_u32(l_i_u32, Buffer_u8[l_i_u32]);
+    }
+
+    if(l_end_u32 < TOOL_BUFFER_SIZE_U32) {
+      TstCursor_u32 = l_end_u32;
+      TstSum_u32 = l_sum_u32;
+    } else {
+      /* Sweep complete: same verdict as Tool_RunTst_u8(). */
+      if(l_sum_u32 > (255UL * TOOL_BUFFER_SIZE_U32)) {
+        StatusFlg_u32 |= TOOL_STATUS_UDF_U32;
+        l_ret_u8 = 2U;
+      } else {
+        StatusFlg_u32 &= ~TOOL_STATUS_UDF_U32;
+        l_ret_u8 = 0U;
+      }
+      /* Writes behind the cursor were folded in by Tool_ShadowUpd(), so the
+       * swept terms describe the current image. */
+      if((l_ret_u8 == 0U) && (TstCrc_u32 != ShadowCrc_u32)) {
+        StatusFlg_u32 |= TOOL_STATUS_ERR_U32;
+        l_ret_u8 = 4U;
+      }
+      Tool_TstRestart();
+    }
+  }
+
+  TOOL_SEQ_WRITE_END();
+
+  return l_ret_u8;
+}
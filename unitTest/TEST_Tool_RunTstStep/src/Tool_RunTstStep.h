@@ -0,0 +1,8 @@
+#include "Tool.h"
+
+extern uint32_t ShadowCrc_u32;
+extern uint32_t TstCrc_u32;
+
+void Tool_ShadowInit(void);
+void Tool_ShadowUpd(uint32_t index_u32, uint8_t delta_u8);
+uint8_t Tool_RunTstStep_u8(void);
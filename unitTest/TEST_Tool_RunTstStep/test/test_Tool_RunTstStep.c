@@ -0,0 +1,234 @@
+#include "Tool.h"
+#include "Tool_RunTstStep.h"
+#include "mock_Tool.h"
+#include "unity.h"
+#include <stdint.h>
+#include <string.h>
+
+#define SWEEP_CALLS_U32 (TOOL_BUFFER_SIZE_U32 / TOOL_TST_SLICE_U32)
+
+/*==================[test helper functions]==================================*/
+
+/* Raw CRC (init 0, no final XOR) of the whole image: the full recompute the
+ * shadow must match. */
+static uint32_t ImageCrc_u32(void) {
+  uint32_t l_crc_u32 = 0U;
+
+  for(uint32_t i = 0U; i < TOOL_BUFFER_SIZE_U32; i++) {
+    l_crc_u32 ^= (uint32_t)Buffer_u8[i];
+    for(uint32_t b = 0U; b < 8U; b++) {
+      l_crc_u32 = ((l_crc_u32 & 1U) != 0U) ? ((l_crc_u32 >> 1U) ^ (uint32_t)TOOL_CRC_POLY_U32) : (l_crc_u32 >> 1U);
+    }
+  }
+
+  return l_crc_u32;
+}
+
+/* Tool_PushUnchecked(): shadow update, store, advance. */
+static void Push(uint8_t value_u8) {
+  Tool_ShadowUpd(Head_u32, (uint8_t)(Buffer_u8[Head_u32] ^ value_u8));
+  Buffer_u8[Head_u32] = value_u8;
+  Head_u32 = (Head_u32 + 1U) % TOOL_BUFFER_SIZE_U32;
+  Count_u32++;
+}
+
+/* Tool_PopUnchecked_u8(): shadow update, clear, advance. */
+static uint8_t Pop_u8(void) {
+  uint8_t l_val_u8 = Buffer_u8[Tail_u32];
+
+  Tool_ShadowUpd(Tail_u32, l_val_u8);
+  Buffer_u8[Tail_u32] = 0U;
+  Tail_u32 = (Tail_u32 + 1U) % TOOL_BUFFER_SIZE_U32;
+  Count_u32--;
+
+  return l_val_u8;
+}
+
+/* Slices until the sweep gives its verdict. */
+static uint8_t Sweep_u8(void) {
+  uint8_t l_ret_u8 = 3U;
+
+  for(uint32_t k = 0U; (k < SWEEP_CALLS_U32) && (l_ret_u8 == 3U); k++) {
+    l_ret_u8 = Tool_RunTstStep_u8();
+  }
+
+  return l_ret_u8;
+}
+
+void setUp(void) {
+  /* Reset Tool internal globals to a known state */
+  (void)memset(Buffer_u8, 0, TOOL_BUFFER_SIZE_U32);
+
+  Head_u32 = 0U;
+  Tail_u32 = 0U;
+  Count_u32 = 0U;
+
+  StatusFlg_u32 = 0U;
+  Mode_e = Tool_modeIdle_e;
+
+  Seq_u32 = 0U;
+
+  TstCursor_u32 = 0U;
+  TstSum_u32 = 0U;
+  TstCrc_u32 = 0U;
+  Tool_ShadowInit();
+}
+
+void tearDown(void) { /* nothing */ }
+
+/*==================[test cases]=============================================*/
+
+void test_Tool_RunTstStep_ReportsInProgressUntilLastSlice(void) {
+  /* Arrange */
+  for(uint32_t i = 0U; i < TOOL_BUFFER_SIZE_U32; i++) {
+    Buffer_u8[i] = 1U;
+  }
+
+  /* Act / Assert */
+  for(uint32_t k = 1U; k < SWEEP_CALLS_U32; k++) {
+    TEST_ASSERT_EQUAL_UINT8(3U, Tool_RunTstStep_u8());
+    TEST_ASSERT_EQUAL_UINT32(k * TOOL_TST_SLICE_U32, TstCursor_u32);
+    TEST_ASSERT_EQUAL_UINT32(k * TOOL_TST_SLICE_U32, TstSum_u32);
+  }
+}
+
+void test_Tool_RunTstStep_FinalSliceGivesVerdictAndRestarts(void) {
+  uint8_t l_ret_u8 = 3U;
+
+  /* Arrange */
+  StatusFlg_u32 |= TOOL_STATUS_UDF_U32;
+  for(uint32_t i = 0U; i < TOOL_BUFFER_SIZE_U32; i++) {
+    Buffer_u8[i] = 0xFFU;
+  }
+  ShadowCrc_u32 = ImageCrc_u32();
+
+  /* Act */
+  for(uint32_t k = 0U; k < SWEEP_CALLS_U32; k++) {
+    l_ret_u8 = Tool_RunTstStep_u8();
+  }
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(0U, l_ret_u8);
+  TEST_ASSERT_FALSE((StatusFlg_u32 & TOOL_STATUS_UDF_U32) != 0U);
+  TEST_ASSERT_EQUAL_UINT32(0U, TstCursor_u32);
+  TEST_ASSERT_EQUAL_UINT32(0U, TstSum_u32);
+}
+
+void test_Tool_RunTstStep_SetsUnderflowFlagOnSuspiciousSum(void) {
+  /* Arrange: partial sum already at the bound, last slice pushes it over. */
+  TstCursor_u32 = TOOL_BUFFER_SIZE_U32 - TOOL_TST_SLICE_U32;
+  TstSum_u32 = 255UL * TOOL_BUFFER_SIZE_U32;
+  Buffer_u8[TOOL_BUFFER_SIZE_U32 - 1U] = 1U;
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_RunTstStep_u8();
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(2U, l_ret_u8);
+  TEST_ASSERT_TRUE((StatusFlg_u32 & TOOL_STATUS_UDF_U32) != 0U);
+  TEST_ASSERT_EQUAL_UINT32(0U, TstCursor_u32);
+}
+
+void test_Tool_RunTstStep_InvariantViolationAbortsSweep(void) {
+  /* Arrange */
+  TstCursor_u32 = TOOL_TST_SLICE_U32;
+  TstSum_u32 = 100U;
+  Count_u32 = TOOL_BUFFER_SIZE_U32 + 1U;
+
+  /* Act */
+  uint8_t l_ret_u8 = Tool_RunTstStep_u8();
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(1U, l_ret_u8);
+  TEST_ASSERT_TRUE((StatusFlg_u32 & TOOL_STATUS_ERR_U32) != 0U);
+  TEST_ASSERT_EQUAL_UINT32(0U, TstCursor_u32);
+  TEST_ASSERT_EQUAL_UINT32(0U, TstSum_u32);
+}
+
+void test_Tool_RunTstStep_KeepsSeqCounterEven(void) {
+  /* Act */
+  (void)Tool_RunTstStep_u8();
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT32(2U, Seq_u32);
+}
+
+void test_Tool_RunTstStep_ShadowMatchesRecomputeAfterPushPopWrapAndTransform(void) {
+  /* Arrange: start near the end so the queue wraps */
+  Head_u32 = 50U;
+  Tail_u32 = 50U;
+
+  /* Act / Assert: push across the wrap */
+  for(uint32_t i = 0U; i < 30U; i++) {
+    Push((uint8_t)((i * 37U) + 11U));
+  }
+  TEST_ASSERT_EQUAL_HEX32(ImageCrc_u32(), ShadowCrc_u32);
+
+  /* Act / Assert: pop */
+  for(uint32_t i = 0U; i < 10U; i++) {
+    (void)Pop_u8();
+  }
+  TEST_ASSERT_EQUAL_HEX32(ImageCrc_u32(), ShadowCrc_u32);
+
+  /* Act / Assert: Tool_Process() transform (pop, XOR, push back) */
+  for(uint32_t i = 0U; i < 20U; i++) {
+    Push((uint8_t)(Pop_u8() ^ 0x5AU));
+  }
+  TEST_ASSERT_EQUAL_HEX32(ImageCrc_u32(), ShadowCrc_u32);
+
+  /* Assert: the sliced self-test agrees */
+  TEST_ASSERT_EQUAL_UINT8(0U, Sweep_u8());
+  TEST_ASSERT_FALSE((StatusFlg_u32 & TOOL_STATUS_ERR_U32) != 0U);
+}
+
+void test_Tool_RunTstStep_WritesDuringSweepAreFoldedIn(void) {
+  /* Arrange: queue at 0..39, sweep stopped after two slices */
+  for(uint32_t i = 0U; i < 40U; i++) {
+    Push((uint8_t)(i + 1U));
+  }
+  TEST_ASSERT_EQUAL_UINT8(3U, Tool_RunTstStep_u8());
+  TEST_ASSERT_EQUAL_UINT8(3U, Tool_RunTstStep_u8());
+
+  /* Act: pops behind the cursor, pushes ahead of it */
+  for(uint32_t i = 0U; i < 5U; i++) {
+    (void)Pop_u8();
+  }
+  for(uint32_t i = 0U; i < 10U; i++) {
+    Push((uint8_t)(0xA0U + i));
+  }
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(0U, Sweep_u8());
+  TEST_ASSERT_EQUAL_HEX32(ImageCrc_u32(), ShadowCrc_u32);
+}
+
+void test_Tool_RunTstStep_BitFlipReportsShadowMismatch(void) {
+  /* Arrange: one bit flipped in RAM, bypassing the shadow */
+  for(uint32_t i = 0U; i < 40U; i++) {
+    Push((uint8_t)(i * 3U));
+  }
+  Buffer_u8[23] ^= 0x08U;
+  TEST_ASSERT_NOT_EQUAL(ImageCrc_u32(), ShadowCrc_u32);
+
+  /* Act */
+  uint8_t l_ret_u8 = Sweep_u8();
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT8(4U, l_ret_u8);
+  TEST_ASSERT_TRUE((StatusFlg_u32 & TOOL_STATUS_ERR_U32) != 0U);
+  TEST_ASSERT_EQUAL_UINT32(0U, TstCursor_u32);
+  TEST_ASSERT_EQUAL_HEX32(0U, TstCrc_u32);
+}
+
+void test_Tool_RunTstStep_BitFlipBehindCursorIsReportedByNextSweep(void) {
+  /* Arrange: sweep past index 5, then flip it */
+  for(uint32_t i = 0U; i < 40U; i++) {
+    Push((uint8_t)(i * 3U));
+  }
+  TEST_ASSERT_EQUAL_UINT8(3U, Tool_RunTstStep_u8());
+  Buffer_u8[5] ^= 0x40U;
+
+  /* Act / Assert: the running sweep read the old byte, the next one sees it */
+  TEST_ASSERT_EQUAL_UINT8(0U, Sweep_u8());
+  TEST_ASSERT_EQUAL_UINT8(4U, Sweep_u8());
+}
@@ -0,0 +1,10 @@
+#include "Tool.h"
+
+#define TOOL_SUM_KERNELS_U32 (4U)
+
+typedef enum { Tool_sumKernelScalar_e = 0, Tool_sumKernelSse2_e = 1, Tool_sumKernelAvx2_e = 2, Tool_sumKernelNeon_e = 3 } Tool_sumKernel_e;
+
+uint32_t Tool_SumBytes_u32(const uint8_t *data_pcu8, uint32_t length_u32);
+Tool_sumKernel_e Tool_SumBest_e(void);
+Tool_sumKernel_e Tool_SumActive_e(void);
+uint8_t Tool_SumSelect_u8(Tool_sumKernel_e kernel_e);
@@ -0,0 +1,111 @@
+#include "Tool.h"
+#include "Tool_SumBytes.h"
+#include "mock_Tool.h"
+#include "unity.h"
+#include <stdint.h>
+#include <string.h>
+
+/* Longer than one NEON fold (2 KiB) several times over, plus room for offsets. */
+#define DATA_LEN_U32 (70001U)
+#define OFFSETS_U32 (32U)
+
+static uint8_t Data_au8[DATA_LEN_U32 + OFFSETS_U32];
+
+/*==================[test helper functions]==================================*/
+
+/* Reference: the plain scalar loop. */
+static uint32_t RefSum_u32(const uint8_t *data_pcu8, uint32_t length_u32) {
+  uint32_t l_sum_u32 = 0U;
+
+  for(uint32_t i = 0U; i < length_u32; i++) {
+    l_sum_u32 += (uint32_t)data_pcu8[i];
+  }
+
+  return l_sum_u32;
+}
+
+static void FillPattern(void) {
+  uint32_t l_x_u32 = 0x12345678UL;
+
+  for(uint32_t i = 0U; i < (uint32_t)sizeof(Data_au8); i++) {
+    l_x_u32 = (l_x_u32 * 1103515245UL) + 12345UL;
+    Data_au8[i] = (uint8_t)(l_x_u32 >> 23U);
+  }
+}
+
+/* Compare one kernel with the reference over lengths 1..max_u32 at every offset. */
+static void CheckKernel(Tool_sumKernel_e kernel_e, uint32_t max_u32) {
+  TEST_ASSERT_EQUAL_UINT8(0U, Tool_SumSelect_u8(kernel_e));
+  TEST_ASSERT_EQUAL_INT(kernel_e, Tool_SumActive_e());
+  for(uint32_t l_off_u32 = 0U; l_off_u32 < OFFSETS_U32; l_off_u32++) {
+    for(uint32_t l_len_u32 = 1U; l_len_u32 <= max_u32; l_len_u32++) {
+      TEST_ASSERT_EQUAL_UINT32(RefSum_u32(&Data_au8[l_off_u32], l_len_u32), Tool_SumBytes_u32(&Data_au8[l_off_u32], l_len_u32));
+    }
+  }
+}
+
+void setUp(void) {
+  FillPattern();
+}
+
+void tearDown(void) {
+  (void)Tool_SumSelect_u8(Tool_SumBest_e());
+}
+
+/*==================[test cases]=============================================*/
+
+void test_Tool_SumBytes_NullOrEmptyGivesZero(void) {
+  for(uint32_t k = 0U; k < TOOL_SUM_KERNELS_U32; k++) {
+    if(Tool_SumSelect_u8((Tool_sumKernel_e)k) == 0U) {
+      TEST_ASSERT_EQUAL_UINT32(0U, Tool_SumBytes_u32(NULL, 10U));
+      TEST_ASSERT_EQUAL_UINT32(0U, Tool_SumBytes_u32(Data_au8, 0U));
+    }
+  }
+}
+
+void test_Tool_SumBytes_EveryKernelMatchesScalarAtShortLengthsAndOffsets(void) {
+  uint32_t l_tested_u32 = 0U;
+
+  for(uint32_t k = 0U; k < TOOL_SUM_KERNELS_U32; k++) {
+    if(Tool_SumSelect_u8((Tool_sumKernel_e)k) == 0U) {
+      /* Covers every remainder of the 16-, 32- and 64-byte steps. */
+      CheckKernel((Tool_sumKernel_e)k, 300U);
+      l_tested_u32++;
+    }
+  }
+
+  TEST_ASSERT_TRUE(l_tested_u32 >= 1U);
+}
+
+void test_Tool_SumBytes_EveryKernelMatchesScalarAtLongOddLengths(void) {
+  static const uint32_t Len_au32[] = {2047U, 2048U, 2049U, 4111U, 65535U, 65537U, DATA_LEN_U32};
+
+  for(uint32_t k = 0U; k < TOOL_SUM_KERNELS_U32; k++) {
+    if(Tool_SumSelect_u8((Tool_sumKernel_e)k) == 0U) {
+      for(uint32_t l_off_u32 = 0U; l_off_u32 < OFFSETS_U32; l_off_u32 += 3U) {
+        for(uint32_t n = 0U; n < (uint32_t)(sizeof(Len_au32) / sizeof(Len_au32[0])); n++) {
+          TEST_ASSERT_EQUAL_UINT32(RefSum_u32(&Data_au8[l_off_u32], Len_au32[n]), Tool_SumBytes_u32(&Data_au8[l_off_u32], Len_au32[n]));
+        }
+      }
+    }
+  }
+}
+
+void test_Tool_SumBytes_EveryKernelMatchesScalarOnSaturatedBytes(void) {
+  /* All 0xFF: the widest partial sums each kernel can build. */
+  (void)memset(Data_au8, 0xFF, sizeof(Data_au8));
+
+  for(uint32_t k = 0U; k < TOOL_SUM_KERNELS_U32; k++) {
+    if(Tool_SumSelect_u8((Tool_sumKernel_e)k) == 0U) {
+      TEST_ASSERT_EQUAL_UINT32(255UL * 2049UL, Tool_SumBytes_u32(&Data_au8[1], 2049U));
+      TEST_ASSERT_EQUAL_UINT32(255UL * DATA_LEN_U32, Tool_SumBytes_u32(&Data_au8[7], DATA_LEN_U32));
+    }
+  }
+}
+
+void test_Tool_SumSelect_ScalarAlwaysAvailableAndRangeChecked(void) {
+  TEST_ASSERT_EQUAL_UINT8(0U, Tool_SumSelect_u8(Tool_sumKernelScalar_e));
+  TEST_ASSERT_EQUAL_INT(Tool_sumKernelScalar_e, Tool_SumActive_e());
+  TEST_ASSERT_EQUAL_UINT8(2U, Tool_SumSelect_u8((Tool_sumKernel_e)TOOL_SUM_KERNELS_U32));
+  TEST_ASSERT_EQUAL_INT(Tool_sumKernelScalar_e, Tool_SumActive_e());
+}
@@ -0,0 +1,28 @@
+#include "Tool.h"
+
+#define TOOL_TRC_DEPTH_U32 (256U)
+#define TOOL_TRC_MASK_U32 (TOOL_TRC_DEPTH_U32 - 1U)
+#define TOOL_TRC_DT_MAX_U32 (0xFFFFUL)
+#define TOOL_TRC_REC_SIZE_U32 (6U)
+#define TOOL_TRC_HDR_SIZE_U32 (16U)
+#define TOOL_TRC_VERSION_U8 (1U)
+
+/* The acquire fences of the dump call into the test: it plays the writer there. */
+void Tool_TrcFenceHook(void);
+#define TOOL_TRC_FENCE_ACQ() Tool_TrcFenceHook()
+#define TOOL_TRC_FENCE_REL() __atomic_thread_fence(__ATOMIC_RELEASE)
+
+typedef struct {
+  uint8_t op_u8;
+  uint8_t ret_u8;
+  uint16_t count_u16;
+  uint16_t dt_u16;
+} Tool_trcRec_t;
+
+extern Tool_trcRec_t Rec_s[TOOL_TRC_DEPTH_U32];
+extern volatile uint32_t Wr_u32;
+extern volatile uint8_t Full_u8;
+extern uint32_t LastTs_u32;
+
+void Tool_TrcLog(uint8_t op_u8, uint8_t ret_u8, uint32_t count_u32);
+uint32_t Tool_TrcDump_u32(uint8_t *out_pu8, uint32_t size_u32);
@@ -0,0 +1,128 @@
+#include "Tool.h"
+#include "Tool_TrcDump.h"
+#include "mock_Tool.h"
+#include "unity.h"
+#include <stdint.h>
+#include <string.h>
+
+static uint8_t Out_au8[TOOL_TRC_HDR_SIZE_U32 + (TOOL_TRC_DEPTH_U32 * TOOL_TRC_REC_SIZE_U32)];
+
+/* Writer activity injected at the n-th acquire fence of the dump (1 = before the copy). */
+static uint32_t Fence_u32;
+static uint32_t HookAt_u32;
+static void (*Hook_pf)(void);
+
+/*==================[test helper functions]==================================*/
+
+void Tool_TrcFenceHook(void) {
+  Fence_u32++;
+  if((Fence_u32 == HookAt_u32) && (Hook_pf != NULL)) {
+    Hook_pf();
+  }
+}
+
+/* Log n_u32 records whose count field is their own index. */
+static void LogN(uint32_t n_u32) {
+  for(uint32_t i = 0U; i < n_u32; i++) {
+    Tool_TrcLog(4U, 0U, Wr_u32);
+  }
+}
+
+/* Writer started record Wr_u32 but was preempted before publishing it. */
+static void HalfWrite(void) {
+  Rec_s[Wr_u32 & TOOL_TRC_MASK_U32].op_u8 = 0xEEU;
+}
+
+/* Writer published three more records. */
+static void LogThree(void) {
+  LogN(3U);
+}
+
+static uint32_t Get32_u32(const uint8_t *in_pcu8) {
+  return (uint32_t)in_pcu8[0] | ((uint32_t)in_pcu8[1] << 8U) | ((uint32_t)in_pcu8[2] << 16U) | ((uint32_t)in_pcu8[3] << 24U);
+}
+
+static uint16_t RecCount_u16(uint32_t i_u32) {
+  const uint8_t *l_rec_pcu8 = &Out_au8[TOOL_TRC_HDR_SIZE_U32 + (i_u32 * TOOL_TRC_REC_SIZE_U32)];
+
+  return (uint16_t)((uint16_t)l_rec_pcu8[2] | ((uint16_t)l_rec_pcu8[3] << 8U));
+}
+
+/* Every dumped record is intact and they are consecutive from first_u32. */
+static void AssertRecords(uint32_t n_u32, uint32_t first_u32) {
+  TEST_ASSERT_EQUAL_UINT32(n_u32, Get32_u32(&Out_au8[8]));
+  TEST_ASSERT_EQUAL_UINT32(first_u32, Get32_u32(&Out_au8[12]));
+  for(uint32_t i = 0U; i < n_u32; i++) {
+    TEST_ASSERT_EQUAL_UINT8(4U, Out_au8[TOOL_TRC_HDR_SIZE_U32 + (i * TOOL_TRC_REC_SIZE_U32)]);
+    TEST_ASSERT_EQUAL_UINT16((uint16_t)(first_u32 + i), RecCount_u16(i));
+  }
+}
+
+void setUp(void) {
+  (void)memset(Rec_s, 0, sizeof(Rec_s));
+  (void)memset(Out_au8, 0, sizeof(Out_au8));
+  Wr_u32 = 0U;
+  Full_u8 = 0U;
+  LastTs_u32 = 0U;
+
+  Fence_u32 = 0U;
+  HookAt_u32 = 0U;
+  Hook_pf = NULL;
+}
+
+void tearDown(void) { /* nothing */ }
+
+/*==================[test cases]=============================================*/
+
+void test_Tool_TrcDump_PartialRingDumpsEveryRecord(void) {
+  /* Arrange */
+  LogN(10U);
+
+  /* Act */
+  uint32_t l_len_u32 = Tool_TrcDump_u32(Out_au8, sizeof(Out_au8));
+
+  /* Assert */
+  TEST_ASSERT_EQUAL_UINT32(TOOL_TRC_HDR_SIZE_U32 + (10U * TOOL_TRC_REC_SIZE_U32), l_len_u32);
+  TEST_ASSERT_EQUAL_MEMORY("TTRC", Out_au8, 4U);
+  AssertRecords(10U, 0U);
+}
+
+void test_Tool_TrcDump_WriteInProgressOneLapBehindIsDropped(void) {
+  /* Arrange: ring lapped; the next write goes to the slot of the oldest record */
+  LogN(300U);
+  Hook_pf = HalfWrite;
+  HookAt_u32 = 1U;
+
+  /* Act */
+  uint32_t l_len_u32 = Tool_TrcDump_u32(Out_au8, sizeof(Out_au8));
+
+  /* Assert: the torn slot (record 44 / 300) is not returned */
+  TEST_ASSERT_EQUAL_UINT32(TOOL_TRC_HDR_SIZE_U32 + ((TOOL_TRC_DEPTH_U32 - 1U) * TOOL_TRC_REC_SIZE_U32), l_len_u32);
+  AssertRecords(TOOL_TRC_DEPTH_U32 - 1U, 300U - TOOL_TRC_DEPTH_U32 + 1U);
+}
+
+void test_Tool_TrcDump_RecordsPublishedDuringCopyDropLappedSlots(void) {
+  /* Arrange: three records published while the dump copies */
+  LogN(300U);
+  Hook_pf = LogThree;
+  HookAt_u32 = 1U;
+
+  /* Act */
+  (void)Tool_TrcDump_u32(Out_au8, sizeof(Out_au8));
+
+  /* Assert: slots of records 44..46 were overwritten, 47 may be in progress */
+  AssertRecords(TOOL_TRC_DEPTH_U32 - 4U, 48U);
+}
+
+void test_Tool_TrcDump_SmallBufferIsNotAffectedByTheWriter(void) {
+  /* Arrange: room for 8 records only, far from the slot being written */
+  LogN(300U);
+  Hook_pf = HalfWrite;
+  HookAt_u32 = 1U;
+
+  /* Act */
+  (void)Tool_TrcDump_u32(Out_au8, TOOL_TRC_HDR_SIZE_U32 + (8U * TOOL_TRC_REC_SIZE_U32));
+
+  /* Assert: newest 8 records */
+  AssertRecords(8U, 292U);
+}